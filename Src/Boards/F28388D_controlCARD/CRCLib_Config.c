@@ -0,0 +1,49 @@
+/*******************************************************************************
+// CRC Library Configuration Data
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "CRCLib.h"
+// Platform Includes
+#include "MessageRouter.h"
+// Other Includes
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// This table provides a list of commands for this module. The primary purpose
+// is to link each Command ID to its corresponding message handler function
+const MessageRouter_CommandTableItem_t crcMessageTable[] =
+{
+   // {Command ID, Message Handler Function Pointer}
+   { 0x01, CRCLib_MessageRouter_Benchmark },
+};
+
+
+const MessageRouter_Data_t crcMessageConfig =
+{
+ .numCommands = sizeof(crcMessageTable)/sizeof(MessageRouter_CommandTableItem_t),
+ .commandTable = crcMessageTable
+};
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
@@ -0,0 +1,47 @@
+/*******************************************************************************
+// CRC Library Configuration
+*******************************************************************************/
+// Prevent multiple inclusion of header file
+#pragma once
+
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+// Platform Includes
+// Other Includes
+
+
+/*******************************************************************************
+// Start C Binding Section for C++ Compilers
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// Use the VCU CRC instructions of the C28x core. Builds for other targets
+// always use the software tables.
+#define CRCLIB_BACKEND (CRCLIB_BACKEND_DEVICE)
+
+// Data shorter than this many bytes is checked in software, where the call
+// into the device routine would cost more than it saves
+#define CRCLIB_DEVICE_MIN_LENGTH (16U)
+
+// Store two entries in each word of the tables for 8-bit CRCs, since a char
+// is 16 bits on this target and one entry per word wastes half the table
+#define CRCLIB_PACK_8BIT_TABLES (1)
+
+
+/*******************************************************************************
+// End of C Binding Section
+*******************************************************************************/
+#ifdef __cplusplus
+}
+#endif
@@ -37,6 +37,8 @@ const Error_Mgr_Data_t errorData[] =
    { ERROR_MGR_ERROR_OVER_VOLTAGE },
    { ERROR_MGR_ERROR_OVER_TEMP },
    { ERROR_MGR_ERROR_GATE_DRIVER },
+   // Flash or constant data no longer matches the build
+   { ERROR_MGR_ERROR_INTEGRITY },
 };
 
 
@@ -38,6 +38,7 @@ typedef enum {
    ERROR_MGR_ERROR_OVER_VOLTAGE,
    ERROR_MGR_ERROR_OVER_TEMP,
    ERROR_MGR_ERROR_GATE_DRIVER,
+   ERROR_MGR_ERROR_INTEGRITY,
    ERROR_MGR_ERROR_COUNT
 } Error_Mgr_Error_t;
 
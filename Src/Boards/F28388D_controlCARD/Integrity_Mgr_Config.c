@@ -0,0 +1,129 @@
+/*******************************************************************************
+// Integrity Manager Configuration
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "Integrity_Mgr.h"
+#include "Integrity_Mgr_Config.h"
+#include "Integrity_Mgr_ConfigTypes.h" // Defines configuration structure
+// Platform Includes
+#include "MessageRouter.h"
+#include "Sys.h" // Ramfuncs linker symbols
+// Other Includes
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// Blocks of 256 bytes checked per call of Integrity_Mgr_Update(). At one call
+// every 10ms this reads 200KB per second, so the 256KB application image is
+// checked about every 1.3 seconds.
+#define INTEGRITY_BLOCKS_PER_PASS (8U)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// External Variable Declarations
+*******************************************************************************/
+
+// Region boundaries from the linker command file
+extern uint16_t IntegrityAppImageStart;
+extern uint16_t IntegrityAppImageEnd;
+extern uint16_t IntegrityConstStart;
+extern uint16_t IntegrityConstEnd;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The expected CRC of each region. The post-build step calculates these from
+// the linked image and writes them over the placeholders, so this section
+// must lie outside all the checked regions.
+#pragma DATA_SECTION(integrityExpectedCrcs, ".integrity_crc")
+#pragma RETAIN(integrityExpectedCrcs)
+const volatile uint32_t integrityExpectedCrcs[INTEGRITY_MGR_REGION_ID_COUNT] =
+{
+   0xFFFFFFFFUL,
+   0xFFFFFFFFUL,
+   0xFFFFFFFFUL
+};
+
+// The regions checked in the background. The linker command file must align
+// the start of each region to 256 bytes (128 words), or the region is skipped
+// and ERROR_MGR_ERROR_INTEGRITY is set at startup. The end should be padded to
+// 256 bytes too, which the ramfuncs output section does not do by default:
+//    .TI.ramfunc : LOAD = FLASH_BANK0, RUN = RAMLS0,
+//                  RUN_START(RamfuncsRunStart), RUN_END(RamfuncsRunEnd),
+//                  ALIGN(128), palign(128)
+// A region that is not padded is still checked, but the words after its last
+// whole block are read by the CPU rather than the CRC engine.
+const Integrity_Mgr_RegionConfig_t integrityConfigData[] =
+{
+   // Code and initialized data in flash
+   {
+      .regionId = INTEGRITY_MGR_REGION_ID_APP_IMAGE,
+      .startAddress = &IntegrityAppImageStart,
+      .endAddress = &IntegrityAppImageEnd,
+      .expectedCrc = &integrityExpectedCrcs[INTEGRITY_MGR_REGION_ID_APP_IMAGE]
+   },
+   // Constant data, including the *_Config.c tables
+   {
+      .regionId = INTEGRITY_MGR_REGION_ID_CONST_DATA,
+      .startAddress = &IntegrityConstStart,
+      .endAddress = &IntegrityConstEnd,
+      .expectedCrc = &integrityExpectedCrcs[INTEGRITY_MGR_REGION_ID_CONST_DATA]
+   },
+#ifdef _FLASH
+   // Functions copied to RAM at startup, which must match their flash image
+   {
+      .regionId = INTEGRITY_MGR_REGION_ID_RAMFUNCS,
+      .startAddress = &RamfuncsRunStart,
+      .endAddress = &RamfuncsRunEnd,
+      .expectedCrc = &integrityExpectedCrcs[INTEGRITY_MGR_REGION_ID_RAMFUNCS]
+   }
+#endif
+};
+
+
+// Common configuration structure passed to the module initialization function
+const Integrity_Mgr_Config_t integrityConfig =
+{
+   // The number of items in the integrityConfigData - calculated by compiler
+   .numConfigItems = sizeof(integrityConfigData) / sizeof(Integrity_Mgr_RegionConfig_t),
+   // Region configuration data
+   .regionConfigArray = integrityConfigData,
+   // Limits the memory read per pass so the check never delays the loop
+   .blocksPerPass = INTEGRITY_BLOCKS_PER_PASS
+};
+
+// This table provides a list of commands for this module.
+const MessageRouter_CommandTableItem_t integrityMessageTable[] =
+{
+   // {Command ID, Message Handler Function Pointer}
+   { 1, Integrity_Mgr_MessageRouter_GetRegionStatus },
+};
+
+const MessageRouter_Data_t integrityMessageConfig =
+{
+ .numCommands = sizeof(integrityMessageTable)/sizeof(MessageRouter_CommandTableItem_t),
+ .commandTable = integrityMessageTable
+};
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
@@ -0,0 +1,47 @@
+/*******************************************************************************
+// Integrity Manager Configuration Interface
+*******************************************************************************/
+// Prevent multiple inclusion of header file
+#pragma once
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+// Platform Includes
+// Other Includes
+
+
+/*******************************************************************************
+// Start C Binding Section for C++ Compilers
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+// Logical enumeration for the checked memory regions
+typedef enum
+{
+    INTEGRITY_MGR_REGION_ID_APP_IMAGE,
+    INTEGRITY_MGR_REGION_ID_CONST_DATA,
+    INTEGRITY_MGR_REGION_ID_RAMFUNCS,
+    INTEGRITY_MGR_REGION_ID_COUNT
+} Integrity_Mgr_RegionId_t;
+
+
+/*******************************************************************************
+// End of C Binding Section
+*******************************************************************************/
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,52 @@
+/*******************************************************************************
+// Integrity Manager Configuration Types
+*******************************************************************************/
+// Prevent multiple inclusion of header file
+#pragma once
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "Integrity_Mgr_Config.h"
+// Platform Includes
+// Other Includes
+#include <stdint.h> // Defines C99 integer types
+
+
+/*******************************************************************************
+// Start C Binding Section for C++ Compilers
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+typedef struct Integrity_Mgr_Data_s
+{
+    // Region identifier
+    Integrity_Mgr_RegionId_t regionId;
+    // The first word of the region. Must be aligned to a 256 byte block.
+    const uint16_t *startAddress;
+    // The word after the last word of the region. The words after the last
+    // whole 256 byte block are read by the CPU rather than the CRC engine.
+    const uint16_t *endAddress;
+    // The CRC of the region stamped into the image at build time
+    const volatile uint32_t *expectedCrc;
+} Integrity_Mgr_RegionConfig_t;
+
+
+// End of C Binding Section
+#ifdef __cplusplus
+}
+#endif
@@ -10,32 +10,87 @@
 #include "Scheduler.h"
 #include "Scheduler_Config.h" // Defines configuration structure
 // Platform Includes
+#include "MessageRouter.h"
 // Other Includes
+#include "ADC_Drv.h"
+#include "Integrity_Mgr.h"
 #include "LED_Mgr.h"
+#include "PWM_Drv.h"
 #include "Serial.h"
+#include "Sys.h"
+#include "Telemetry_Mgr.h"
+#include "Transfer_Mgr.h"
 #include "UART_Drv.h"
+#include "driverlib.h" // Interrupt numbers
 
 /*******************************************************************************
 // Private Constant Definitions
 *******************************************************************************/
 
+// Cycles the fast tier may use per EPWM2 interrupt (5us at 200MHz)
+#define FAST_TIER_BUDGET_CYCLES (1000U)
+
+// Cycles the background loop may run back-to-back before LED updates are shed (1ms)
+#define FRAME_BUDGET_CYCLES (TIMEBASE_NUM_CYCLES_PER_MILLISECOND)
+
 
 /*******************************************************************************
 // Private Type Declarations
 *******************************************************************************/
 
 
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+// Called by the scheduler when no scheduled function is due
+static void IdleUntilNextDeadline(const Timebase_Tick_t ticksUntilNextDeadline);
+
+
 /*******************************************************************************
 // Private Variable Definitions
 *******************************************************************************/
 
 // The table defining all scheduled function and the periodic frequency to be called
+// Every UART channel is polled every tick so received characters reach the
+// receive buffers before the 16 character FIFOs fill. The UART driver posts
+// the serial event when a frame terminator arrives on any channel, or when a
+// waiting command has room for its response, so Serial_Update runs on the
+// next pass. Its interval remains as a fallback for anything the event
+// misses. Telemetry runs at the update period given in telemetryConfig.
+// The transfer update tops up the host port with the segments of a read, so
+// runs often enough that the transmit buffer does not drain between calls.
+// It is never shed, as a skipped call holds back the segments and the
+// retransmits of a transfer in flight. The LED update, telemetry and the
+// memory integrity check may be shed when the loop falls behind.
 const Scheduler_ConfigItem_t schedulerConfigData[] =
 {
-    // { ms, Pointer To Scheduled Function }
-       { 100, UART_Drv_Update },
-       { 100, LED_Mgr_Update },
-       { 100, Serial_Update },
+    // { ms, Pointer To Scheduled Function, Mode, Phase Offset ms, Priority, Sheddable, Events }
+       {   1, UART_Drv_Update, SCHEDULER_MODE_FIXED_RATE,  0, 0, false, 0U },
+       { 100, LED_Mgr_Update,  SCHEDULER_MODE_FIXED_RATE, 50, 2, true,  0U },
+       { 100, Serial_Update,   SCHEDULER_MODE_FIXED_RATE, 10, 1, false, SCHEDULER_EVENT_SERIAL_RX },
+       {  10, Integrity_Mgr_Update, SCHEDULER_MODE_FIXED_RATE, 5, 3, true, 0U },
+       {  10, Telemetry_Mgr_Update, SCHEDULER_MODE_FIXED_RATE, 2, 2, true, 0U },
+       {  10, Transfer_Mgr_Update, SCHEDULER_MODE_FIXED_RATE, 7, 2, false, 0U },
+};
+
+
+// The table defining all functions called from the EPWM2 TBCTR_ZERO interrupt
+const Scheduler_FastTierConfigItem_t schedulerFastTierConfigData[] =
+{
+    // { Priority, Rate Divider, Pointer To Scheduled Function }
+       { 0, 1, ADC_Drv_StoreResults },
+};
+
+// Fast tier dispatched from the PWM time base interrupt
+const Scheduler_FastTierConfig_t schedulerFastTierConfig =
+{
+    // The number of items in schedulerFastTierConfigData - calculated by compiler
+   .numConfigItems = sizeof(schedulerFastTierConfigData)/sizeof(Scheduler_FastTierConfigItem_t),
+   .fastTierConfigArray = schedulerFastTierConfigData,
+   .interruptNumber = INT_EPWM2,
+   .acknowledgeFunction = PWM_Drv_AcknowledgeInterrupt,
+   .budgetCycles = FAST_TIER_BUDGET_CYCLES
 };
 
 
@@ -48,7 +103,47 @@ extern const Scheduler_Config_t schedulerConfig =
    .numConfigItems = sizeof(schedulerConfigData)/sizeof(Scheduler_ConfigItem_t),
 
     // The configuration data from the module configuration file
-   .schedulerConfigArray = schedulerConfigData
+   .schedulerConfigArray = schedulerConfigData,
+
+    // Sleep between deadlines rather than spinning
+   .idleFunction = IdleUntilNextDeadline,
+
+    // Functions dispatched from the PWM interrupt
+   .fastTierConfig = &schedulerFastTierConfig,
+
+    // Shed low priority functions once the loop has run 1ms without idling
+   .frameBudgetCycles = FRAME_BUDGET_CYCLES,
+
+    // No optional functions are currently defined for this board
+   .numOptionalItems = 0U,
+   .optionalConfigArray = NULL
+};
+
+
+// This table provides a list of commands for this module. The primary purpose
+// is to link each Command ID to its corresponding message handler function
+const MessageRouter_CommandTableItem_t schedulerMessageTable[] =
+{
+   // {Command ID, Message Handler Function Pointer}
+   { 1, Scheduler_MessageRouter_GetTaskProfile },
+   { 2, Scheduler_MessageRouter_GetLatencyHistogram },
+   { 3, Scheduler_MessageRouter_ResetProfile },
+   { 4, Scheduler_MessageRouter_GetFastTierStatus },
+   { 5, Scheduler_MessageRouter_GetFastTaskProfile },
+   { 6, Scheduler_MessageRouter_SuspendTask },
+   { 7, Scheduler_MessageRouter_ResumeTask },
+   { 8, Scheduler_MessageRouter_SetTaskInterval },
+   { 9, Scheduler_MessageRouter_GetTaskInfo },
+   { 10, Scheduler_MessageRouter_AddTask },
+   { 11, Scheduler_MessageRouter_RemoveTask },
+   { 12, Scheduler_MessageRouter_GetLoad }
+};
+
+
+const MessageRouter_Data_t schedulerMessageConfig =
+{
+ .numCommands = sizeof(schedulerMessageTable)/sizeof(MessageRouter_CommandTableItem_t),
+ .commandTable = schedulerMessageTable
 };
 
 
@@ -56,6 +151,17 @@ extern const Scheduler_Config_t schedulerConfig =
 // Private Function Implementations
 *******************************************************************************/
 
+// There is no periodic tick interrupt, so the wakeup timer is armed for the
+// next deadline before the CPU idles. Any other interrupt also wakes the CPU.
+static void IdleUntilNextDeadline(const Timebase_Tick_t ticksUntilNextDeadline)
+{
+    if (0U != ticksUntilNextDeadline)
+    {
+        Timebase_RequestWakeup(ticksUntilNextDeadline);
+        Sys_Idle();
+    }
+}
+
 
 /*******************************************************************************
 // Public Function Implementations
@@ -27,9 +27,27 @@ extern "C"
 *******************************************************************************/
 
 // The maximum number of scheduled functions
-// This is used just to allocate memory for software timers used by the scheduler
+// This is used to allocate memory for the deadline queue used by the scheduler
 #define MAX_SCHEDULED_FUNCTIONS (25)
 
+// The maximum number of functions dispatched from the fast tier interrupt
+#define MAX_FAST_SCHEDULED_FUNCTIONS (8)
+
+// The length of one CPU load measurement window
+#define SCHEDULER_LOAD_WINDOW_MILLISECONDS (100)
+
+// The number of completed load windows averaged for the reported load
+#define SCHEDULER_LOAD_HISTORY_WINDOWS (10)
+
+// The longest a frame lasts when the loop never idles. Sheddable items are
+// called again at the start of each frame until its budget is used.
+#define SCHEDULER_MAX_FRAME_MILLISECONDS (10)
+
+// Events that may be posted to the scheduler with Scheduler_PostEvent()
+// A command has been received on a Serial port, or a waiting command has
+// room for its response
+#define SCHEDULER_EVENT_SERIAL_RX (0x0001U)
+
 
 /*******************************************************************************
 // Public Type Declarations
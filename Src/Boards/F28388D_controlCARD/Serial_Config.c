@@ -0,0 +1,91 @@
+/*******************************************************************************
+// Serial Protocol Configuration Data
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Serial.h"
+#include "Serial_Config.h"
+// Platform Includes
+#include "MessageRouter.h"
+#include "UART_Drv.h"
+#include "UART_Drv_Config.h" // UART channel enumeration
+// Other Includes
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The ports served by the serial protocol. Ports take turns in each update,
+// so a busy link cannot hold up the others.
+const Serial_PortConfig_t serialPortConfigData[] =
+{
+   // Debug console - existing terminal tools use ASCII-hex, scripts may switch to binary
+   {
+      .channel = UART_DRV_CHANNEL_DEBUG,
+      .encoding = SERIAL_ENCODING_ASCII_CODED_HEX,
+      .isEncodingNegotiated = true,
+      .isCrcChecked = true,
+      .deviceAddress = 0x01U
+   },
+   // Host PC link - binary only
+   {
+      .channel = UART_DRV_CHANNEL_HOST,
+      .encoding = SERIAL_ENCODING_BINARY,
+      .isEncodingNegotiated = false,
+      .isCrcChecked = true,
+      .deviceAddress = 0x01U
+   },
+   // Peer board link - binary only
+   {
+      .channel = UART_DRV_CHANNEL_PEER,
+      .encoding = SERIAL_ENCODING_BINARY,
+      .isEncodingNegotiated = false,
+      .isCrcChecked = true,
+      .deviceAddress = 0x01U
+   },
+};
+
+// Common configuration structure passed to the module initialization function
+const Serial_Config_t serialConfig =
+{
+   // The number of items in the serialPortConfigData - calculated by compiler
+   .numConfigItems = sizeof(serialPortConfigData) / sizeof(Serial_PortConfig_t),
+   // Port configuration data
+   .portConfigArray = serialPortConfigData
+};
+
+// This table provides a list of commands for this module. The primary purpose
+// is to link each Command ID to its corresponding message handler function
+const MessageRouter_CommandTableItem_t serialMessageTable[] =
+{
+   // {Command ID, Message Handler Function Pointer}
+   { 1, Serial_MessageRouter_GetSerialStatistics },
+};
+
+
+const MessageRouter_Data_t serialMessageConfig =
+{
+ .numCommands = sizeof(serialMessageTable)/sizeof(MessageRouter_CommandTableItem_t),
+ .commandTable = serialMessageTable
+};
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
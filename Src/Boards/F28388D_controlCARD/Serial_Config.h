@@ -0,0 +1,45 @@
+/*******************************************************************************
+// Serial Protocol Configuration Interface
+*******************************************************************************/
+// Prevent multiple inclusion of header file
+#pragma once
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+// Platform Includes
+#include "Timebase_Config.h" // Defines the cycles per millisecond
+// Other Includes
+
+
+/*******************************************************************************
+// Start C Binding Section for C++ Compilers
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The most commands processed by each call of Serial_Update(), across all ports
+#define SERIAL_MAX_COMMANDS_PER_UPDATE (8U)
+
+// No further command is started once Serial_Update() has run this long (250us)
+#define SERIAL_UPDATE_BUDGET_CYCLES (TIMEBASE_NUM_CYCLES_PER_MILLISECOND / 4U)
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// End of C Binding Section
+*******************************************************************************/
+#ifdef __cplusplus
+}
+#endif
@@ -12,6 +12,7 @@
 #include "SysTick_Drv_ConfigTypes.h" // Defines configuration structure
 // Platform Includes
 // Other Includes
+#include <stdlib.h> //NULL
 
 /*******************************************************************************
 // Private Constant Definitions
@@ -28,11 +29,22 @@
 const SysTick_Drv_Channel_Config_t sysTickData[SYSTICK_DRV_CHANNEL_ID_COUNT] = {
 
     {
+     // One-shot timer that wakes the CPU at the next scheduler deadline
      .channelId = SYSTICK_DRV_CHANNEL_ID_TIMER2,
+     .mode = SYSTICK_DRV_CHANNEL_MODE_WAKEUP,
      .timerBase = CPUTIMER2_BASE,
      .peripheral = SYSCTL_PERIPH_CLK_TIMER2,
      .interruptNumber = INT_TIMER2,
      .callback = SysTick_Handler
+    },
+    {
+     // Free-running SYSCLK counter used for the system time and profiling
+     .channelId = SYSTICK_DRV_CHANNEL_ID_TIMER1,
+     .mode = SYSTICK_DRV_CHANNEL_MODE_CYCLE_COUNTER,
+     .timerBase = CPUTIMER1_BASE,
+     .peripheral = SYSCTL_PERIPH_CLK_TIMER1,
+     .interruptNumber = INT_TIMER1,
+     .callback = NULL
     }
 };
 
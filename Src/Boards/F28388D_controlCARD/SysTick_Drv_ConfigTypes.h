@@ -33,8 +33,17 @@ extern "C"
 // Public Type Declarations
 *******************************************************************************/
 
+// Defines how a CPU timer channel is used
+typedef enum {
+    // One-shot interrupt used to wake the CPU from idle
+    SYSTICK_DRV_CHANNEL_MODE_WAKEUP,
+    // Free-running counter of CPU cycles (no interrupt)
+    SYSTICK_DRV_CHANNEL_MODE_CYCLE_COUNTER
+} SysTick_Drv_ChannelMode_t;
+
 typedef struct SysTick_Drv_Channel_Config_s {
     SysTick_Drv_ChannelId_t channelId;
+    SysTick_Drv_ChannelMode_t mode;
     uint32_t timerBase;
     SysCtl_PeripheralPCLOCKCR peripheral;
     uint32_t interruptNumber;
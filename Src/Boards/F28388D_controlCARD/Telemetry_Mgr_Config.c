@@ -0,0 +1,67 @@
+/*******************************************************************************
+// Telemetry Manager Configuration Data
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Telemetry_Mgr.h"
+#include "Telemetry_Mgr_Config.h"
+// Platform Includes
+#include "MessageRouter.h"
+#include "UART_Drv.h"
+// Other Includes
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// Common configuration structure passed to the module initialization function
+const Telemetry_Mgr_Config_t telemetryConfig =
+{
+   // Packets share the host port with the command responses. The debug port
+   // runs at 9600 baud in ASCII, where Serial keeps most of its transmit
+   // buffer for a response and little telemetry would get through.
+   .channel = UART_DRV_CHANNEL_HOST,
+   // Must match the interval of Telemetry_Mgr_Update() in schedulerConfigData
+   .updatePeriodMs = 10U,
+   // Half of the 11520 bytes per second of 115200 baud 8N1, leaving the rest
+   // for the command responses and file transfers on the same port
+   .maxBytesPerSecond = 5760UL
+};
+
+// This table provides a list of commands for this module. The primary purpose
+// is to link each Command ID to its corresponding message handler function
+const MessageRouter_CommandTableItem_t telemetryMessageTable[] =
+{
+   // {Command ID, Message Handler Function Pointer}
+   { 1, Telemetry_Mgr_MessageRouter_Subscribe },
+   { 2, Telemetry_Mgr_MessageRouter_Unsubscribe },
+   { 3, Telemetry_Mgr_MessageRouter_GetStatistics },
+};
+
+
+const MessageRouter_Data_t telemetryMessageConfig =
+{
+ .numCommands = sizeof(telemetryMessageTable)/sizeof(MessageRouter_CommandTableItem_t),
+ .commandTable = telemetryMessageTable
+};
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
@@ -0,0 +1,44 @@
+/*******************************************************************************
+// Telemetry Manager Configuration Interface
+*******************************************************************************/
+// Prevent multiple inclusion of header file
+#pragma once
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+// Platform Includes
+// Other Includes
+
+
+/*******************************************************************************
+// Start C Binding Section for C++ Compilers
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The number of subscriptions that may be active at once
+#define TELEMETRY_MGR_MAX_SUBSCRIPTIONS (8U)
+
+// The most words of command data sent for each sample of a command source
+#define TELEMETRY_MGR_MAX_COMMAND_WORDS (4U)
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// End of C Binding Section
+*******************************************************************************/
+#ifdef __cplusplus
+}
+#endif
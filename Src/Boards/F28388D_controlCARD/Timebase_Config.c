@@ -0,0 +1,50 @@
+/*******************************************************************************
+// Timebase Configuration Data
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Timebase.h"
+#include "Timebase_Config.h" // Defines tick rate
+// Platform Includes
+#include "MessageRouter.h"
+// Other Includes
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// This table provides a list of commands for this module. The primary purpose
+// is to link each Command ID to its corresponding message handler function
+const MessageRouter_CommandTableItem_t timebaseMessageTable[] =
+{
+   // {Command ID, Message Handler Function Pointer}
+   { 0x01, Timebase_MessageRouter_BenchmarkConversions },
+};
+
+
+const MessageRouter_Data_t timebaseMessageConfig =
+{
+ .numCommands = sizeof(timebaseMessageTable)/sizeof(MessageRouter_CommandTableItem_t),
+ .commandTable = timebaseMessageTable
+};
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
@@ -25,7 +25,18 @@ extern "C"
 // Public Constant Definitions
 *******************************************************************************/
 
-#define TIMEBASE_NUM_TICKS_PER_MILLISECOND (SYSTICK_DRV_NUM_TICKS_PER_SECOND/UINT32_C(1000))
+// Configure system to use 1000 ticks per second (each tick = 1ms)
+// Supported rates are 1000, 10000 and 100000 ticks per second. Note that
+// faster rates shorten the longest software timer duration.
+#define TIMEBASE_NUM_TICKS_PER_SECOND (UINT32_C(1000))
+#define TIMEBASE_NUM_TICKS_PER_MILLISECOND (TIMEBASE_NUM_TICKS_PER_SECOND/UINT32_C(1000))
+#define TIMEBASE_NUM_MICROSECONDS_PER_TICK (UINT32_C(1000000)/TIMEBASE_NUM_TICKS_PER_SECOND)
+
+// The cycle counter runs at the system clock frequency
+#define TIMEBASE_NUM_CYCLES_PER_MILLISECOND ((uint32_t)SYS_SYSCLK_FREQ/UINT32_C(1000))
+
+// The number of cycles in one tick
+#define TIMEBASE_NUM_CYCLES_PER_TICK ((uint32_t)SYS_SYSCLK_FREQ/TIMEBASE_NUM_TICKS_PER_SECOND)
 
 
 /*******************************************************************************
@@ -0,0 +1,108 @@
+/*******************************************************************************
+// Bulk Transfer Manager Configuration Data
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Transfer_Mgr.h"
+#include "Transfer_Mgr_Config.h"
+// Platform Includes
+#include "MessageRouter.h"
+#include "UART_Drv.h"
+// Other Includes
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+/*******************************************************************************
+// External Variable Declarations
+*******************************************************************************/
+
+// Range boundaries from the linker command file
+extern uint16_t IntegrityAppImageStart;
+extern uint16_t IntegrityAppImageEnd;
+extern uint16_t TransferBufferStart;
+extern uint16_t TransferBufferEnd;
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The endpoints that may be opened by the host
+static const Transfer_Mgr_EndpointConfig_t transferEndpointConfigData[] =
+{
+   // { Endpoint ID, Read Function, Write Function, Check Function }
+   { TRANSFER_MGR_ENDPOINT_MEMORY, Transfer_Mgr_ReadMemory, Transfer_Mgr_WriteMemory, Transfer_Mgr_CheckMemory },
+};
+
+// The only memory the host may reach through the memory endpoint
+static const Transfer_Mgr_MemoryRange_t transferMemoryRangeData[] =
+{
+   // The exchange buffer in RAM set aside for bulk data
+   {
+      .startAddress = &TransferBufferStart,
+      .endAddress = &TransferBufferEnd,
+      .isWritable = true
+   },
+   // The application image, so it can be read back and compared
+   {
+      .startAddress = &IntegrityAppImageStart,
+      .endAddress = &IntegrityAppImageEnd,
+      .isWritable = false
+   },
+};
+
+// Common configuration structure passed to the module initialization function
+const Transfer_Mgr_Config_t transferConfig =
+{
+   // Bulk data is kept off the debug port so commands there are not delayed
+   .channel = UART_DRV_CHANNEL_HOST,
+   // A full window at 115200 baud takes about 80ms to send
+   .retransmitTimeoutMs = 250U,
+   // The 256 byte receive buffer of the host port holds four binary segment
+   // frames of about 55 bytes
+   .writeWindowSize = 4U,
+   // The number of items in transferEndpointConfigData - calculated by compiler
+   .numConfigItems = sizeof(transferEndpointConfigData)/sizeof(Transfer_Mgr_EndpointConfig_t),
+   .endpointConfigArray = transferEndpointConfigData,
+   // The number of items in transferMemoryRangeData - calculated by compiler
+   .numMemoryRanges = sizeof(transferMemoryRangeData)/sizeof(Transfer_Mgr_MemoryRange_t),
+   .memoryRangeArray = transferMemoryRangeData
+};
+
+// This table provides a list of commands for this module. The primary purpose
+// is to link each Command ID to its corresponding message handler function
+const MessageRouter_CommandTableItem_t transferMessageTable[] =
+{
+   // {Command ID, Message Handler Function Pointer}
+   { 1, Transfer_Mgr_MessageRouter_OpenRead },
+   { 2, Transfer_Mgr_MessageRouter_OpenWrite },
+   { 3, Transfer_Mgr_MessageRouter_WriteSegment },
+   { 4, Transfer_Mgr_MessageRouter_AcknowledgeRead },
+   { 5, Transfer_Mgr_MessageRouter_GetStatus },
+   { 6, Transfer_Mgr_MessageRouter_Abort },
+};
+
+
+const MessageRouter_Data_t transferMessageConfig =
+{
+ .numCommands = sizeof(transferMessageTable)/sizeof(MessageRouter_CommandTableItem_t),
+ .commandTable = transferMessageTable
+};
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
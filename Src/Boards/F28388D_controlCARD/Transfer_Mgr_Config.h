@@ -0,0 +1,47 @@
+/*******************************************************************************
+// Bulk Transfer Manager Configuration Interface
+*******************************************************************************/
+// Prevent multiple inclusion of header file
+#pragma once
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+// Platform Includes
+// Other Includes
+
+
+/*******************************************************************************
+// Start C Binding Section for C++ Compilers
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+// The sources and destinations of transfers
+typedef enum
+{
+   // Memory within the ranges of the configuration, the address is that of
+   // the first 16-bit word
+   TRANSFER_MGR_ENDPOINT_MEMORY,
+   TRANSFER_MGR_ENDPOINT_COUNT
+} Transfer_Mgr_EndpointId_t;
+
+
+/*******************************************************************************
+// End of C Binding Section
+*******************************************************************************/
+#ifdef __cplusplus
+}
+#endif
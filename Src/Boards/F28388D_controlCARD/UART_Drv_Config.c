@@ -11,6 +11,7 @@
 #include "UART_Drv_Config.h" // Defines configuration structure
 #include "UART_Drv_ConfigTypes.h" // Defines configuration structure
 // Platform Includes
+#include "Scheduler.h" // Serial receive event
 // Other Includes
 #include "sysctl.h" // Peripheral clocks
 
@@ -18,6 +19,17 @@
 // Private Constant Definitions
 *******************************************************************************/
 
+// Ring buffer sizes of each channel. Each must be a power of two.
+// The debug console must hold a whole ASCII-hex command and response.
+#define DEBUG_RX_BUFFER_SIZE (128U)
+#define DEBUG_TX_BUFFER_SIZE (128U)
+// The host link is the fastest and pipelines several binary commands.
+#define HOST_RX_BUFFER_SIZE (256U)
+#define HOST_TX_BUFFER_SIZE (256U)
+// The peer link carries one binary frame of at most 57 bytes at a time.
+#define PEER_RX_BUFFER_SIZE (64U)
+#define PEER_TX_BUFFER_SIZE (64U)
+
 /*******************************************************************************
 // Private Type Declarations
 *******************************************************************************/
@@ -25,9 +37,27 @@
 // Enumeration of the UART channels configured in the system
 
 
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+// Called when a complete command has been received on a serial channel, or
+// when there is room for the response of a command that was waiting
+static void PostSerialRxEvent(void);
+
+
 /*******************************************************************************
 // Private Variable Definitions
 *******************************************************************************/
+
+// Ring buffer storage for each channel
+static uint16_t debugRxBuffer[DEBUG_RX_BUFFER_SIZE];
+static uint16_t debugTxBuffer[DEBUG_TX_BUFFER_SIZE];
+static uint16_t hostRxBuffer[HOST_RX_BUFFER_SIZE];
+static uint16_t hostTxBuffer[HOST_TX_BUFFER_SIZE];
+static uint16_t peerRxBuffer[PEER_RX_BUFFER_SIZE];
+static uint16_t peerTxBuffer[PEER_TX_BUFFER_SIZE];
+
 const UART_Drv_Data_t uartData[UART_DRV_CHANNEL_COUNT] =
 {
  // --- SCIA - 28/29 - Debug/FTDI - 96000
@@ -52,6 +82,61 @@ const UART_Drv_Data_t uartData[UART_DRV_CHANNEL_COUNT] =
         // TODO - configure based on uartBase
         .peripheral = SYSCTL_PERIPH_CLK_SCIA,
          // IRQ not used currently
+        // Wake the serial protocol as soon as a command terminator is received.
+        // ASCII commands end with '\r', and binary frames with a zero byte
+        // once the host negotiates the binary encoding.
+        .rxDelimiter = '\r',
+        .rxAltDelimiter = 0x00U,
+        .rxDelimiterCallback = PostSerialRxEvent,
+        // Wake it again once a waiting command has room for its response
+        .txSpaceCallback = PostSerialRxEvent,
+        // Buffers sized for ASCII-hex commands
+        .rxBuffer = debugRxBuffer,
+        .rxBufferSize = DEBUG_RX_BUFFER_SIZE,
+        .txBuffer = debugTxBuffer,
+        .txBufferSize = DEBUG_TX_BUFFER_SIZE,
+     },
+ // --- SCIB - 18/19 - Host PC link - 115200
+ // GPIO_18_SCIB_TX and GPIO_19_SCIB_RX are set with the other board pins
+     {
+        .channelId = UART_DRV_CHANNEL_HOST,
+        // Polled every 1ms, about 12 characters arrive per poll which the
+        // 16 character FIFO can hold
+        .baudRate = 115200UL,
+        .bitLength = 8U,
+        .stopBits = 1U,
+        .parity = UART_DRV_PARITY_NONE,
+        .uartBase = SCIB_BASE,
+        .peripheral = SYSCTL_PERIPH_CLK_SCIB,
+        // Binary frames end with a zero byte
+        .rxDelimiter = 0x00U,
+        .rxAltDelimiter = 0x00U,
+        .rxDelimiterCallback = PostSerialRxEvent,
+        .txSpaceCallback = PostSerialRxEvent,
+        .rxBuffer = hostRxBuffer,
+        .rxBufferSize = HOST_RX_BUFFER_SIZE,
+        .txBuffer = hostTxBuffer,
+        .txBufferSize = HOST_TX_BUFFER_SIZE,
+     },
+ // --- SCIC - 38/39 - Peer board link - 115200
+ // GPIO_38_SCIC_TX and GPIO_39_SCIC_RX are set with the other board pins
+     {
+        .channelId = UART_DRV_CHANNEL_PEER,
+        .baudRate = 115200UL,
+        .bitLength = 8U,
+        .stopBits = 1U,
+        .parity = UART_DRV_PARITY_NONE,
+        .uartBase = SCIC_BASE,
+        .peripheral = SYSCTL_PERIPH_CLK_SCIC,
+        // Binary frames end with a zero byte
+        .rxDelimiter = 0x00U,
+        .rxAltDelimiter = 0x00U,
+        .rxDelimiterCallback = PostSerialRxEvent,
+        .txSpaceCallback = PostSerialRxEvent,
+        .rxBuffer = peerRxBuffer,
+        .rxBufferSize = PEER_RX_BUFFER_SIZE,
+        .txBuffer = peerTxBuffer,
+        .txBufferSize = PEER_TX_BUFFER_SIZE,
      },
 };
 
@@ -69,6 +154,12 @@ extern const UART_Drv_Config_t uartConfig =
 // Private Function Implementations
 *******************************************************************************/
 
+// Schedule Serial_Update for the next pass of the scheduler
+static void PostSerialRxEvent(void)
+{
+    Scheduler_PostEvent(SCHEDULER_EVENT_SERIAL_RX);
+}
+
 
 /*******************************************************************************
 // Public Function Implementations
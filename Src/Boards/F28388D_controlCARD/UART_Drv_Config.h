@@ -37,6 +37,10 @@ typedef enum
 {
     // The channel used for debug communication
     UART_DRV_CHANNEL_DEBUG,
+    // The channel used by the host PC tools
+    UART_DRV_CHANNEL_HOST,
+    // The channel linking to the peer board
+    UART_DRV_CHANNEL_PEER,
    // Defines the number of enumerated UART channels configured for the system
    UART_DRV_CHANNEL_COUNT
 } UART_Drv_Channel_t;
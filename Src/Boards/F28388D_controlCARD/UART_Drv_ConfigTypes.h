@@ -83,6 +83,25 @@ typedef struct UART_Drv_Data_s {
       // Interrupt Handler for RX
       // TODO - configure based on uartBase
       UART_Drv_InterruptConfig_t rxIRQConfig;
+      // Character that marks the end of a received frame (Ex. '\r')
+      uint16_t rxDelimiter;
+      // A second character that also marks the end of a frame, for a port
+      // whose encoding can change (Ex. 0x00). Set to rxDelimiter if unused.
+      uint16_t rxAltDelimiter;
+      // Called from UART_Drv_Update() when the delimiter has been moved into the
+      // receive buffer so the consumer can be woken (NULL if unused)
+      void (*rxDelimiterCallback)(void);
+      // Called from UART_Drv_Update() once the free space asked for with
+      // UART_Drv_RequestTxSpace() is available (NULL if unused)
+      void (*txSpaceCallback)(void);
+      // Storage for the receive ring buffer, sized for the link
+      // The size must be a power of two (Ex. 64, 128, 256)
+      uint16_t *rxBuffer;
+      uint16_t rxBufferSize;
+      // Storage for the transmit ring buffer, sized for the largest burst of
+      // responses queued at once. The size must be a power of two.
+      uint16_t *txBuffer;
+      uint16_t txBufferSize;
 } UART_Drv_Data_t;
 
 
@@ -8,14 +8,34 @@
 
 // Module Includes
 #include "CRCLib.h"
+#include "CRCLib_Config.h" // Selects the backend
+#include "CRCLib_Device.h"
+#include "CRCLib_Tables.h" // Generated tables used by the descriptors
 // Platform Includes
+#include "MessageRouter.h"
+#include "Timebase.h" // Cycle counter used by the benchmark
 // Other Includes
+#include <stdbool.h> // Defines C99 boolean type
+#include <stddef.h> // Defines NULL
 #include <stdint.h>
 
 /*******************************************************************************
 // Private Constant Definitions
 *******************************************************************************/
 
+// Use the device backend only where the CRC hardware exists
+#if (CRCLIB_BACKEND == CRCLIB_BACKEND_DEVICE) && defined(__TMS320C28XX__)
+#define USE_DEVICE_BACKEND (1)
+#else
+#define USE_DEVICE_BACKEND (0)
+#endif
+
+// The number of bytes checked by the benchmark command
+#define BENCHMARK_DATA_LENGTH (256U)
+
+// Step between the words of the benchmark data
+#define BENCHMARK_DATA_STEP (0x9E37U)
+
 /*******************************************************************************
 // Private Type Declarations
 *******************************************************************************/
@@ -24,10 +44,7 @@
 // Private Variable Definitions
 *******************************************************************************/
 
-/*******************************************************************************
-// Private Function Declarations
-*******************************************************************************/
-
+// CRC of each value of the high byte of the CRC combined with the next byte
 static const uint16_t crc16Table[256] = {
    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U, 0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU,
    0xD1ADU, 0xE1CEU, 0xF1EFU, 0x1231U, 0x0210U, 0x3273U, 0x2252U, 0x52B5U, 0x4294U, 0x72F7U, 0x62D6U, 0x9339U, 0x8318U,
@@ -50,16 +67,158 @@ static const uint16_t crc16Table[256] = {
    0x5C64U, 0x4C45U, 0x3CA2U, 0x2C83U, 0x1CE0U, 0x0CC1U, 0xEF1FU, 0xFF3EU, 0xCF5DU, 0xDF7CU, 0xAF9BU, 0xBFBAU, 0x8FD9U,
    0x9FF8U, 0x6E17U, 0x7E36U, 0x4E55U, 0x5E74U, 0x2E93U, 0x3EB2U, 0x0ED1U, 0x1EF0U};
 
-uint16_t CRCLib_Calculate(const uint16_t crcSeed, const uint16_t *data, const uint16_t dataLength)
+
+// CRC of each value of the high byte of the CRC combined with the next word,
+// carried through both bytes of the word. Each entry is
+// (crc16Table[i] << 8) ^ crc16Table[crc16Table[i] >> 8], so that for
+// x = crc ^ word the CRC after the whole word is
+// crc16WordTable[x >> 8] ^ crc16Table[x & 0xFF].
+static const uint16_t crc16WordTable[256] = {
+   0x0000U, 0x3331U, 0x6662U, 0x5553U, 0xCCC4U, 0xFFF5U, 0xAAA6U, 0x9997U, 0x89A9U, 0xBA98U, 0xEFCBU, 0xDCFAU, 0x456DU,
+   0x765CU, 0x230FU, 0x103EU, 0x0373U, 0x3042U, 0x6511U, 0x5620U, 0xCFB7U, 0xFC86U, 0xA9D5U, 0x9AE4U, 0x8ADAU, 0xB9EBU,
+   0xECB8U, 0xDF89U, 0x461EU, 0x752FU, 0x207CU, 0x134DU, 0x06E6U, 0x35D7U, 0x6084U, 0x53B5U, 0xCA22U, 0xF913U, 0xAC40U,
+   0x9F71U, 0x8F4FU, 0xBC7EU, 0xE92DU, 0xDA1CU, 0x438BU, 0x70BAU, 0x25E9U, 0x16D8U, 0x0595U, 0x36A4U, 0x63F7U, 0x50C6U,
+   0xC951U, 0xFA60U, 0xAF33U, 0x9C02U, 0x8C3CU, 0xBF0DU, 0xEA5EU, 0xD96FU, 0x40F8U, 0x73C9U, 0x269AU, 0x15ABU, 0x0DCCU,
+   0x3EFDU, 0x6BAEU, 0x589FU, 0xC108U, 0xF239U, 0xA76AU, 0x945BU, 0x8465U, 0xB754U, 0xE207U, 0xD136U, 0x48A1U, 0x7B90U,
+   0x2EC3U, 0x1DF2U, 0x0EBFU, 0x3D8EU, 0x68DDU, 0x5BECU, 0xC27BU, 0xF14AU, 0xA419U, 0x9728U, 0x8716U, 0xB427U, 0xE174U,
+   0xD245U, 0x4BD2U, 0x78E3U, 0x2DB0U, 0x1E81U, 0x0B2AU, 0x381BU, 0x6D48U, 0x5E79U, 0xC7EEU, 0xF4DFU, 0xA18CU, 0x92BDU,
+   0x8283U, 0xB1B2U, 0xE4E1U, 0xD7D0U, 0x4E47U, 0x7D76U, 0x2825U, 0x1B14U, 0x0859U, 0x3B68U, 0x6E3BU, 0x5D0AU, 0xC49DU,
+   0xF7ACU, 0xA2FFU, 0x91CEU, 0x81F0U, 0xB2C1U, 0xE792U, 0xD4A3U, 0x4D34U, 0x7E05U, 0x2B56U, 0x1867U, 0x1B98U, 0x28A9U,
+   0x7DFAU, 0x4ECBU, 0xD75CU, 0xE46DU, 0xB13EU, 0x820FU, 0x9231U, 0xA100U, 0xF453U, 0xC762U, 0x5EF5U, 0x6DC4U, 0x3897U,
+   0x0BA6U, 0x18EBU, 0x2BDAU, 0x7E89U, 0x4DB8U, 0xD42FU, 0xE71EU, 0xB24DU, 0x817CU, 0x9142U, 0xA273U, 0xF720U, 0xC411U,
+   0x5D86U, 0x6EB7U, 0x3BE4U, 0x08D5U, 0x1D7EU, 0x2E4FU, 0x7B1CU, 0x482DU, 0xD1BAU, 0xE28BU, 0xB7D8U, 0x84E9U, 0x94D7U,
+   0xA7E6U, 0xF2B5U, 0xC184U, 0x5813U, 0x6B22U, 0x3E71U, 0x0D40U, 0x1E0DU, 0x2D3CU, 0x786FU, 0x4B5EU, 0xD2C9U, 0xE1F8U,
+   0xB4ABU, 0x879AU, 0x97A4U, 0xA495U, 0xF1C6U, 0xC2F7U, 0x5B60U, 0x6851U, 0x3D02U, 0x0E33U, 0x1654U, 0x2565U, 0x7036U,
+   0x4307U, 0xDA90U, 0xE9A1U, 0xBCF2U, 0x8FC3U, 0x9FFDU, 0xACCCU, 0xF99FU, 0xCAAEU, 0x5339U, 0x6008U, 0x355BU, 0x066AU,
+   0x1527U, 0x2616U, 0x7345U, 0x4074U, 0xD9E3U, 0xEAD2U, 0xBF81U, 0x8CB0U, 0x9C8EU, 0xAFBFU, 0xFAECU, 0xC9DDU, 0x504AU,
+   0x637BU, 0x3628U, 0x0519U, 0x10B2U, 0x2383U, 0x76D0U, 0x45E1U, 0xDC76U, 0xEF47U, 0xBA14U, 0x8925U, 0x991BU, 0xAA2AU,
+   0xFF79U, 0xCC48U, 0x55DFU, 0x66EEU, 0x33BDU, 0x008CU, 0x13C1U, 0x20F0U, 0x75A3U, 0x4692U, 0xDF05U, 0xEC34U, 0xB967U,
+   0x8A56U, 0x9A68U, 0xA959U, 0xFC0AU, 0xCF3BU, 0x56ACU, 0x659DU, 0x30CEU, 0x03FFU};
+
+// Data checked by the benchmark command
+static uint16_t benchmarkData[BENCHMARK_DATA_LENGTH / 2U];
+
+/*******************************************************************************
+// Public Variable Definitions
+*******************************************************************************/
+
+const CRCLib_Descriptor_t crcLibCrc8 = {
+   .width = 8U,
+   .isReflected = false,
+   .isTablePacked = (0 != CRCLIB_PACK_8BIT_TABLES),
+   .initialValue = 0x00UL,
+   .finalXor = 0x00UL,
+   .table = crcLibTableCrc8};
+
+const CRCLib_Descriptor_t crcLibCrc16Ccitt = {
+   .width = 16U,
+   .isReflected = false,
+   .isTablePacked = false,
+   .initialValue = 0xFFFFUL,
+   .finalXor = 0x0000UL,
+   .table = crc16Table};
+
+const CRCLib_Descriptor_t crcLibCrc16Modbus = {
+   .width = 16U,
+   .isReflected = true,
+   .isTablePacked = false,
+   .initialValue = 0xFFFFUL,
+   .finalXor = 0x0000UL,
+   .table = crcLibTableCrc16Modbus};
+
+const CRCLib_Descriptor_t crcLibCrc32 = {
+   .width = 32U,
+   .isReflected = true,
+   .isTablePacked = false,
+   .initialValue = 0xFFFFFFFFUL,
+   .finalXor = 0xFFFFFFFFUL,
+   .table = crcLibTableCrc32};
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+ *    The original byte at a time calculation, kept as the reference for the
+ *    benchmark command. Gives the same result as CRCLib_Calculate().
+ */
+static uint16_t CalculateBytewise(const uint16_t crcSeed, const uint16_t *data, const uint16_t dataLength);
+
+/** Description:
+ *    Calculates the CRC with the software tables, a word at a time. See
+ *    CRCLib_Calculate().
+ */
+static uint16_t CalculateSoftware(const uint16_t crcSeed, const uint16_t *data, const uint16_t dataLength);
+
+/** Description:
+ *    Returns a mask of the low width bits.
+ */
+static uint32_t GetWidthMask(const uint16_t width);
+
+/** Description:
+ *    Adds one byte to a described CRC with its table.
+ */
+static uint32_t ComputeByte(const CRCLib_Descriptor_t *const descriptor, const uint32_t crc, const uint16_t byte);
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+static uint32_t GetWidthMask(const uint16_t width)
+{
+   return (0xFFFFFFFFUL >> (32U - width));
+}
+
+static uint32_t ComputeByte(const CRCLib_Descriptor_t *const descriptor, const uint32_t crc, const uint16_t byte)
+{
+   uint16_t index;
+   uint32_t entry;
+   uint32_t calculatedCRC;
+
+   // A reflected CRC shifts toward the least significant bit
+   if (descriptor->isReflected)
+   {
+      index = (uint16_t)(crc ^ byte) & 0xFFU;
+   }
+   else
+   {
+      index = (uint16_t)((crc >> (descriptor->width - 8U)) ^ byte) & 0xFFU;
+   }
+
+   if (32U == descriptor->width)
+   {
+      entry = ((const uint32_t *)descriptor->table)[index];
+   }
+   else if (descriptor->isTablePacked)
+   {
+      const uint16_t packedEntries = ((const uint16_t *)descriptor->table)[index >> 1U];
+
+      entry = (0U == (index & 1U)) ? (packedEntries & 0xFFU) : (packedEntries >> 8U);
+   }
+   else
+   {
+      entry = ((const uint16_t *)descriptor->table)[index];
+   }
+
+   if (descriptor->isReflected)
+   {
+      calculatedCRC = (crc >> 8U) ^ entry;
+   }
+   else
+   {
+      calculatedCRC = ((crc << 8U) ^ entry) & GetWidthMask(descriptor->width);
+   }
+
+   return (calculatedCRC);
+}
+
+static uint16_t CalculateBytewise(const uint16_t crcSeed, const uint16_t *data, const uint16_t dataLength)
 {
-   const uint16_t *pCurrentByte = data;
    uint16_t calculatedCRC      = crcSeed;
 
-   //for (uint16_t i = dataLength; i != 0; --i, ++pCurrentByte)
    for (uint16_t i = 0; i < dataLength; i++)
    {
-      //calculatedCRC = crc16Table[((uint16_t)(calculatedCRC >> 8U)) ^ *pCurrentByte] ^ ((uint16_t)(calculatedCRC << 8U));
-       // TODO - Even i+1, Odd i-1
+       // Even i+1, Odd i-1
        if (i % 2 ==0)
        {
            calculatedCRC = crc16Table[((uint16_t)(calculatedCRC >> 8U)) ^ __byte((int *)data, i + 1)] ^ ((uint16_t)(calculatedCRC << 8U));
@@ -73,3 +232,216 @@ uint16_t CRCLib_Calculate(const uint16_t crcSeed, const uint16_t *data, const ui
 
    return (calculatedCRC);
 }
+
+static uint16_t CalculateSoftware(const uint16_t crcSeed, const uint16_t *data, const uint16_t dataLength)
+{
+   const uint16_t *pCurrentWord = data;
+   uint16_t calculatedCRC      = crcSeed;
+
+   // Both bytes of a word are processed in one step, high byte first
+   for (uint16_t i = dataLength / 2U; i != 0U; --i, ++pCurrentWord)
+   {
+      const uint16_t index = calculatedCRC ^ *pCurrentWord;
+
+      calculatedCRC = crc16WordTable[(uint16_t)(index >> 8U) & 0xFFU] ^ crc16Table[index & 0xFFU];
+   }
+
+   // An odd length ends with the high byte of the next word
+   if (0U != (dataLength & 1U))
+   {
+      calculatedCRC = crc16Table[((uint16_t)(calculatedCRC >> 8U) ^ (uint16_t)(*pCurrentWord >> 8U)) & 0xFFU] ^ ((uint16_t)(calculatedCRC << 8U));
+   }
+
+   return (calculatedCRC);
+}
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+uint16_t CRCLib_Calculate(const uint16_t crcSeed, const uint16_t *data, const uint16_t dataLength)
+{
+#if USE_DEVICE_BACKEND
+   uint16_t calculatedCRC;
+
+   if (dataLength >= CRCLIB_DEVICE_MIN_LENGTH)
+   {
+      // The hardware handles the whole words, and software the odd byte
+      calculatedCRC = CRCLib_Device_CalculateWords(crcSeed, data, dataLength / 2U);
+      calculatedCRC = CalculateSoftware(calculatedCRC, data + (dataLength / 2U), dataLength & 1U);
+   }
+   else
+   {
+      calculatedCRC = CalculateSoftware(crcSeed, data, dataLength);
+   }
+
+   return (calculatedCRC);
+#else
+   return (CalculateSoftware(crcSeed, data, dataLength));
+#endif
+}
+
+void CRCLib_Begin(CRCLib_Context_t *const context, const uint16_t crcSeed)
+{
+   if (NULL != context)
+   {
+      context->crc = crcSeed;
+   }
+}
+
+void CRCLib_Update(CRCLib_Context_t *const context, const uint16_t *data, const uint16_t dataLength)
+{
+   if (NULL != context)
+   {
+      context->crc = CRCLib_Calculate(context->crc, data, dataLength);
+   }
+}
+
+void CRCLib_UpdateByte(CRCLib_Context_t *const context, const uint16_t byte)
+{
+   if (NULL != context)
+   {
+      context->crc = crc16Table[((uint16_t)(context->crc >> 8U) ^ byte) & 0xFFU] ^ ((uint16_t)(context->crc << 8U));
+   }
+}
+
+uint16_t CRCLib_Finish(const CRCLib_Context_t *const context)
+{
+   return ((NULL != context) ? context->crc : 0U);
+}
+
+uint32_t CRCLib_Compute(const CRCLib_Descriptor_t *const descriptor, const uint16_t *data, const uint16_t dataLength)
+{
+   CRCLib_ComputeContext_t context;
+
+   CRCLib_ComputeBegin(&context, descriptor);
+   CRCLib_ComputeUpdate(&context, data, dataLength);
+
+   return (CRCLib_ComputeFinish(&context));
+}
+
+void CRCLib_ComputeBegin(CRCLib_ComputeContext_t *const context, const CRCLib_Descriptor_t *const descriptor)
+{
+   if (NULL != context)
+   {
+      context->descriptor = descriptor;
+      context->crc = (NULL != descriptor) ? descriptor->initialValue : 0UL;
+   }
+}
+
+void CRCLib_ComputeUpdate(CRCLib_ComputeContext_t *const context, const uint16_t *data, const uint16_t dataLength)
+{
+   if ((NULL != context) && (NULL != context->descriptor))
+   {
+      uint32_t calculatedCRC = context->crc;
+
+      for (uint16_t i = 0U; i < dataLength; i++)
+      {
+         // High byte of each word first
+         const uint16_t byte = (0U == (i & 1U)) ? (uint16_t)(data[i >> 1U] >> 8U) : (uint16_t)(data[i >> 1U] & 0xFFU);
+
+         calculatedCRC = ComputeByte(context->descriptor, calculatedCRC, byte);
+      }
+
+      context->crc = calculatedCRC;
+   }
+}
+
+void CRCLib_ComputeUpdateByte(CRCLib_ComputeContext_t *const context, const uint16_t byte)
+{
+   if ((NULL != context) && (NULL != context->descriptor))
+   {
+      context->crc = ComputeByte(context->descriptor, context->crc, byte & 0xFFU);
+   }
+}
+
+uint32_t CRCLib_ComputeFinish(const CRCLib_ComputeContext_t *const context)
+{
+   uint32_t calculatedCRC = 0UL;
+
+   if ((NULL != context) && (NULL != context->descriptor))
+   {
+      calculatedCRC = (context->crc ^ context->descriptor->finalXor) & GetWidthMask(context->descriptor->width);
+   }
+
+   return (calculatedCRC);
+}
+
+// Compare the word and byte at a time calculations
+void CRCLib_MessageRouter_Benchmark(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // The number of bytes checked by each method
+      uint32_t numBytes;
+      // Cycles taken by CRCLib_Calculate() with the selected backend
+      uint32_t calculateCycles;
+      // Cycles taken by the software tables, a word at a time
+      uint32_t wordCycles;
+      // Cycles taken by the byte at a time method
+      uint32_t byteCycles;
+      // 1 if all methods gave the same CRC for every length, 0 otherwise
+      uint16_t isMatch;
+      // Padding for alignment
+      uint16_t dummy;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      Timebase_CycleCount_t startCycles;
+      uint16_t calculatedCRC;
+      uint16_t wordCRC;
+      uint16_t byteCRC;
+      bool isMatch = true;
+
+      for (uint16_t i = 0U; i < (BENCHMARK_DATA_LENGTH / 2U); i++)
+      {
+         benchmarkData[i] = (uint16_t)(i * BENCHMARK_DATA_STEP);
+      }
+
+      startCycles = Timebase_GetCycleCount();
+      calculatedCRC = CRCLib_Calculate(0xFFFFU, benchmarkData, BENCHMARK_DATA_LENGTH);
+      response->calculateCycles = Timebase_GetCycleCount() - startCycles;
+
+      startCycles = Timebase_GetCycleCount();
+      wordCRC = CalculateSoftware(0xFFFFU, benchmarkData, BENCHMARK_DATA_LENGTH);
+      response->wordCycles = Timebase_GetCycleCount() - startCycles;
+
+      startCycles = Timebase_GetCycleCount();
+      byteCRC = CalculateBytewise(0xFFFFU, benchmarkData, BENCHMARK_DATA_LENGTH);
+      response->byteCycles = Timebase_GetCycleCount() - startCycles;
+
+      // Check every length, including the odd ones
+      for (uint16_t length = 0U; length < BENCHMARK_DATA_LENGTH; length++)
+      {
+         const uint16_t expectedCRC = CalculateBytewise(0xFFFFU, benchmarkData, length);
+
+         isMatch = isMatch && (CRCLib_Calculate(0xFFFFU, benchmarkData, length) == expectedCRC) &&
+                   (CalculateSoftware(0xFFFFU, benchmarkData, length) == expectedCRC);
+      }
+
+      response->numBytes = BENCHMARK_DATA_LENGTH;
+      response->isMatch = (isMatch && (calculatedCRC == byteCRC) && (wordCRC == byteCRC)) ? 1U : 0U;
+      response->dummy = 0U;
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
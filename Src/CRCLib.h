@@ -14,23 +14,197 @@ extern "C"
 
 // Module Includes
 // Platform Includes
+#include "MessageRouter.h"
 // Other Includes
+#include <stdbool.h>
 #include <stdint.h>
 
 /*******************************************************************************
 // Public Constant Definitions
 *******************************************************************************/
 
+// Backends that may be selected with CRCLIB_BACKEND in CRCLib_Config.h
+// Tables in CRCLib.c
+#define CRCLIB_BACKEND_SOFTWARE (0U)
+// CRC hardware of the target device, see CRCLib_Device.h
+#define CRCLIB_BACKEND_DEVICE (1U)
+
 /*******************************************************************************
 // Public Type Declarations
 *******************************************************************************/
 
+// Holds a CRC calculation that is made in several steps, for example as
+// data arrives
+typedef struct
+{
+   // The CRC of the data seen so far
+   uint16_t crc;
+} CRCLib_Context_t;
+
+// Describes a table driven CRC of 8, 16 or 32 bits for CRCLib_Compute().
+// The tables are generated by Tools/CRCLib_TableGen.c.
+typedef struct
+{
+   // The width of the CRC in bits: 8, 16 or 32
+   uint16_t width;
+   // Set if each byte is processed least significant bit first. The table is
+   // then built from the reflected polynomial and the result is reflected.
+   bool isReflected;
+   // Set if the table holds two 8-bit entries per word, the even index in
+   // the low byte. Only used for a width of 8.
+   bool isTablePacked;
+   // The value the CRC starts from
+   uint32_t initialValue;
+   // The value combined with the CRC by exclusive or to give the result
+   uint32_t finalXor;
+   // 256 entries of uint16_t for widths of 8 and 16 or uint32_t for 32
+   const void *table;
+} CRCLib_Descriptor_t;
+
+// Holds a CRC calculation of any described CRC that is made in several steps
+typedef struct
+{
+   // The CRC being calculated
+   const CRCLib_Descriptor_t *descriptor;
+   // The CRC of the data seen so far, before the final exclusive or
+   uint32_t crc;
+} CRCLib_ComputeContext_t;
+
+/*******************************************************************************
+// Public Variable Declarations
+*******************************************************************************/
+
+// CRC-8/SMBUS (polynomial 0x07), used by sensor links
+extern const CRCLib_Descriptor_t crcLibCrc8;
+// CRC-16/CCITT-FALSE, the same as CRCLib_Calculate() with a seed of 0xFFFF
+extern const CRCLib_Descriptor_t crcLibCrc16Ccitt;
+// CRC-16/MODBUS, used by field devices
+extern const CRCLib_Descriptor_t crcLibCrc16Modbus;
+// CRC-32 as used by zlib and Ethernet, used for image verification
+extern const CRCLib_Descriptor_t crcLibCrc32;
+
 /*******************************************************************************
 // Public Function Declarations
 *******************************************************************************/
 
+/** Description:
+ *    Calculates the CRC16-CCITT (polynomial 0x1021, no reflection) of the
+ *    given data. Each 16-bit word holds two bytes and the high byte is
+ *    processed first. If the length is odd, only the high byte of the last
+ *    word is processed. Data of at least CRCLIB_DEVICE_MIN_LENGTH bytes is
+ *    passed to the device backend when one is selected. The result is the
+ *    same with either backend.
+ * Parameters:
+ *    crcSeed - The starting CRC, or the result of a previous calculation to
+ *       continue from
+ *    data - The data to be checked
+ *    dataLength - The number of bytes to be checked
+ * Returns:
+ *    uint16_t - The calculated CRC
+ */
 uint16_t CRCLib_Calculate(const uint16_t crcSeed, const uint16_t *data, const uint16_t dataLength);
 
+/** Description:
+ *    Starts a CRC calculation made in several steps.
+ * Parameters:
+ *    context - The calculation to be started
+ *    crcSeed - The starting CRC
+ */
+void CRCLib_Begin(CRCLib_Context_t *const context, const uint16_t crcSeed);
+
+/** Description:
+ *    Adds data to a CRC calculation. The result is the same as passing the
+ *    current CRC as the seed of CRCLib_Calculate(), including the handling
+ *    of an odd length.
+ * Parameters:
+ *    context - The calculation to be continued
+ *    data - The data to be added
+ *    dataLength - The number of bytes to be added
+ */
+void CRCLib_Update(CRCLib_Context_t *const context, const uint16_t *data, const uint16_t dataLength);
+
+/** Description:
+ *    Adds a single byte to a CRC calculation, for data that arrives one
+ *    byte at a time. Note that the byte is taken from the low 8 bits, unlike
+ *    CRCLib_Update() with a length of 1, which uses the high byte of the word.
+ * Parameters:
+ *    context - The calculation to be continued
+ *    byte - The byte to be added, in the low 8 bits
+ */
+void CRCLib_UpdateByte(CRCLib_Context_t *const context, const uint16_t byte);
+
+/** Description:
+ *    Returns the CRC of all data added to a calculation. The calculation
+ *    may still be continued afterwards.
+ * Parameters:
+ *    context - The calculation
+ * Returns:
+ *    uint16_t - The calculated CRC
+ */
+uint16_t CRCLib_Finish(const CRCLib_Context_t *const context);
+
+/** Description:
+ *    Calculates a described CRC of the given data, including the initial
+ *    value and final exclusive or. The data is packed as for
+ *    CRCLib_Calculate(): two bytes per 16-bit word, high byte first.
+ *    CRCLib_Calculate() remains the faster choice for CRC16-CCITT.
+ * Parameters:
+ *    descriptor - The CRC to be calculated, for example &crcLibCrc32
+ *    data - The data to be checked
+ *    dataLength - The number of bytes to be checked
+ * Returns:
+ *    uint32_t - The calculated CRC in the low width bits
+ */
+uint32_t CRCLib_Compute(const CRCLib_Descriptor_t *const descriptor, const uint16_t *data, const uint16_t dataLength);
+
+/** Description:
+ *    Starts a described CRC calculation made in several steps.
+ * Parameters:
+ *    context - The calculation to be started
+ *    descriptor - The CRC to be calculated
+ */
+void CRCLib_ComputeBegin(CRCLib_ComputeContext_t *const context, const CRCLib_Descriptor_t *const descriptor);
+
+/** Description:
+ *    Adds data to a described CRC calculation, packed as for
+ *    CRCLib_Compute(). Only the last call may have an odd length.
+ * Parameters:
+ *    context - The calculation to be continued
+ *    data - The data to be added
+ *    dataLength - The number of bytes to be added
+ */
+void CRCLib_ComputeUpdate(CRCLib_ComputeContext_t *const context, const uint16_t *data, const uint16_t dataLength);
+
+/** Description:
+ *    Adds a single byte to a described CRC calculation.
+ * Parameters:
+ *    context - The calculation to be continued
+ *    byte - The byte to be added, in the low 8 bits
+ */
+void CRCLib_ComputeUpdateByte(CRCLib_ComputeContext_t *const context, const uint16_t byte);
+
+/** Description:
+ *    Returns the described CRC of all data added to a calculation. The
+ *    calculation may still be continued afterwards.
+ * Parameters:
+ *    context - The calculation
+ * Returns:
+ *    uint32_t - The calculated CRC in the low width bits
+ */
+uint32_t CRCLib_ComputeFinish(const CRCLib_ComputeContext_t *const context);
+
+/** Description:
+ *    This is the command handler used for measuring the cost in cycles of
+ *    CRCLib_Calculate() with the selected backend, the software tables and
+ *    the previous byte at a time method. All are run on the same data and
+ *    the results are compared.
+ * Parameters:
+ *    message :  A pointer to a common Message Router message
+ *               object. The response is expected to be placed in
+ *               this object.
+ */
+void CRCLib_MessageRouter_Benchmark(MessageRouter_Message_t *const message);
+
 #ifdef __cplusplus
    extern "C"
 }
@@ -0,0 +1,41 @@
+/*******************************************************************************
+// CRC Library Device Interface
+// Calculates CRC16-CCITT using CRC hardware of the target device. Used by
+// CRCLib when CRCLIB_BACKEND is CRCLIB_BACKEND_DEVICE.
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+// Platform Includes
+// Other Includes
+#include <stdint.h>
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/** Description:
+ *    Calculates the CRC16-CCITT (polynomial 0x1021, no reflection) of whole
+ *    16-bit words, high byte first. Gives the same result as CRCLib_Calculate()
+ *    with a length of twice the number of words.
+ * Parameters:
+ *    crcSeed - The starting CRC
+ *    data - The data to be checked
+ *    numWords - The number of 16-bit words to be checked
+ * Returns:
+ *    uint16_t - The calculated CRC
+ */
+uint16_t CRCLib_Device_CalculateWords(const uint16_t crcSeed, const uint16_t *data, const uint16_t numWords);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,113 @@
+/*******************************************************************************
+// CRC Library Tables
+// Generated by Tools/CRCLib_TableGen.c. Do not edit.
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "CRCLib_Tables.h"
+// Platform Includes
+// Other Includes
+#include <stdint.h>
+
+/*******************************************************************************
+// Public Variable Definitions
+*******************************************************************************/
+
+// CRC-8/SMBUS: polynomial 0x07, not reflected
+#if CRCLIB_PACK_8BIT_TABLES
+const uint16_t crcLibTableCrc8[CRCLIB_TABLE8_LENGTH] = {
+   0x0700U, 0x090EU, 0x1B1CU, 0x1512U, 0x3F38U, 0x3136U, 0x2324U, 0x2D2AU, 0x7770U, 0x797EU, 0x6B6CU, 0x6562U, 0x4F48U,
+   0x4146U, 0x5354U, 0x5D5AU, 0xE7E0U, 0xE9EEU, 0xFBFCU, 0xF5F2U, 0xDFD8U, 0xD1D6U, 0xC3C4U, 0xCDCAU, 0x9790U, 0x999EU,
+   0x8B8CU, 0x8582U, 0xAFA8U, 0xA1A6U, 0xB3B4U, 0xBDBAU, 0xC0C7U, 0xCEC9U, 0xDCDBU, 0xD2D5U, 0xF8FFU, 0xF6F1U, 0xE4E3U,
+   0xEAEDU, 0xB0B7U, 0xBEB9U, 0xACABU, 0xA2A5U, 0x888FU, 0x8681U, 0x9493U, 0x9A9DU, 0x2027U, 0x2E29U, 0x3C3BU, 0x3235U,
+   0x181FU, 0x1611U, 0x0403U, 0x0A0DU, 0x5057U, 0x5E59U, 0x4C4BU, 0x4245U, 0x686FU, 0x6661U, 0x7473U, 0x7A7DU, 0x8E89U,
+   0x8087U, 0x9295U, 0x9C9BU, 0xB6B1U, 0xB8BFU, 0xAAADU, 0xA4A3U, 0xFEF9U, 0xF0F7U, 0xE2E5U, 0xECEBU, 0xC6C1U, 0xC8CFU,
+   0xDADDU, 0xD4D3U, 0x6E69U, 0x6067U, 0x7275U, 0x7C7BU, 0x5651U, 0x585FU, 0x4A4DU, 0x4443U, 0x1E19U, 0x1017U, 0x0205U,
+   0x0C0BU, 0x2621U, 0x282FU, 0x3A3DU, 0x3433U, 0x494EU, 0x4740U, 0x5552U, 0x5B5CU, 0x7176U, 0x7F78U, 0x6D6AU, 0x6364U,
+   0x393EU, 0x3730U, 0x2522U, 0x2B2CU, 0x0106U, 0x0F08U, 0x1D1AU, 0x1314U, 0xA9AEU, 0xA7A0U, 0xB5B2U, 0xBBBCU, 0x9196U,
+   0x9F98U, 0x8D8AU, 0x8384U, 0xD9DEU, 0xD7D0U, 0xC5C2U, 0xCBCCU, 0xE1E6U, 0xEFE8U, 0xFDFAU, 0xF3F4U};
+#else
+const uint16_t crcLibTableCrc8[CRCLIB_TABLE8_LENGTH] = {
+   0x0000U, 0x0007U, 0x000EU, 0x0009U, 0x001CU, 0x001BU, 0x0012U, 0x0015U, 0x0038U, 0x003FU, 0x0036U, 0x0031U, 0x0024U,
+   0x0023U, 0x002AU, 0x002DU, 0x0070U, 0x0077U, 0x007EU, 0x0079U, 0x006CU, 0x006BU, 0x0062U, 0x0065U, 0x0048U, 0x004FU,
+   0x0046U, 0x0041U, 0x0054U, 0x0053U, 0x005AU, 0x005DU, 0x00E0U, 0x00E7U, 0x00EEU, 0x00E9U, 0x00FCU, 0x00FBU, 0x00F2U,
+   0x00F5U, 0x00D8U, 0x00DFU, 0x00D6U, 0x00D1U, 0x00C4U, 0x00C3U, 0x00CAU, 0x00CDU, 0x0090U, 0x0097U, 0x009EU, 0x0099U,
+   0x008CU, 0x008BU, 0x0082U, 0x0085U, 0x00A8U, 0x00AFU, 0x00A6U, 0x00A1U, 0x00B4U, 0x00B3U, 0x00BAU, 0x00BDU, 0x00C7U,
+   0x00C0U, 0x00C9U, 0x00CEU, 0x00DBU, 0x00DCU, 0x00D5U, 0x00D2U, 0x00FFU, 0x00F8U, 0x00F1U, 0x00F6U, 0x00E3U, 0x00E4U,
+   0x00EDU, 0x00EAU, 0x00B7U, 0x00B0U, 0x00B9U, 0x00BEU, 0x00ABU, 0x00ACU, 0x00A5U, 0x00A2U, 0x008FU, 0x0088U, 0x0081U,
+   0x0086U, 0x0093U, 0x0094U, 0x009DU, 0x009AU, 0x0027U, 0x0020U, 0x0029U, 0x002EU, 0x003BU, 0x003CU, 0x0035U, 0x0032U,
+   0x001FU, 0x0018U, 0x0011U, 0x0016U, 0x0003U, 0x0004U, 0x000DU, 0x000AU, 0x0057U, 0x0050U, 0x0059U, 0x005EU, 0x004BU,
+   0x004CU, 0x0045U, 0x0042U, 0x006FU, 0x0068U, 0x0061U, 0x0066U, 0x0073U, 0x0074U, 0x007DU, 0x007AU, 0x0089U, 0x008EU,
+   0x0087U, 0x0080U, 0x0095U, 0x0092U, 0x009BU, 0x009CU, 0x00B1U, 0x00B6U, 0x00BFU, 0x00B8U, 0x00ADU, 0x00AAU, 0x00A3U,
+   0x00A4U, 0x00F9U, 0x00FEU, 0x00F7U, 0x00F0U, 0x00E5U, 0x00E2U, 0x00EBU, 0x00ECU, 0x00C1U, 0x00C6U, 0x00CFU, 0x00C8U,
+   0x00DDU, 0x00DAU, 0x00D3U, 0x00D4U, 0x0069U, 0x006EU, 0x0067U, 0x0060U, 0x0075U, 0x0072U, 0x007BU, 0x007CU, 0x0051U,
+   0x0056U, 0x005FU, 0x0058U, 0x004DU, 0x004AU, 0x0043U, 0x0044U, 0x0019U, 0x001EU, 0x0017U, 0x0010U, 0x0005U, 0x0002U,
+   0x000BU, 0x000CU, 0x0021U, 0x0026U, 0x002FU, 0x0028U, 0x003DU, 0x003AU, 0x0033U, 0x0034U, 0x004EU, 0x0049U, 0x0040U,
+   0x0047U, 0x0052U, 0x0055U, 0x005CU, 0x005BU, 0x0076U, 0x0071U, 0x0078U, 0x007FU, 0x006AU, 0x006DU, 0x0064U, 0x0063U,
+   0x003EU, 0x0039U, 0x0030U, 0x0037U, 0x0022U, 0x0025U, 0x002CU, 0x002BU, 0x0006U, 0x0001U, 0x0008U, 0x000FU, 0x001AU,
+   0x001DU, 0x0014U, 0x0013U, 0x00AEU, 0x00A9U, 0x00A0U, 0x00A7U, 0x00B2U, 0x00B5U, 0x00BCU, 0x00BBU, 0x0096U, 0x0091U,
+   0x0098U, 0x009FU, 0x008AU, 0x008DU, 0x0084U, 0x0083U, 0x00DEU, 0x00D9U, 0x00D0U, 0x00D7U, 0x00C2U, 0x00C5U, 0x00CCU,
+   0x00CBU, 0x00E6U, 0x00E1U, 0x00E8U, 0x00EFU, 0x00FAU, 0x00FDU, 0x00F4U, 0x00F3U};
+#endif
+
+// CRC-16/MODBUS: polynomial 0x8005, reflected
+const uint16_t crcLibTableCrc16Modbus[CRCLIB_TABLE_LENGTH] = {
+   0x0000U, 0xC0C1U, 0xC181U, 0x0140U, 0xC301U, 0x03C0U, 0x0280U, 0xC241U, 0xC601U, 0x06C0U, 0x0780U, 0xC741U, 0x0500U,
+   0xC5C1U, 0xC481U, 0x0440U, 0xCC01U, 0x0CC0U, 0x0D80U, 0xCD41U, 0x0F00U, 0xCFC1U, 0xCE81U, 0x0E40U, 0x0A00U, 0xCAC1U,
+   0xCB81U, 0x0B40U, 0xC901U, 0x09C0U, 0x0880U, 0xC841U, 0xD801U, 0x18C0U, 0x1980U, 0xD941U, 0x1B00U, 0xDBC1U, 0xDA81U,
+   0x1A40U, 0x1E00U, 0xDEC1U, 0xDF81U, 0x1F40U, 0xDD01U, 0x1DC0U, 0x1C80U, 0xDC41U, 0x1400U, 0xD4C1U, 0xD581U, 0x1540U,
+   0xD701U, 0x17C0U, 0x1680U, 0xD641U, 0xD201U, 0x12C0U, 0x1380U, 0xD341U, 0x1100U, 0xD1C1U, 0xD081U, 0x1040U, 0xF001U,
+   0x30C0U, 0x3180U, 0xF141U, 0x3300U, 0xF3C1U, 0xF281U, 0x3240U, 0x3600U, 0xF6C1U, 0xF781U, 0x3740U, 0xF501U, 0x35C0U,
+   0x3480U, 0xF441U, 0x3C00U, 0xFCC1U, 0xFD81U, 0x3D40U, 0xFF01U, 0x3FC0U, 0x3E80U, 0xFE41U, 0xFA01U, 0x3AC0U, 0x3B80U,
+   0xFB41U, 0x3900U, 0xF9C1U, 0xF881U, 0x3840U, 0x2800U, 0xE8C1U, 0xE981U, 0x2940U, 0xEB01U, 0x2BC0U, 0x2A80U, 0xEA41U,
+   0xEE01U, 0x2EC0U, 0x2F80U, 0xEF41U, 0x2D00U, 0xEDC1U, 0xEC81U, 0x2C40U, 0xE401U, 0x24C0U, 0x2580U, 0xE541U, 0x2700U,
+   0xE7C1U, 0xE681U, 0x2640U, 0x2200U, 0xE2C1U, 0xE381U, 0x2340U, 0xE101U, 0x21C0U, 0x2080U, 0xE041U, 0xA001U, 0x60C0U,
+   0x6180U, 0xA141U, 0x6300U, 0xA3C1U, 0xA281U, 0x6240U, 0x6600U, 0xA6C1U, 0xA781U, 0x6740U, 0xA501U, 0x65C0U, 0x6480U,
+   0xA441U, 0x6C00U, 0xACC1U, 0xAD81U, 0x6D40U, 0xAF01U, 0x6FC0U, 0x6E80U, 0xAE41U, 0xAA01U, 0x6AC0U, 0x6B80U, 0xAB41U,
+   0x6900U, 0xA9C1U, 0xA881U, 0x6840U, 0x7800U, 0xB8C1U, 0xB981U, 0x7940U, 0xBB01U, 0x7BC0U, 0x7A80U, 0xBA41U, 0xBE01U,
+   0x7EC0U, 0x7F80U, 0xBF41U, 0x7D00U, 0xBDC1U, 0xBC81U, 0x7C40U, 0xB401U, 0x74C0U, 0x7580U, 0xB541U, 0x7700U, 0xB7C1U,
+   0xB681U, 0x7640U, 0x7200U, 0xB2C1U, 0xB381U, 0x7340U, 0xB101U, 0x71C0U, 0x7080U, 0xB041U, 0x5000U, 0x90C1U, 0x9181U,
+   0x5140U, 0x9301U, 0x53C0U, 0x5280U, 0x9241U, 0x9601U, 0x56C0U, 0x5780U, 0x9741U, 0x5500U, 0x95C1U, 0x9481U, 0x5440U,
+   0x9C01U, 0x5CC0U, 0x5D80U, 0x9D41U, 0x5F00U, 0x9FC1U, 0x9E81U, 0x5E40U, 0x5A00U, 0x9AC1U, 0x9B81U, 0x5B40U, 0x9901U,
+   0x59C0U, 0x5880U, 0x9841U, 0x8801U, 0x48C0U, 0x4980U, 0x8941U, 0x4B00U, 0x8BC1U, 0x8A81U, 0x4A40U, 0x4E00U, 0x8EC1U,
+   0x8F81U, 0x4F40U, 0x8D01U, 0x4DC0U, 0x4C80U, 0x8C41U, 0x4400U, 0x84C1U, 0x8581U, 0x4540U, 0x8701U, 0x47C0U, 0x4680U,
+   0x8641U, 0x8201U, 0x42C0U, 0x4380U, 0x8341U, 0x4100U, 0x81C1U, 0x8081U, 0x4040U};
+
+// CRC-32: polynomial 0x04C11DB7, reflected
+const uint32_t crcLibTableCrc32[CRCLIB_TABLE_LENGTH] = {
+   0x00000000UL, 0x77073096UL, 0xEE0E612CUL, 0x990951BAUL, 0x076DC419UL, 0x706AF48FUL, 0xE963A535UL, 0x9E6495A3UL,
+   0x0EDB8832UL, 0x79DCB8A4UL, 0xE0D5E91EUL, 0x97D2D988UL, 0x09B64C2BUL, 0x7EB17CBDUL, 0xE7B82D07UL, 0x90BF1D91UL,
+   0x1DB71064UL, 0x6AB020F2UL, 0xF3B97148UL, 0x84BE41DEUL, 0x1ADAD47DUL, 0x6DDDE4EBUL, 0xF4D4B551UL, 0x83D385C7UL,
+   0x136C9856UL, 0x646BA8C0UL, 0xFD62F97AUL, 0x8A65C9ECUL, 0x14015C4FUL, 0x63066CD9UL, 0xFA0F3D63UL, 0x8D080DF5UL,
+   0x3B6E20C8UL, 0x4C69105EUL, 0xD56041E4UL, 0xA2677172UL, 0x3C03E4D1UL, 0x4B04D447UL, 0xD20D85FDUL, 0xA50AB56BUL,
+   0x35B5A8FAUL, 0x42B2986CUL, 0xDBBBC9D6UL, 0xACBCF940UL, 0x32D86CE3UL, 0x45DF5C75UL, 0xDCD60DCFUL, 0xABD13D59UL,
+   0x26D930ACUL, 0x51DE003AUL, 0xC8D75180UL, 0xBFD06116UL, 0x21B4F4B5UL, 0x56B3C423UL, 0xCFBA9599UL, 0xB8BDA50FUL,
+   0x2802B89EUL, 0x5F058808UL, 0xC60CD9B2UL, 0xB10BE924UL, 0x2F6F7C87UL, 0x58684C11UL, 0xC1611DABUL, 0xB6662D3DUL,
+   0x76DC4190UL, 0x01DB7106UL, 0x98D220BCUL, 0xEFD5102AUL, 0x71B18589UL, 0x06B6B51FUL, 0x9FBFE4A5UL, 0xE8B8D433UL,
+   0x7807C9A2UL, 0x0F00F934UL, 0x9609A88EUL, 0xE10E9818UL, 0x7F6A0DBBUL, 0x086D3D2DUL, 0x91646C97UL, 0xE6635C01UL,
+   0x6B6B51F4UL, 0x1C6C6162UL, 0x856530D8UL, 0xF262004EUL, 0x6C0695EDUL, 0x1B01A57BUL, 0x8208F4C1UL, 0xF50FC457UL,
+   0x65B0D9C6UL, 0x12B7E950UL, 0x8BBEB8EAUL, 0xFCB9887CUL, 0x62DD1DDFUL, 0x15DA2D49UL, 0x8CD37CF3UL, 0xFBD44C65UL,
+   0x4DB26158UL, 0x3AB551CEUL, 0xA3BC0074UL, 0xD4BB30E2UL, 0x4ADFA541UL, 0x3DD895D7UL, 0xA4D1C46DUL, 0xD3D6F4FBUL,
+   0x4369E96AUL, 0x346ED9FCUL, 0xAD678846UL, 0xDA60B8D0UL, 0x44042D73UL, 0x33031DE5UL, 0xAA0A4C5FUL, 0xDD0D7CC9UL,
+   0x5005713CUL, 0x270241AAUL, 0xBE0B1010UL, 0xC90C2086UL, 0x5768B525UL, 0x206F85B3UL, 0xB966D409UL, 0xCE61E49FUL,
+   0x5EDEF90EUL, 0x29D9C998UL, 0xB0D09822UL, 0xC7D7A8B4UL, 0x59B33D17UL, 0x2EB40D81UL, 0xB7BD5C3BUL, 0xC0BA6CADUL,
+   0xEDB88320UL, 0x9ABFB3B6UL, 0x03B6E20CUL, 0x74B1D29AUL, 0xEAD54739UL, 0x9DD277AFUL, 0x04DB2615UL, 0x73DC1683UL,
+   0xE3630B12UL, 0x94643B84UL, 0x0D6D6A3EUL, 0x7A6A5AA8UL, 0xE40ECF0BUL, 0x9309FF9DUL, 0x0A00AE27UL, 0x7D079EB1UL,
+   0xF00F9344UL, 0x8708A3D2UL, 0x1E01F268UL, 0x6906C2FEUL, 0xF762575DUL, 0x806567CBUL, 0x196C3671UL, 0x6E6B06E7UL,
+   0xFED41B76UL, 0x89D32BE0UL, 0x10DA7A5AUL, 0x67DD4ACCUL, 0xF9B9DF6FUL, 0x8EBEEFF9UL, 0x17B7BE43UL, 0x60B08ED5UL,
+   0xD6D6A3E8UL, 0xA1D1937EUL, 0x38D8C2C4UL, 0x4FDFF252UL, 0xD1BB67F1UL, 0xA6BC5767UL, 0x3FB506DDUL, 0x48B2364BUL,
+   0xD80D2BDAUL, 0xAF0A1B4CUL, 0x36034AF6UL, 0x41047A60UL, 0xDF60EFC3UL, 0xA867DF55UL, 0x316E8EEFUL, 0x4669BE79UL,
+   0xCB61B38CUL, 0xBC66831AUL, 0x256FD2A0UL, 0x5268E236UL, 0xCC0C7795UL, 0xBB0B4703UL, 0x220216B9UL, 0x5505262FUL,
+   0xC5BA3BBEUL, 0xB2BD0B28UL, 0x2BB45A92UL, 0x5CB36A04UL, 0xC2D7FFA7UL, 0xB5D0CF31UL, 0x2CD99E8BUL, 0x5BDEAE1DUL,
+   0x9B64C2B0UL, 0xEC63F226UL, 0x756AA39CUL, 0x026D930AUL, 0x9C0906A9UL, 0xEB0E363FUL, 0x72076785UL, 0x05005713UL,
+   0x95BF4A82UL, 0xE2B87A14UL, 0x7BB12BAEUL, 0x0CB61B38UL, 0x92D28E9BUL, 0xE5D5BE0DUL, 0x7CDCEFB7UL, 0x0BDBDF21UL,
+   0x86D3D2D4UL, 0xF1D4E242UL, 0x68DDB3F8UL, 0x1FDA836EUL, 0x81BE16CDUL, 0xF6B9265BUL, 0x6FB077E1UL, 0x18B74777UL,
+   0x88085AE6UL, 0xFF0F6A70UL, 0x66063BCAUL, 0x11010B5CUL, 0x8F659EFFUL, 0xF862AE69UL, 0x616BFFD3UL, 0x166CCF45UL,
+   0xA00AE278UL, 0xD70DD2EEUL, 0x4E048354UL, 0x3903B3C2UL, 0xA7672661UL, 0xD06016F7UL, 0x4969474DUL, 0x3E6E77DBUL,
+   0xAED16A4AUL, 0xD9D65ADCUL, 0x40DF0B66UL, 0x37D83BF0UL, 0xA9BCAE53UL, 0xDEBB9EC5UL, 0x47B2CF7FUL, 0x30B5FFE9UL,
+   0xBDBDF21CUL, 0xCABAC28AUL, 0x53B39330UL, 0x24B4A3A6UL, 0xBAD03605UL, 0xCDD70693UL, 0x54DE5729UL, 0x23D967BFUL,
+   0xB3667A2EUL, 0xC4614AB8UL, 0x5D681B02UL, 0x2A6F2B94UL, 0xB40BBE37UL, 0xC30C8EA1UL, 0x5A05DF1BUL, 0x2D02EF8DUL};
@@ -0,0 +1,53 @@
+/*******************************************************************************
+// CRC Library Tables
+// Lookup tables used by the CRCLib descriptors. The definitions in
+// CRCLib_Tables.c are generated by Tools/CRCLib_TableGen.c.
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "CRCLib_Config.h" // Selects the 8-bit table layout
+// Platform Includes
+// Other Includes
+#include <stdint.h>
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The number of entries in each table
+#define CRCLIB_TABLE_LENGTH (256U)
+
+// The number of words in a table of 8-bit entries. Packing two entries in
+// each word halves the size on targets where a char is 16 bits.
+#if CRCLIB_PACK_8BIT_TABLES
+#define CRCLIB_TABLE8_LENGTH (CRCLIB_TABLE_LENGTH / 2U)
+#else
+#define CRCLIB_TABLE8_LENGTH (CRCLIB_TABLE_LENGTH)
+#endif
+
+/*******************************************************************************
+// Public Variable Declarations
+*******************************************************************************/
+
+// CRC-8/SMBUS: polynomial 0x07, not reflected
+extern const uint16_t crcLibTableCrc8[CRCLIB_TABLE8_LENGTH];
+
+// CRC-16/MODBUS: polynomial 0x8005, reflected
+extern const uint16_t crcLibTableCrc16Modbus[CRCLIB_TABLE_LENGTH];
+
+// CRC-32: polynomial 0x04C11DB7, reflected
+extern const uint32_t crcLibTableCrc32[CRCLIB_TABLE_LENGTH];
+
+#ifdef __cplusplus
+}
+#endif
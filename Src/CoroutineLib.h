@@ -0,0 +1,237 @@
+/*******************************************************************************
+// Coroutine Library Interface
+// Provides stackless coroutines (protothreads) for long-running work that must
+// be spread across several calls rather than blocking the caller.
+*******************************************************************************/
+// Prevent multiple inclusion of header file
+#pragma once
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+// Platform Includes
+#include "SoftTimerLib.h" // Timeouts
+// Other Includes
+#include <stdbool.h>  // Defines C99 boolean type
+#include <stdint.h>  // Defines C99 integer types
+
+
+/*******************************************************************************
+// Start C Binding Section for C++ Compilers
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// Resume point of a coroutine that has not yet run
+#define COROUTINELIB_RESUME_POINT_START (0U)
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+// The result returned by each call of a coroutine
+typedef enum
+{
+   // The coroutine is blocked waiting for a condition or a delay
+   COROUTINELIB_STATUS_WAITING,
+   // The coroutine gave up the CPU and will continue on the next call
+   COROUTINELIB_STATUS_YIELDED,
+   // The coroutine was stopped early with COROUTINELIB_EXIT()
+   COROUTINELIB_STATUS_EXITED,
+   // The coroutine reached COROUTINELIB_END()
+   COROUTINELIB_STATUS_ENDED
+} CoroutineLib_Status_t;
+
+// Structure that holds the state of a coroutine between calls. Note that the
+// local variables of a coroutine are NOT preserved between calls. Any value
+// that must survive a yield has to be static or stored outside the function.
+typedef struct
+{
+   // The source line at which the coroutine continues on the next call
+   uint16_t resumePoint;
+   // Timer used by COROUTINELIB_DELAY() and COROUTINELIB_WAIT_UNTIL_TIMEOUT()
+   SoftTimerLib_Timer_t timer;
+   // Set when the last COROUTINELIB_WAIT_UNTIL_TIMEOUT() ended by timing out
+   bool isTimedOut;
+} CoroutineLib_Context_t;
+
+
+/*******************************************************************************
+// Public Macro Definitions
+// A coroutine is an ordinary function that takes a context and returns a
+// CoroutineLib_Status_t. Its body is placed between COROUTINELIB_BEGIN() and
+// COROUTINELIB_END(). The resume point is implemented with a switch statement,
+// so a coroutine body must not contain a switch statement of its own that
+// spans a wait or yield, and each wait or yield must be on its own line.
+//
+// Example:
+//    CoroutineLib_Status_t EraseFlash(CoroutineLib_Context_t *const context)
+//    {
+//       static uint16_t sector;
+//       COROUTINELIB_BEGIN(context);
+//       for (sector = 0U; sector < NUM_SECTORS; sector++)
+//       {
+//          Flash_StartErase(sector);
+//          COROUTINELIB_WAIT_UNTIL_TIMEOUT(context, Flash_IsIdle(), 500U);
+//          if (COROUTINELIB_IS_TIMED_OUT(context))
+//          {
+//             COROUTINELIB_EXIT(context);
+//          }
+//       }
+//       COROUTINELIB_END(context);
+//    }
+*******************************************************************************/
+
+/*******************************************************************************
+// Description:
+//    Prepare a context so the coroutine starts from the beginning on its next
+//    call.
+// Parameters:
+//    context - A pointer to the coroutine context
+*******************************************************************************/
+#define COROUTINELIB_INIT(context) \
+   do \
+   { \
+      (context)->resumePoint = COROUTINELIB_RESUME_POINT_START; \
+      (context)->isTimedOut = false; \
+      SoftTimerLib_Init(&(context)->timer); \
+   } while (0)
+
+/*******************************************************************************
+// Description:
+//    Start of the coroutine body. Jumps to the point at which the coroutine
+//    last waited or yielded.
+// Parameters:
+//    context - A pointer to the coroutine context
+*******************************************************************************/
+#define COROUTINELIB_BEGIN(context) \
+   switch ((context)->resumePoint) \
+   { \
+      case COROUTINELIB_RESUME_POINT_START:
+
+/*******************************************************************************
+// Description:
+//    End of the coroutine body. The context is reset so the coroutine would
+//    start from the beginning if called again.
+// Parameters:
+//    context - A pointer to the coroutine context
+*******************************************************************************/
+#define COROUTINELIB_END(context) \
+   } \
+   (context)->resumePoint = COROUTINELIB_RESUME_POINT_START; \
+   return(COROUTINELIB_STATUS_ENDED)
+
+/*******************************************************************************
+// Description:
+//    Return to the caller until the given condition is true. The condition is
+//    checked again on each call.
+// Parameters:
+//    context - A pointer to the coroutine context
+//    condition - Expression that allows the coroutine to continue when true
+*******************************************************************************/
+#define COROUTINELIB_WAIT_UNTIL(context, condition) \
+   do \
+   { \
+      (context)->resumePoint = (uint16_t)__LINE__; \
+      case __LINE__: \
+      if (!(condition)) \
+      { \
+         return(COROUTINELIB_STATUS_WAITING); \
+      } \
+   } while (0)
+
+/*******************************************************************************
+// Description:
+//    Return to the caller until the given condition is true or the timeout
+//    has elapsed. Use COROUTINELIB_IS_TIMED_OUT() afterwards to find out which.
+//    The condition is evaluated once per call.
+// Parameters:
+//    context - A pointer to the coroutine context
+//    condition - Expression that allows the coroutine to continue when true
+//    timeoutMilliseconds - Longest time to wait for the condition
+*******************************************************************************/
+#define COROUTINELIB_WAIT_UNTIL_TIMEOUT(context, condition, timeoutMilliseconds) \
+   do \
+   { \
+      SoftTimerLib_StartTimer(&(context)->timer, (timeoutMilliseconds)); \
+      (context)->isTimedOut = false; \
+      COROUTINELIB_WAIT_UNTIL((context), (condition) || \
+                                         ((context)->isTimedOut = SoftTimerLib_IsTimerExpired(&(context)->timer))); \
+      SoftTimerLib_StopTimer(&(context)->timer); \
+   } while (0)
+
+/*******************************************************************************
+// Description:
+//    Evaluates to true if the last COROUTINELIB_WAIT_UNTIL_TIMEOUT() ended
+//    because the timeout elapsed before the condition became true.
+// Parameters:
+//    context - A pointer to the coroutine context
+*******************************************************************************/
+#define COROUTINELIB_IS_TIMED_OUT(context) ((context)->isTimedOut)
+
+/*******************************************************************************
+// Description:
+//    Return to the caller until the given time has elapsed.
+// Parameters:
+//    context - A pointer to the coroutine context
+//    delayMilliseconds - Time to wait before continuing
+*******************************************************************************/
+#define COROUTINELIB_DELAY(context, delayMilliseconds) \
+   do \
+   { \
+      SoftTimerLib_StartTimer(&(context)->timer, (delayMilliseconds)); \
+      COROUTINELIB_WAIT_UNTIL((context), SoftTimerLib_IsTimerExpired(&(context)->timer)); \
+      SoftTimerLib_StopTimer(&(context)->timer); \
+   } while (0)
+
+/*******************************************************************************
+// Description:
+//    Return to the caller once and continue from this point on the next call.
+//    Used to split long loops so other work can run between iterations.
+// Parameters:
+//    context - A pointer to the coroutine context
+*******************************************************************************/
+#define COROUTINELIB_YIELD(context) \
+   do \
+   { \
+      (context)->resumePoint = (uint16_t)__LINE__; \
+      return(COROUTINELIB_STATUS_YIELDED); \
+      case __LINE__: ; \
+   } while (0)
+
+/*******************************************************************************
+// Description:
+//    Stop the coroutine early. The context is reset so the coroutine would
+//    start from the beginning if called again.
+// Parameters:
+//    context - A pointer to the coroutine context
+*******************************************************************************/
+#define COROUTINELIB_EXIT(context) \
+   do \
+   { \
+      (context)->resumePoint = COROUTINELIB_RESUME_POINT_START; \
+      return(COROUTINELIB_STATUS_EXITED); \
+   } while (0)
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// End of C Binding Section
+*******************************************************************************/
+#ifdef __cplusplus
+}
+#endif
+
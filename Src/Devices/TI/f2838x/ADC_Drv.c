@@ -173,6 +173,18 @@ bool ADC_Drv_Init(const uint32_t moduleID, const ADC_Drv_Config_t *configData)
     return(status.isInitialized);
 }
 
+// Latch the most recent conversion result of every channel
+void ADC_Drv_StoreResults(void)
+{
+   if (status.enableState)
+   {
+      for (uint16_t channel = 0U; channel < ADC_DRV_CHANNEL_COUNT; channel++)
+      {
+         status.adcResult[channel] = ADC_readResult(status.adcConfig->dataPtr[channel].resultBase, status.adcConfig->dataPtr[channel].socNumber);
+      }
+   }
+}
+
 // Get ADC value for the given channel
 uint16_t ADC_Drv_GetValue(ADC_Drv_Channel_t const channel)
 {
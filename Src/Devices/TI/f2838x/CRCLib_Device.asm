@@ -0,0 +1,54 @@
+;*******************************************************************************
+; CRC Library Device Implementation
+; Calculates CRC16-CCITT with the VCU-II CRC instructions of the C28x core.
+; VCRC16P2 uses polynomial 0x1021 without reflection, which matches the
+; CRCLib tables. Requires --vcu_support=vcu2.
+; The message flip bit of VSTATUS reverses the bits of each input byte. It is
+; cleared on entry rather than relying on its reset value, and VSTATUS is
+; restored on exit so that callers which set it are not affected.
+;*******************************************************************************
+
+        .if __TI_EABI__
+        .asg    CRCLib_Device_CalculateWords, _CRCLib_Device_CalculateWords
+        .endif
+
+        .global _CRCLib_Device_CalculateWords
+
+        .sect   ".text"
+
+;*******************************************************************************
+; uint16_t CRCLib_Device_CalculateWords(const uint16_t crcSeed,
+;                                       const uint16_t *data,
+;                                       const uint16_t numWords)
+;    AL   - crcSeed
+;    XAR4 - data
+;    AH   - numWords
+;    Returns the CRC in AL
+;*******************************************************************************
+_CRCLib_Device_CalculateWords:
+        ADDB    SP, #4                  ; Room to move 32-bit values to and from VCRC
+        VMOV32  *-SP[4], VSTATUS        ; Save VSTATUS for the caller
+        VCLRCRCMSGFLIP                  ; Bytes are not bit reversed
+        MOVZ    AR6, AH                 ; AR6 = number of words
+        MOV     AH, #0                  ; ACC = seed, zero extended
+        MOVL    *-SP[2], ACC
+        VCRCCLR
+        VMOV32  VCRC, *-SP[2]           ; VCRC = seed
+
+        MOV     AL, AR6                 ; Nothing to do for 0 words
+        B       CRCLib_Device_Done, EQ
+        SUBB    XAR6, #1                ; BANZ loops AR6 + 1 times
+
+CRCLib_Device_Loop:
+        VCRC16P2H_1 *XAR4               ; High byte first
+        VCRC16P2L_1 *XAR4++             ; Then the low byte
+        BANZ    CRCLib_Device_Loop, AR6--
+
+CRCLib_Device_Done:
+        VMOV32  *-SP[2], VCRC           ; Return the low 16 bits of VCRC
+        MOV     AL, *-SP[2]
+        VMOV32  VSTATUS, *-SP[4]        ; Restore the message flip bit
+        SUBB    SP, #4
+        LRETR
+
+        .end
@@ -0,0 +1,109 @@
+/*******************************************************************************
+// Memory CRC Driver - TI F2838x Implementation
+// Uses the CPU1 background CRC (BGCRC) module
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "MemoryCRC_Drv.h" // Module header
+// Platform Includes
+// Other Includes
+#include <stdint.h> // Defines C99 integer types
+#include "bgcrc.h" // TI Background CRC functions
+#include "sysctl.h" // TI System Control functions for enabling the clock
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The BGCRC instance used by the CPU
+#define MEMORYCRC_DRV_BASE (BGCRC_CPU_BASE)
+
+// All flags that may be left by a run
+#define MEMORYCRC_DRV_ALL_FLAGS (BGCRC_GLOBAL_INT | BGCRC_TEST_DONE | BGCRC_ALL_ERROR_FLAGS)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure defines the internal variables used by the module
+typedef struct
+{
+   // Set while a run started by this driver has not been seen to complete
+   bool isRunning;
+} MemoryCRC_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The variable used for holding all internal data for this module.
+static MemoryCRC_Status_t status;
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Initializes the module
+void MemoryCRC_Drv_Init(void)
+{
+   SysCtl_enablePeripheral(SYSCTL_PERIPH_CLK_CPUBGCRC);
+
+   // Each run checks only part of a range, so the golden CRC compare done by
+   // the module is meaningless and must not raise an NMI. The module stops
+   // while the CPU is halted by the debugger.
+   BGCRC_setConfig(MEMORYCRC_DRV_BASE, BGCRC_NMI_DISABLE, BGCRC_EMUCTRL_SOFT);
+   BGCRC_disableWatchdog(MEMORYCRC_DRV_BASE);
+   BGCRC_disableInterrupt(MEMORYCRC_DRV_BASE, BGCRC_TEST_DONE | BGCRC_ALL_ERROR_FLAGS);
+   BGCRC_clearInterruptStatus(MEMORYCRC_DRV_BASE, MEMORYCRC_DRV_ALL_FLAGS);
+   BGCRC_clearNMIStatus(MEMORYCRC_DRV_BASE, BGCRC_ALL_ERROR_FLAGS);
+
+   status.isRunning = false;
+}
+
+// Start a background run
+bool MemoryCRC_Drv_Start(const uint32_t address, const uint16_t numBlocks, const uint32_t crcSeed)
+{
+   bool wasStarted = false;
+
+   if ((numBlocks > 0U) && (numBlocks <= MEMORYCRC_DRV_MAX_NUM_BLOCKS) && !MemoryCRC_Drv_IsBusy())
+   {
+      // Clear the done flag of the last run so completion of this one is seen
+      BGCRC_clearInterruptStatus(MEMORYCRC_DRV_BASE, MEMORYCRC_DRV_ALL_FLAGS);
+
+      // The block size is given in units of 256 bytes
+      BGCRC_setSeedValue(MEMORYCRC_DRV_BASE, crcSeed);
+      BGCRC_setRegion(MEMORYCRC_DRV_BASE, address, (uint32_t)numBlocks, BGCRC_CRC_MODE);
+
+      status.isRunning = true;
+      BGCRC_start(MEMORYCRC_DRV_BASE);
+      wasStarted = true;
+   }
+
+   return(wasStarted);
+}
+
+// Check for a run in progress
+bool MemoryCRC_Drv_IsBusy(void)
+{
+   // The run status bit may not be set until a few cycles after the start,
+   // so completion is taken from the done flag instead
+   if (status.isRunning && (0U != (BGCRC_getInterruptStatus(MEMORYCRC_DRV_BASE) & BGCRC_TEST_DONE)))
+   {
+      status.isRunning = false;
+   }
+
+   return(status.isRunning);
+}
+
+// Return the result of the last run
+uint32_t MemoryCRC_Drv_GetResult(void)
+{
+   return(BGCRC_getResult(MEMORYCRC_DRV_BASE));
+}
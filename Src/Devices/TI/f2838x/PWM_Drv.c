@@ -13,6 +13,7 @@
 #include "device.h"
 #include "epwm.h"
 #include "gpio.h"
+#include "interrupt.h"
 #include "pin_map.h"
 #include "sysctl.h"
 
@@ -640,6 +641,16 @@ void PWM_Drv_SetPhaseShiftDegrees(PWM_Drv_Channel_t pwmChannel, float phaseDegre
     }
 }
 
+// Clear the EPWM2 time base interrupt
+void PWM_Drv_AcknowledgeInterrupt(void)
+{
+    // Clear the event trigger flag so the next TBCTR_ZERO event generates an interrupt
+    EPWM_clearEventTriggerInterruptFlag(EPWM2_BASE);
+
+    // Allow further interrupts from PIE group 3 (EPWM)
+    Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP3);
+}
+
 
 /*******************************************************************************
 // Command Processor
@@ -582,6 +582,41 @@ uint32_t Sys_LowSpeedClockFrequencyHz(void)
     return(SysCtl_getLowSpeedClock(SYS_OSCSRC_FREQ));
 }
 
+void Sys_Idle(void)
+{
+    // Gate the CPU clock until the next enabled interrupt wakes the device
+    SysCtl_enterIdleMode();
+}
+
+void Sys_RegisterInterrupt(const uint32_t interruptNumber, void (*handler)(void))
+{
+    Interrupt_register(interruptNumber, handler);
+}
+
+void Sys_SetInterruptEnableState(const uint32_t interruptNumber, const bool enableState)
+{
+    if (enableState)
+    {
+        Interrupt_enable(interruptNumber);
+    }
+    else
+    {
+        Interrupt_disable(interruptNumber);
+    }
+}
+
+uint16_t Sys_EnterCritical(void)
+{
+    // Set INTM and return the previous state of the status register
+    return(__disable_interrupts());
+}
+
+void Sys_ExitCritical(const uint16_t interruptState)
+{
+    // Only clears INTM if interrupts were enabled when the section was entered
+    __restore_interrupts(interruptState);
+}
+
 // Get version information
 void Sys_MessageRouter_GetApplicationVersion(MessageRouter_Message_t *const message)
 {
@@ -1,6 +1,8 @@
 /*******************************************************************************
 // SysTick Driver - TI F2838xD Implementation
-// CPU Timer 2 is used as the System Tick timer for this platform. 
+// A free-running CPU timer provides the system time for this platform and a
+// second CPU timer is used as a one-shot wakeup timer. No periodic interrupt
+// is used.
 *******************************************************************************/
 
 /*******************************************************************************
@@ -20,8 +22,6 @@
 // Private Constant Definitions
 *******************************************************************************/
 
-// Define conversion factor for calculating period
-#define MICROSECONDS_PER_SECOND (UINT32_C(1000000))
 
 
 /*******************************************************************************
@@ -39,6 +39,12 @@ typedef struct
 
    // Enable state for the systick module
    bool enableState;
+
+   // CPU Timer base address of the free-running cycle counter
+   uint32_t cycleCounterBase;
+
+   // CPU Timer base address of the one-shot wakeup timer
+   uint32_t wakeupTimerBase;
 } SysTick_Drv_Status_t;
 
 
@@ -49,54 +55,25 @@ typedef struct
 // The variable used for holding all internal data for this module.
 static SysTick_Drv_Status_t status;
 
-// 32-bit system tick counter used for software timers
-// In the current implementation, this value is read by the Timebase module
-// to prevent the overhead of calling a function.
-volatile SysTick_Drv_Tick_t SysTick_Drv_sysTickCount = 0U;
-
 
 /*******************************************************************************
 // Private Function Declarations
 *******************************************************************************/
 
-// Clear the counter used in the IRQ handler for the given timer
-// Timer Base is CPUTIMER0_BASE, CPUTIMER1_BASE or CPUTIMER2_BASE
-static void ResetInterruptCounter(uint32_t timerBase);
-
 // This function initialize CPU timers to a known state.
 // Timer Base is CPUTIMER0_BASE, CPUTIMER1_BASE or CPUTIMER2_BASE
 static void InitCPUTimer(uint32_t timerBase);
 
-// This function initializes the selected timer to the period specified by the
-// "freq" and "period" parameters. The "freq" is entered as Hz and the period in uSeconds.
-// The timer is held in the stopped state after configuration.
+// This function configures the selected timer to raise its interrupt when it
+// reaches zero. The timer is held in the stopped state after configuration.
 // Timer Base is CPUTIMER0_BASE, CPUTIMER1_BASE or CPUTIMER2_BASE
-static void ConfigCPUTimer(uint32_t timerBase, float freq, float period);
+static void ConfigWakeupTimer(uint32_t timerBase);
 
 
 /*******************************************************************************
 // Private Function Implementations
 *******************************************************************************/
 
-// Reset the counters used in the interrupts
-static void ResetInterruptCounter(uint32_t timerBase)
-{
-    // Resets interrupt counters for the three cpuTimers
-    if (timerBase == CPUTIMER0_BASE)
-    {
-        //cpuTimer0IntCount = 0;
-    }
-    else if(timerBase == CPUTIMER1_BASE)
-    {
-        //cpuTimer1IntCount = 0;
-    }
-    else if(timerBase == CPUTIMER2_BASE)
-    {
-        // Only CPU Timer is used for system timing currently
-        SysTick_Drv_sysTickCount = 0;
-    }
-}
-
 // This function initialize CPU timers to a known state.
 // Timer Base is CPUTIMER0_BASE, CPUTIMER1_BASE or CPUTIMER2_BASE
 static void InitCPUTimer(uint32_t timerBase)
@@ -112,36 +89,20 @@ static void InitCPUTimer(uint32_t timerBase)
 
     // Reload all counter register with period value
     CPUTimer_reloadTimerCounter(timerBase);
-
-    // Reset interrupt counters for the cpuTimer
-    ResetInterruptCounter(timerBase);
 }
 
-// This function initializes the selected timer to the period specified by the
-// "freq" and "period" parameters. The "freq" is entered as Hz and the period in uSeconds.
-// The timer is held in the stopped state after configuration.
+// This function configures the selected timer to raise its interrupt when it
+// reaches zero. The timer is held in the stopped state after configuration.
 // Timer Base is CPUTIMER0_BASE, CPUTIMER1_BASE or CPUTIMER2_BASE
-static void ConfigCPUTimer(uint32_t timerBase, float freq, float period)
+static void ConfigWakeupTimer(uint32_t timerBase)
 {
-    uint32_t temp;
-
-    // Initialize timer period
-    temp = (uint32_t)(freq / MICROSECONDS_PER_SECOND * period);
-    CPUTimer_setPeriod(timerBase, temp);
-
-    // Set pre-scale counter to divide by 1 (SYSCLKOUT)
-    CPUTimer_setPreScaler(timerBase, 0);
-
-    // Initializes timer control register. The timer is stopped, reloaded,
-    // free run disabled, and interrupt enabled.
-    // Additionally, the free and soft bits are set
+    // Initializes timer control register. The timer is stopped, free run
+    // disabled, and interrupt enabled. The period is set each time the timer
+    // is started.
     CPUTimer_stopTimer(timerBase);
-    CPUTimer_reloadTimerCounter(timerBase);
+    CPUTimer_clearOverflowFlag(timerBase);
     CPUTimer_setEmulationMode(timerBase, CPUTIMER_EMULATIONMODE_STOPAFTERNEXTDECREMENT);
     CPUTimer_enableInterrupt(timerBase);
-
-    // Reset interrupt counters for the cpuTimer
-    ResetInterruptCounter(timerBase);
 }
 
 
@@ -170,11 +131,23 @@ bool SysTick_Drv_Init(const uint32_t moduleID, const SysTick_Drv_Config_t *confi
             // Verify the Channel Id matches
             if (i == channelData->channelId)
             {
+                // The cycle counter is left at the maximum period and divide by 1
+                // so it counts every SYSCLK cycle.  No interrupt is used.
+                if (SYSTICK_DRV_CHANNEL_MODE_CYCLE_COUNTER == channelData->mode)
+                {
+                    SysCtl_enablePeripheral(channelData->peripheral);
+
+                    InitCPUTimer(channelData->timerBase);
+
+                    status.cycleCounterBase = channelData->timerBase;
+
+                    // The system time is available once the cycle counter is configured
+                    status.isInitialized = true;
+                }
                 // Verify the callback is valid
-                if (channelData->callback)
+                else if (channelData->callback)
                 {
-                    // TODO - Currently only CPU Timer 2 is implemented
-                     SysCtl_enablePeripheral(channelData->peripheral);
+                    SysCtl_enablePeripheral(channelData->peripheral);
 
                     // Register ISRs for each CPU Timer interrupt
                     Interrupt_register(channelData->interruptNumber, channelData->callback);
@@ -182,14 +155,10 @@ bool SysTick_Drv_Init(const uint32_t moduleID, const SysTick_Drv_Config_t *confi
                     // Initialize the configured Device CPU Timers
                     InitCPUTimer(channelData->timerBase);
 
-                    // Configure CPU Timebase Frequency and Period (us)
-                    ConfigCPUTimer(channelData->timerBase, SYS_SYSCLK_FREQ, SYSTICK_DRV_NUM_TICKS_PER_SECOND);
-
-                    // Initialize the global variable used for counting the SysTick
-                    SysTick_Drv_sysTickCount = 0U;
+                    // The wakeup timer only runs when started by SysTick_Drv_StartWakeupTimer()
+                    ConfigWakeupTimer(channelData->timerBase);
 
-                    // Mark initialization complete if at least one channel was configured
-                    status.isInitialized = true;
+                    status.wakeupTimerBase = channelData->timerBase;
                 }
             }
         }
@@ -213,23 +182,28 @@ void SysTick_Drv_SetEnableState(bool enableState)
             // Verify the Channel Id matches
             if (i == channelData->channelId)
             {
+                // The cycle counter only needs to be started or stopped
+                if (SYSTICK_DRV_CHANNEL_MODE_CYCLE_COUNTER == channelData->mode)
+                {
+                    if (enableState)
+                    {
+                        CPUTimer_startTimer(channelData->timerBase);
+                    }
+                    else
+                    {
+                        CPUTimer_stopTimer(channelData->timerBase);
+                    }
+                }
                 // See if we are enabling or disabling
-                if (enableState)
+                else if (enableState)
                 {
-                    // Enable CPU Timer IRQ used for Timebase
-                    // To ensure precise timing, use write-only instructions to write to the
-                    // entire register.
+                    // Enable CPU Timer IRQ used for waking the CPU. The timer
+                    // itself is only started when a wakeup is requested.
                     CPUTimer_enableInterrupt(channelData->timerBase);
 
                     // Enables CPU int14 connected to CPU-Timer 2
                     Interrupt_enable(channelData->interruptNumber);
 
-                    // Starts CPU Timer 2 used for Timebase
-                    CPUTimer_startTimer(channelData->timerBase);
-
-                    // Initialize the global variable used for counting the SysTick
-                    SysTick_Drv_sysTickCount = 0U;
-
                     // Mark initialization complete if at least one channel was configured
                     status.enableState = true;
                 }
@@ -238,13 +212,13 @@ void SysTick_Drv_SetEnableState(bool enableState)
                     // Mark initialization complete if at least one channel was configured
                     status.enableState = false;
 
-                    // Stop CPU Timer 2 used for Timebase
+                    // Stop CPU Timer 2 used for waking the CPU
                     CPUTimer_stopTimer(channelData->timerBase);
 
-                    // Enables CPU int14 connected to CPU-Timer 2
+                    // Disables CPU int14 connected to CPU-Timer 2
                     Interrupt_disable(channelData->interruptNumber);
 
-                    // Disbale CPU Timer IRQ used for Timebase
+                    // Disbale CPU Timer IRQ used for waking the CPU
                     CPUTimer_disableInterrupt(channelData->timerBase);
                 }
             }
@@ -253,13 +227,40 @@ void SysTick_Drv_SetEnableState(bool enableState)
 }
 
 
+// Get the number of SYSCLK cycles counted by the free-running cycle counter
+SysTick_Drv_CycleCount_t SysTick_Drv_GetCycleCount(void)
+{
+    // The CPU timer counts down, so invert it to get an incrementing count
+    return((SysTick_Drv_CycleCount_t)(UINT32_MAX - CPUTimer_getTimerCount(status.cycleCounterBase)));
+}
+
+// Raise the wakeup interrupt after the given number of cycles
+void SysTick_Drv_StartWakeupTimer(const SysTick_Drv_CycleCount_t delayCycles)
+{
+    // Only arm the timer while it is enabled
+    if (status.enableState)
+    {
+        CPUTimer_stopTimer(status.wakeupTimerBase);
+
+        // The timer counts down from the period to zero, which takes period + 1 cycles
+        CPUTimer_setPeriod(status.wakeupTimerBase, (0U != delayCycles) ? (delayCycles - 1U) : 0U);
+        CPUTimer_reloadTimerCounter(status.wakeupTimerBase);
+        CPUTimer_clearOverflowFlag(status.wakeupTimerBase);
+
+        CPUTimer_startTimer(status.wakeupTimerBase);
+    }
+}
+
+
 /*******************************************************************************
 // Interrupt Handler
 *******************************************************************************/
 
-// IRQ for CPU Timer 2 - Used for System Tick (cpuTimer2ISR)
+// IRQ for CPU Timer 2 - Used for waking the CPU (cpuTimer2ISR)
 INTERRUPT_FUNC void SysTick_Handler(void)
 {
-   // Simply increment the SysTick counter by 1
-   SysTick_Drv_sysTickCount++;
+   // Stop the timer so each wakeup fires only once. Returning from the
+   // interrupt is enough to bring the CPU out of idle.
+   CPUTimer_stopTimer(status.wakeupTimerBase);
+   CPUTimer_clearOverflowFlag(status.wakeupTimerBase);
 }
@@ -22,14 +22,6 @@
 #define UART_DRV_FIFO_TX_SIZE 16
 #define UART_DRV_FIFO_RX_SIZE 16
 
-// Size of the local ring buffer used for transmitting data.
-// Note the buffer library requires this to be a power of two.
-#define TX_BUFFER_SIZE (128)
-
-// Size of the local ring buffer used for receiving data.
-// Note the buffer library requires this to be a power of two.
-#define RX_BUFFER_SIZE (128)
-
 // This defines the maximum length of command data in bytes.
 #define COMMAND_DATA_MAX_SIZE (48)
 
@@ -89,20 +81,19 @@ typedef struct
 } UART_Drv_Channel_Fifo_t;
 
 // Structure to hold the circular buffers for each port
+// The data buffers are given by the board configuration, so each port may be
+// sized for its link.
 typedef struct
 {
     /*Defines all parameters for the RX circular buffer.
     */
     RingBuffer_t rxCircularBuffer;
 
-    // RX data buffer.
-    RingBuffer_Data_t rxCircularBufferData[RX_BUFFER_SIZE];
-
     //Defines all parameters for the TX circular buffer.
     RingBuffer_t txCircularBuffer;
 
-    // TX data buffer.
-    RingBuffer_Data_t txCircularBufferData[TX_BUFFER_SIZE];
+    // The free TX space asked for with UART_Drv_RequestTxSpace(), 0 if none
+    uint16_t txSpaceRequested;
 } PortBuffers_t;
 
 
@@ -199,6 +190,30 @@ uint16_t UART_Drv_GetNumCharsTX(const UART_Drv_Channel_t channelId) {
 }
 
 
+// Free space in the transmit buffer
+uint16_t UART_Drv_GetTxBufferSpace(const UART_Drv_Channel_t channelId) {
+    uint16_t numChars = 0;
+
+    if (initDone && (channelId < UART_DRV_CHANNEL_COUNT))
+    {
+        RingBuffer_t *const txBuffer = &(status.portBuffers[channelId].txCircularBuffer);
+
+        numChars = txBuffer->bufferSize - RingBuffer_GetDataLength(txBuffer);
+    }
+
+    return (numChars);
+}
+
+
+// Call back once the transmit buffer has room
+void UART_Drv_RequestTxSpace(const UART_Drv_Channel_t channelId, const uint16_t numChars) {
+    if (initDone && (channelId < UART_DRV_CHANNEL_COUNT))
+    {
+        status.portBuffers[channelId].txSpaceRequested = numChars;
+    }
+}
+
+
 uint16_t UART_Drv_ReadPort(const UART_Drv_Channel_t channelId) {
     uint16_t newCharacter = 0;
 
@@ -224,6 +239,18 @@ uint16_t UART_Drv_ReadChar(const UART_Drv_Channel_t channelId) {
     return (newCharacter);
 }
 
+// Read up to the given number of characters from the RX buffer
+uint16_t UART_Drv_ReadCharArray(const UART_Drv_Channel_t channelId, uint16_t *const data, const uint16_t maxLength) {
+    uint16_t numCharsRead = 0;
+
+    if (initDone && (channelId < UART_DRV_CHANNEL_COUNT))
+    {
+        numCharsRead = RingBuffer_Read(&(status.portBuffers[channelId].rxCircularBuffer), data, maxLength);
+    }
+
+    return (numCharsRead);
+}
+
 /*******************************************************************************
  // Description:
  //    Write a single character to a UART peripheral for transmit.  The number of
@@ -305,12 +332,8 @@ void UART_Drv_Write(const UART_Drv_Channel_t channel, uint16_t *const data, cons
         // Validate the given buffer
         if (data != 0)
         {
-            // Loop through the given data and add to the circular buffer
-            for (uint16_t i = 0U; i < length; i++)
-            {
-                // Put given byte in TX buffer
-                RingBuffer_WriteChar(&(status.portBuffers[channel].txCircularBuffer), *(data + i));
-            }
+            // Add the given data to the circular buffer in one copy
+            (void)RingBuffer_Write(&(status.portBuffers[channel].txCircularBuffer), data, length);
 
             // See if there is data to send and we are idle
             if ((RingBuffer_GetDataLength(&(status.portBuffers[channel].txCircularBuffer)) > 0) && (UART_Drv_GetNumCharsTX(channel) > 0))
@@ -321,25 +344,13 @@ void UART_Drv_Write(const UART_Drv_Channel_t channel, uint16_t *const data, cons
                 // Interrupt_enable(localUartConfig->channelConfigArray[channel].txIRQConfig.interruptNumber);
                 // Then trigger the transmit buffer interrupt?
 
-                // Variable where new byte is stored
-                uint16_t tmpByte = 0;
+                // Bytes dequeued for the first write
+                uint16_t tmpBuffer[UART_DRV_FIFO_TX_SIZE];
 
-                // Trigger the first write
-                for (int i = 0; i < 16; i++)
-                {
-                    if (RingBuffer_ReadChar(&(status.portBuffers[channel].txCircularBuffer), &tmpByte))
-                    {
-                        // Byte successfully dequeued from the TX buffer, send it
-                        // TODO Check is full?
-                        if (!UART_Drv_WriteChar(channel, tmpByte))
-                        {
-                            break;
-                        }
-                    } else
-                    {
-                        break;
-                    }
-                }
+                // Trigger the first write with as much as the TX FIFO can take
+                uint16_t numChars = RingBuffer_Read(&(status.portBuffers[channel].txCircularBuffer), tmpBuffer,
+                                                    UART_Drv_GetNumCharsTX(channel));
+                (void)UART_Drv_WriteCharArray(channel, tmpBuffer, numChars);
             }
         }
     }
@@ -421,25 +432,44 @@ void initSCIFIFO(const UART_Drv_Channel_t channelId) {
 
 bool UART_Drv_Init(const uint32_t moduleId, const UART_Drv_Config_t *configPtr)
 {
+    bool isValid = false;
+
     // Configure the pins specified by the board configuration
     // First, validate the given parameter is valid
-    if ((configPtr) && (configPtr->dataPtr))
+    // Every enumerated channel must be configured, in order, since each is polled
+    if ((configPtr) && (configPtr->dataPtr) && (configPtr->numConfigItems == (uint32_t)UART_DRV_CHANNEL_COUNT))
     {
+        isValid = true;
+
         // Store the configuration data for later use
         status.uartConfig = configPtr;
 
-        // Loop through the UART configuration and configure each channel
+        // The buffers of every channel must be valid before any channel is used
         for (uint32_t channelId = 0; channelId < status.uartConfig->numConfigItems; channelId++)
         {
             // Buffer Config ---
             // Store the buffer object for easy access
             PortBuffers_t *portBuffer = &(status.portBuffers[channelId]);
+            const UART_Drv_Data_t *const channelConfig = &(status.uartConfig->dataPtr[channelId]);
 
             // Initialize the Circular TX Buffer
-            RingBuffer_Init(&(portBuffer->txCircularBuffer), portBuffer->txCircularBufferData, sizeof(portBuffer->txCircularBufferData));
-            // Initialize the Circular RX Buffer
-            RingBuffer_Init(&(portBuffer->rxCircularBuffer), portBuffer->rxCircularBufferData, sizeof(portBuffer->rxCircularBufferData));
+            isValid &= RingBuffer_Init(&(portBuffer->txCircularBuffer), channelConfig->txBuffer, channelConfig->txBufferSize,
+                                       RINGBUFFER_OVERFLOW_OVERWRITE);
+            // Initialize the Circular RX Buffer -- new data is dropped when full.
+            // There is no flow control, so this keeps the frames already
+            // waiting whole rather than overwriting the oldest of them.
+            isValid &= RingBuffer_Init(&(portBuffer->rxCircularBuffer), channelConfig->rxBuffer, channelConfig->rxBufferSize,
+                                       RINGBUFFER_OVERFLOW_COUNT_DROPS);
+            portBuffer->txSpaceRequested = 0U;
+            isValid &= (channelConfig->channelId == (UART_Drv_Channel_t)channelId);
+        }
+    }
 
+    if (isValid)
+    {
+        // Loop through the UART configuration and configure each channel
+        for (uint32_t channelId = 0; channelId < status.uartConfig->numConfigItems; channelId++)
+        {
             // UART Config---
 
             // TODO
@@ -465,45 +495,84 @@ bool UART_Drv_Init(const uint32_t moduleId, const UART_Drv_Config_t *configPtr)
             // TODO: Convert to group from interrupt number
             Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP9);
 #endif
-            initDone = true;
         }
+
+        initDone = true;
     }
 
-    return (true);
+    return (isValid);
 }
 
 
 void UART_Drv_Update(void) {
+    if (initDone)
+    {
+        // Every channel is served on each update. Each is bounded by the size
+        // of its FIFOs, so a busy channel cannot hold up the others.
+        for (uint16_t channelId = 0U; channelId < (uint16_t)UART_DRV_CHANNEL_COUNT; channelId++)
+        {
+            const UART_Drv_Data_t *const channelConfig = &(status.uartConfig->dataPtr[channelId]);
+            PortBuffers_t *const portBuffer = &(status.portBuffers[channelId]);
 
-    // Read any waiting data
-    // This handles slower data if the FIFO is not yet full
+            // Read any waiting data
+            // This handles slower data if the FIFO is not yet full
 
-    // Handle RX Error -- must reset peripheral
-    uint16_t rxStatus = SCI_getRxStatus(SCIA_BASE);
-    //SCI_clear
-    if ((SCI_RXSTATUS_ERROR & rxStatus))
-    {
-        //while(1);
-        // TODO: PERFORM SW RESET INSTEAD?
-        SCI_performSoftwareReset(SCIA_BASE);
-        //SCI_resetChannels(SCIA_BASE);
-    }
+            // Handle RX Error -- must reset peripheral
+            uint16_t rxStatus = SCI_getRxStatus(channelConfig->uartBase);
+            //SCI_clear
+            if ((SCI_RXSTATUS_ERROR & rxStatus))
+            {
+                //while(1);
+                // TODO: PERFORM SW RESET INSTEAD?
+                SCI_performSoftwareReset(channelConfig->uartBase);
+                //SCI_resetChannels(channelConfig->uartBase);
+            }
 
-    // Polled UART to avoid ISRs on main core
-    // Read RC FIFIO characters into ring buffer -- old data is discarded
-    while (UART_Drv_GetNumCharsRX(UART_DRV_CHANNEL_DEBUG))
-    {
-        uint16_t newChar = SCI_readCharNonBlocking(SCIA_BASE);
-        RingBuffer_WriteChar(&(status.portBuffers[UART_DRV_CHANNEL_DEBUG].rxCircularBuffer), newChar);
-    }
+            // Polled UART to avoid ISRs on main core
+            // Read RC FIFIO characters into ring buffer -- new data is dropped when full
+            bool isDelimiterReceived = false;
+            uint16_t fifoBuffer[UART_DRV_FIFO_RX_SIZE];
+            uint16_t numChars = UART_Drv_GetNumCharsRX((UART_Drv_Channel_t)channelId);
 
-    // Get next byte data from circular buffer, if any
-    uint16_t newChar;
-    while ((SCI_getTxFIFOStatus(SCIA_BASE) < SCI_FIFO_TX16) && (RingBuffer_ReadChar(&(status.portBuffers[UART_DRV_CHANNEL_DEBUG].txCircularBuffer), &newChar)))
-    {
-        // Byte successfully dequeued from the TX buffer, send it
-        //UART_Drv_WriteChar(UART_DRV_CHANNEL_DEBUG, tmpByte);
-        SCI_writeCharNonBlocking(SCIA_BASE, newChar);
+            if (numChars > UART_DRV_FIFO_RX_SIZE)
+            {
+                numChars = UART_DRV_FIFO_RX_SIZE;
+            }
+            for (uint16_t i = 0U; i < numChars; i++)
+            {
+                fifoBuffer[i] = SCI_readCharNonBlocking(channelConfig->uartBase);
+
+                isDelimiterReceived |= (fifoBuffer[i] == channelConfig->rxDelimiter) ||
+                                       (fifoBuffer[i] == channelConfig->rxAltDelimiter);
+            }
+            (void)RingBuffer_Write(&(portBuffer->rxCircularBuffer), fifoBuffer, numChars);
+
+            // Notify the consumer once per update that a complete frame is waiting
+            if (isDelimiterReceived && (NULL != channelConfig->rxDelimiterCallback))
+            {
+                channelConfig->rxDelimiterCallback();
+            }
+
+            // Move as much waiting TX data as the FIFO can take, if any
+            numChars = RingBuffer_Read(&(portBuffer->txCircularBuffer), fifoBuffer,
+                                       UART_Drv_GetNumCharsTX((UART_Drv_Channel_t)channelId));
+            for (uint16_t i = 0U; i < numChars; i++)
+            {
+                // Byte successfully dequeued from the TX buffer, send it
+                SCI_writeCharNonBlocking(channelConfig->uartBase, fifoBuffer[i]);
+            }
+
+            // Wake a sender that is waiting for room
+            if ((0U != portBuffer->txSpaceRequested) &&
+                (UART_Drv_GetTxBufferSpace((UART_Drv_Channel_t)channelId) >= portBuffer->txSpaceRequested))
+            {
+                portBuffer->txSpaceRequested = 0U;
+                if (NULL != channelConfig->txSpaceCallback)
+                {
+                    channelConfig->txSpaceCallback();
+                }
+            }
+        }
     }
 }
 
@@ -0,0 +1,351 @@
+/*******************************************************************************
+// Hex Codec Library
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "HexLib.h"
+// Platform Includes
+#include "MessageRouter.h"
+#include "Timebase.h" // Cycle counter used by the benchmark
+// Other Includes
+#include <stdbool.h> // Defines C99 boolean type
+#include <stdint.h>
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// Set in a decoded character that is not a hex digit. Any bit above the
+// nibble marks an error, which lets a whole buffer be checked at the end.
+#define INVALID_NIBBLE (0x10U)
+
+// Characters above the decode table are never hex digits
+#define DECODE_TABLE_LENGTH (128U)
+
+// The number of bytes converted by the benchmark command, a full serial response
+#define BENCHMARK_DATA_LENGTH (48U)
+
+// Step between the words of the benchmark data
+#define BENCHMARK_DATA_STEP (0x9E37U)
+
+// The ASCII character for a nibble
+#define HEX_CHAR(n) ((uint16_t)(((n) < 10U) ? ((n) + 0x30U) : ((n) + 0x37U)))
+
+// Both characters for a byte, the first in the high 8 bits
+#define HEX_PAIR(b) ((uint16_t)((HEX_CHAR((uint16_t)(b) >> 4U) << 8U) | HEX_CHAR((uint16_t)(b) & 0x0FU)))
+
+// The characters for 16 consecutive bytes
+#define HEX_PAIR_ROW(b) \
+   HEX_PAIR((b) + 0x0U), HEX_PAIR((b) + 0x1U), HEX_PAIR((b) + 0x2U), HEX_PAIR((b) + 0x3U), \
+   HEX_PAIR((b) + 0x4U), HEX_PAIR((b) + 0x5U), HEX_PAIR((b) + 0x6U), HEX_PAIR((b) + 0x7U), \
+   HEX_PAIR((b) + 0x8U), HEX_PAIR((b) + 0x9U), HEX_PAIR((b) + 0xAU), HEX_PAIR((b) + 0xBU), \
+   HEX_PAIR((b) + 0xCU), HEX_PAIR((b) + 0xDU), HEX_PAIR((b) + 0xEU), HEX_PAIR((b) + 0xFU)
+
+// The nibble for an ASCII character, or INVALID_NIBBLE
+#define HEX_VALUE(c) \
+   ((uint16_t)((((c) >= 0x30U) && ((c) <= 0x39U)) ? ((c) - 0x30U) : \
+               (((c) >= 0x41U) && ((c) <= 0x46U)) ? ((c) - 0x37U) : \
+               (((c) >= 0x61U) && ((c) <= 0x66U)) ? ((c) - 0x57U) : INVALID_NIBBLE))
+
+// The nibbles for 16 consecutive characters
+#define HEX_VALUE_ROW(c) \
+   HEX_VALUE((c) + 0x0U), HEX_VALUE((c) + 0x1U), HEX_VALUE((c) + 0x2U), HEX_VALUE((c) + 0x3U), \
+   HEX_VALUE((c) + 0x4U), HEX_VALUE((c) + 0x5U), HEX_VALUE((c) + 0x6U), HEX_VALUE((c) + 0x7U), \
+   HEX_VALUE((c) + 0x8U), HEX_VALUE((c) + 0x9U), HEX_VALUE((c) + 0xAU), HEX_VALUE((c) + 0xBU), \
+   HEX_VALUE((c) + 0xCU), HEX_VALUE((c) + 0xDU), HEX_VALUE((c) + 0xEU), HEX_VALUE((c) + 0xFU)
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// Both characters for each byte value, the first in the high 8 bits
+static const uint16_t hexEncodeTable[256] = {
+   HEX_PAIR_ROW(0x00U), HEX_PAIR_ROW(0x10U), HEX_PAIR_ROW(0x20U), HEX_PAIR_ROW(0x30U),
+   HEX_PAIR_ROW(0x40U), HEX_PAIR_ROW(0x50U), HEX_PAIR_ROW(0x60U), HEX_PAIR_ROW(0x70U),
+   HEX_PAIR_ROW(0x80U), HEX_PAIR_ROW(0x90U), HEX_PAIR_ROW(0xA0U), HEX_PAIR_ROW(0xB0U),
+   HEX_PAIR_ROW(0xC0U), HEX_PAIR_ROW(0xD0U), HEX_PAIR_ROW(0xE0U), HEX_PAIR_ROW(0xF0U)
+};
+
+// The nibble for each 7-bit character, or INVALID_NIBBLE
+static const uint16_t hexDecodeTable[DECODE_TABLE_LENGTH] = {
+   HEX_VALUE_ROW(0x00U), HEX_VALUE_ROW(0x10U), HEX_VALUE_ROW(0x20U), HEX_VALUE_ROW(0x30U),
+   HEX_VALUE_ROW(0x40U), HEX_VALUE_ROW(0x50U), HEX_VALUE_ROW(0x60U), HEX_VALUE_ROW(0x70U)
+};
+
+// Buffers used by the benchmark command
+static uint16_t testData[BENCHMARK_DATA_LENGTH / 2U];
+static uint16_t testChars[HEXLIB_CHARS_PER_BYTE * BENCHMARK_DATA_LENGTH];
+static uint16_t testResult[BENCHMARK_DATA_LENGTH / 2U];
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+ *    Returns the nibble for a character. Any bit above the nibble is set if
+ *    the character is not a hex digit.
+ */
+static inline uint16_t DecodeChar(const uint16_t hexChar);
+
+/** Description:
+ *    Converts bytes to hex a nibble at a time with compare and branch, the
+ *    method used before the tables. Kept as the reference for the benchmark
+ *    command.
+ */
+static void EncodeNibblewise(uint16_t *const hexChars, const uint16_t *const data, const uint16_t numBytes);
+
+/** Description:
+ *    Converts hex to bytes a nibble at a time with compare and branch, the
+ *    method used before the tables. Malformed characters are converted as 0.
+ */
+static void DecodeNibblewise(uint16_t *const data, const uint16_t *const hexChars, const uint16_t numBytes);
+
+/** Description:
+ *    Fills the test data with a pattern that holds every nibble value.
+ */
+static void FillTestData(void);
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+static inline uint16_t DecodeChar(const uint16_t hexChar)
+{
+   return (hexDecodeTable[hexChar & (DECODE_TABLE_LENGTH - 1U)] | (hexChar & (uint16_t)~(DECODE_TABLE_LENGTH - 1U)));
+}
+
+static void EncodeNibblewise(uint16_t *const hexChars, const uint16_t *const data, const uint16_t numBytes)
+{
+   for (uint16_t i = 0U; i < (HEXLIB_CHARS_PER_BYTE * numBytes); i++)
+   {
+      // Even characters are the high nibble of a byte
+      const uint16_t byte = (data[i / 4U] >> ((0U != (i & 2U)) ? 8U : 0U)) & 0xFFU;
+      const uint16_t nibble = (0U == (i & 1U)) ? (byte >> 4U) : (byte & 0x0FU);
+
+      if (nibble < 10U)
+      {
+         hexChars[i] = nibble + 0x30U;
+      }
+      else
+      {
+         hexChars[i] = nibble + 0x37U;
+      }
+   }
+}
+
+static void DecodeNibblewise(uint16_t *const data, const uint16_t *const hexChars, const uint16_t numBytes)
+{
+   for (uint16_t i = 0U; i < ((numBytes + 1U) / 2U); i++)
+   {
+      data[i] = 0U;
+   }
+
+   for (uint16_t i = 0U; i < (HEXLIB_CHARS_PER_BYTE * numBytes); i++)
+   {
+      const uint16_t hexChar = hexChars[i];
+      uint16_t nibble = 0U;
+
+      if ((hexChar > 0x40U) && (hexChar < 0x47U))
+      {
+         nibble = hexChar - 0x37U;
+      }
+      else if ((hexChar > 0x60U) && (hexChar < 0x67U))
+      {
+         nibble = hexChar - 0x57U;
+      }
+      else if ((hexChar > 0x2FU) && (hexChar < 0x3AU))
+      {
+         nibble = hexChar - 0x30U;
+      }
+
+      // Even characters are the high nibble of a byte
+      data[i / 4U] |= nibble << (((0U != (i & 2U)) ? 8U : 0U) + ((0U == (i & 1U)) ? 4U : 0U));
+   }
+}
+
+static void FillTestData(void)
+{
+   for (uint16_t i = 0U; i < (BENCHMARK_DATA_LENGTH / 2U); i++)
+   {
+      testData[i] = (uint16_t)(i * BENCHMARK_DATA_STEP);
+   }
+}
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+void HexLib_Encode(uint16_t *const hexChars, const uint16_t *const data, const uint16_t numBytes)
+{
+   if ((hexChars != 0) && (data != 0))
+   {
+      const uint16_t *pWord = data;
+      uint16_t *pChar = hexChars;
+
+      // Both bytes of a word are converted in one step, low byte first
+      for (uint16_t i = numBytes / 2U; i != 0U; --i, ++pWord, pChar += 4)
+      {
+         const uint16_t lowPair = hexEncodeTable[*pWord & 0xFFU];
+         const uint16_t highPair = hexEncodeTable[(*pWord >> 8U) & 0xFFU];
+
+         pChar[0] = lowPair >> 8U;
+         pChar[1] = lowPair & 0xFFU;
+         pChar[2] = highPair >> 8U;
+         pChar[3] = highPair & 0xFFU;
+      }
+
+      // An odd length ends with the low byte of the next word
+      if (0U != (numBytes & 1U))
+      {
+         const uint16_t lowPair = hexEncodeTable[*pWord & 0xFFU];
+
+         pChar[0] = lowPair >> 8U;
+         pChar[1] = lowPair & 0xFFU;
+      }
+   }
+}
+
+bool HexLib_Decode(uint16_t *const data, const uint16_t *const hexChars, const uint16_t numBytes)
+{
+   // The bits above the nibble of every decoded character
+   uint16_t errorFlags = 0U;
+
+   if ((data != 0) && (hexChars != 0))
+   {
+      const uint16_t *pChar = hexChars;
+      uint16_t *pWord = data;
+
+      // Both bytes of a word are converted in one step, low byte first
+      for (uint16_t i = numBytes / 2U; i != 0U; --i, ++pWord, pChar += 4)
+      {
+         const uint16_t nibble0 = DecodeChar(pChar[0]);
+         const uint16_t nibble1 = DecodeChar(pChar[1]);
+         const uint16_t nibble2 = DecodeChar(pChar[2]);
+         const uint16_t nibble3 = DecodeChar(pChar[3]);
+
+         errorFlags |= nibble0 | nibble1 | nibble2 | nibble3;
+         *pWord = (uint16_t)(((nibble2 & 0x0FU) << 12U) | ((nibble3 & 0x0FU) << 8U) |
+                             ((nibble0 & 0x0FU) << 4U) | (nibble1 & 0x0FU));
+      }
+
+      // An odd length ends with the low byte of the next word
+      if (0U != (numBytes & 1U))
+      {
+         const uint16_t nibble0 = DecodeChar(pChar[0]);
+         const uint16_t nibble1 = DecodeChar(pChar[1]);
+
+         errorFlags |= nibble0 | nibble1;
+         *pWord = (uint16_t)(((nibble0 & 0x0FU) << 4U) | (nibble1 & 0x0FU));
+      }
+   }
+   else
+   {
+      errorFlags = INVALID_NIBBLE;
+   }
+
+   return (0U == (errorFlags & (uint16_t)~0x0FU));
+}
+
+bool HexLib_DecodeValue(uint16_t *const value, const uint16_t *const hexChars, const uint16_t numChars)
+{
+   uint16_t errorFlags = INVALID_NIBBLE;
+
+   if ((value != 0) && (hexChars != 0) && (numChars <= 4U))
+   {
+      uint16_t result = 0U;
+
+      errorFlags = 0U;
+      for (uint16_t i = 0U; i < numChars; i++)
+      {
+         const uint16_t nibble = DecodeChar(hexChars[i]);
+
+         errorFlags |= nibble;
+         result = (uint16_t)(result << 4U) | (nibble & 0x0FU);
+      }
+
+      *value = result;
+   }
+
+   return (0U == (errorFlags & (uint16_t)~0x0FU));
+}
+
+// Compare the table and nibble at a time methods
+void HexLib_MessageRouter_Benchmark(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the response. Divide the cycles by
+   // the number of bytes for the cost per byte.
+   typedef struct
+   {
+      // The number of bytes converted by each method
+      uint32_t numBytes;
+      // Cycles taken by HexLib_Encode()
+      uint32_t encodeCycles;
+      // Cycles taken by HexLib_Decode()
+      uint32_t decodeCycles;
+      // Cycles taken to encode a nibble at a time
+      uint32_t nibbleEncodeCycles;
+      // Cycles taken to decode a nibble at a time
+      uint32_t nibbleDecodeCycles;
+      // 1 if both methods gave the same results, 0 otherwise
+      uint16_t isMatch;
+      // Padding for alignment
+      uint16_t dummy;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      Timebase_CycleCount_t startCycles;
+      bool isMatch;
+
+      FillTestData();
+
+      startCycles = Timebase_GetCycleCount();
+      EncodeNibblewise(testChars, testData, BENCHMARK_DATA_LENGTH);
+      response->nibbleEncodeCycles = Timebase_GetCycleCount() - startCycles;
+
+      startCycles = Timebase_GetCycleCount();
+      DecodeNibblewise(testResult, testChars, BENCHMARK_DATA_LENGTH);
+      response->nibbleDecodeCycles = Timebase_GetCycleCount() - startCycles;
+
+      startCycles = Timebase_GetCycleCount();
+      HexLib_Encode(testChars, testData, BENCHMARK_DATA_LENGTH);
+      response->encodeCycles = Timebase_GetCycleCount() - startCycles;
+
+      startCycles = Timebase_GetCycleCount();
+      isMatch = HexLib_Decode(testData, testChars, BENCHMARK_DATA_LENGTH);
+      response->decodeCycles = Timebase_GetCycleCount() - startCycles;
+
+      // The nibble method decoded its own encoding of the same data
+      for (uint16_t i = 0U; i < (BENCHMARK_DATA_LENGTH / 2U); i++)
+      {
+         isMatch = isMatch && (testResult[i] == testData[i]);
+      }
+
+      response->numBytes = BENCHMARK_DATA_LENGTH;
+      response->isMatch = isMatch ? 1U : 0U;
+      response->dummy = 0U;
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
@@ -0,0 +1,87 @@
+/*******************************************************************************
+// Hex Codec Library
+// Converts between binary data and ASCII-coded hex (0x0F = "0F") a buffer at a
+// time using lookup tables. Binary data is packed two bytes per 16-bit word
+// with the low byte first, the layout of __byte() and of Message Router
+// buffers. Characters are held one per 16-bit word, as they are read from and
+// written to the UART driver.
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+// Platform Includes
+#include "MessageRouter.h"
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The number of characters used for each byte ("FF")
+#define HEXLIB_CHARS_PER_BYTE (2U)
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/** Description:
+ *    Converts bytes to upper case ASCII-coded hex, high nibble first.
+ * Parameters:
+ *    hexChars - The buffer for the result. It must hold
+ *       HEXLIB_CHARS_PER_BYTE * numBytes characters.
+ *    data - The bytes to be converted, packed low byte first
+ *    numBytes - The number of bytes to be converted
+ */
+void HexLib_Encode(uint16_t *const hexChars, const uint16_t *const data, const uint16_t numBytes);
+
+/** Description:
+ *    Converts ASCII-coded hex to bytes. Upper and lower case digits are
+ *    accepted. Every character is converted even if some are malformed, so
+ *    the result must be discarded when false is returned.
+ * Parameters:
+ *    data - The buffer for the result, packed low byte first. If numBytes is
+ *       odd, the high byte of the last word is cleared.
+ *    hexChars - The characters to be converted, HEXLIB_CHARS_PER_BYTE per byte
+ *    numBytes - The number of bytes to be produced
+ * Returns:
+ *    bool - true if every character was a hex digit
+ */
+bool HexLib_Decode(uint16_t *const data, const uint16_t *const hexChars, const uint16_t numBytes);
+
+/** Description:
+ *    Converts up to 4 ASCII-coded hex characters to a single value, most
+ *    significant digit first. Used for the fields of a message header.
+ * Parameters:
+ *    value - Holds the result. Malformed characters are converted as 0.
+ *    hexChars - The characters to be converted
+ *    numChars - The number of characters to be converted (Max 4)
+ * Returns:
+ *    bool - true if every character was a hex digit and numChars is valid
+ */
+bool HexLib_DecodeValue(uint16_t *const value, const uint16_t *const hexChars, const uint16_t numChars);
+
+/** Description:
+ *    This is the command handler used for measuring the cost in cycles of
+ *    encoding and decoding a full serial response with the tables and with
+ *    the previous nibble at a time method.
+ * Parameters:
+ *    message :  A pointer to a common Message Router message
+ *               object. The response is expected to be placed in
+ *               this object.
+ */
+void HexLib_MessageRouter_Benchmark(MessageRouter_Message_t *const message);
+
+#ifdef __cplusplus
+}
+#endif
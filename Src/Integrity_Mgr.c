@@ -0,0 +1,461 @@
+/*******************************************************************************
+// Integrity Manager
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "Integrity_Mgr.h"
+#include "Integrity_Mgr_Config.h"
+#include "Integrity_Mgr_ConfigTypes.h"
+// Platform Includes
+#include "Error_Mgr.h"
+#include "MemoryCRC_Drv.h"
+#include "MessageRouter.h"
+// Other Includes
+#include <stdbool.h> // Defines C99 boolean type
+#include <stddef.h> // NULL
+#include <stdint.h> // Defines C99 integer types
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// Use the background CRC engine where it exists. Other builds calculate each
+// chunk in software with the same CRC so the chunking can be checked on a host.
+// The partial block at the end of a region is always calculated in software.
+#if defined(__TMS320C28XX__)
+#define USE_MEMORYCRC_DRV (1)
+#else
+#define USE_MEMORYCRC_DRV (0)
+#endif
+
+// The starting CRC of each region
+#define INTEGRITY_CRC_SEED (0x00000000UL)
+
+// The CRC32 polynomial used by the background CRC engine
+#define INTEGRITY_CRC_POLYNOMIAL (0x04C11DB7UL)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure defines the internal variables used by the module
+typedef struct
+{
+    // Module Id given to this module at Initialization
+    uint16_t moduleId;
+
+    // Configuration Table passed at Initialization
+    const Integrity_Mgr_Config_t *integrityConfig;
+
+    // Initialization state for the module
+    bool isInitialized;
+
+    // Index in the configuration of the region being checked
+    uint16_t regionIndex;
+
+    // Words of the current region read so far
+    uint32_t offsetWords;
+
+    // The CRC of the words read so far
+    uint32_t crc;
+
+    // Set while a chunk is being read
+    bool isChunkRunning;
+
+    // The number of words in the chunk being read
+    uint32_t chunkNumWords;
+
+    // Set if the chunk being read was calculated in software
+    bool isChunkSoftware;
+
+    // The result of the chunk calculated in software
+    uint32_t softwareCrc;
+
+    // Results of each region
+    Integrity_Mgr_RegionStatus_t regionStatus[INTEGRITY_MGR_REGION_ID_COUNT];
+} Integrity_Mgr_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The variable used for holding all internal data for this module.
+static Integrity_Mgr_Status_t status;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    Returns the number of 16-bit words in a region.
+*/
+static uint32_t GetRegionNumWords(const Integrity_Mgr_RegionConfig_t *const region);
+
+/** Description:
+  *    Checks that a region has a known identifier, a CRC, at least one word
+  *    and, for the engine, a start aligned to a block. Other regions are
+  *    skipped.
+*/
+static bool IsRegionValid(const Integrity_Mgr_RegionConfig_t *const region);
+
+/** Description:
+  *    Moves on to the next valid region, back to the first after the last.
+*/
+static void NextRegion(void);
+
+/** Description:
+  *    Starts reading the next chunk of the current region.
+  * Returns:
+  *    bool - false if the chunk could not be started and should be tried
+  *    again on the next pass
+*/
+static bool StartChunk(void);
+
+/** Description:
+  *    Checks if the last chunk started is still being read.
+*/
+static bool IsChunkRunning(void);
+
+/** Description:
+  *    Returns the CRC of the words read so far, including the last chunk.
+*/
+static uint32_t GetChunkResult(void);
+
+/** Description:
+  *    Compares the CRC of the completely read current region with its
+  *    expected CRC and moves on to the next region.
+*/
+static void CompleteRegion(void);
+
+/** Description:
+  *    Calculates the same CRC as the background CRC engine: CRC32 with the
+  *    polynomial 0x04C11DB7, no reflection, processing the low byte of each
+  *    16-bit word before the high byte.
+*/
+static uint32_t CalculateSoftware(const uint32_t crcSeed, const uint16_t *data, const uint32_t numWords);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+static uint32_t GetRegionNumWords(const Integrity_Mgr_RegionConfig_t *const region)
+{
+   return((uint32_t)(region->endAddress - region->startAddress));
+}
+
+static bool IsRegionValid(const Integrity_Mgr_RegionConfig_t *const region)
+{
+   bool isValid = (region->regionId < INTEGRITY_MGR_REGION_ID_COUNT) && (NULL != region->expectedCrc) &&
+                  (region->endAddress > region->startAddress);
+
+#if USE_MEMORYCRC_DRV
+   // The engine reads blocks from an aligned address
+   isValid = isValid && (0UL == ((uint32_t)(uintptr_t)region->startAddress % MEMORYCRC_DRV_BLOCK_NUM_WORDS));
+#endif
+
+   return(isValid);
+}
+
+static void NextRegion(void)
+{
+   // Init() makes sure at least one region is valid
+   do
+   {
+      status.regionIndex++;
+      if (status.regionIndex >= status.integrityConfig->numConfigItems)
+      {
+         status.regionIndex = 0U;
+      }
+   } while (!IsRegionValid(&status.integrityConfig->regionConfigArray[status.regionIndex]));
+
+   status.offsetWords = 0UL;
+   status.crc = INTEGRITY_CRC_SEED;
+}
+
+static bool StartChunk(void)
+{
+   const Integrity_Mgr_RegionConfig_t *const region = &status.integrityConfig->regionConfigArray[status.regionIndex];
+   const uint32_t remainingWords = GetRegionNumWords(region) - status.offsetWords;
+   const uint32_t maxChunkWords = (uint32_t)status.integrityConfig->blocksPerPass * MEMORYCRC_DRV_BLOCK_NUM_WORDS;
+
+   bool isStarted = true;
+
+   status.chunkNumWords = (remainingWords < maxChunkWords) ? remainingWords : maxChunkWords;
+
+   // The engine only reads whole blocks. The words after the last whole
+   // block, which need only be read once per check of the region, are read
+   // on their own by the CPU.
+   status.isChunkSoftware = (!USE_MEMORYCRC_DRV || (status.chunkNumWords < MEMORYCRC_DRV_BLOCK_NUM_WORDS));
+   if (!status.isChunkSoftware)
+   {
+      status.chunkNumWords -= status.chunkNumWords % MEMORYCRC_DRV_BLOCK_NUM_WORDS;
+   }
+
+   if (status.isChunkSoftware)
+   {
+      status.softwareCrc = CalculateSoftware(status.crc, region->startAddress + status.offsetWords, status.chunkNumWords);
+   }
+#if USE_MEMORYCRC_DRV
+   else
+   {
+      isStarted = MemoryCRC_Drv_Start((uint32_t)(region->startAddress + status.offsetWords),
+                                      (uint16_t)(status.chunkNumWords / MEMORYCRC_DRV_BLOCK_NUM_WORDS), status.crc);
+   }
+#endif
+
+   return(isStarted);
+}
+
+static bool IsChunkRunning(void)
+{
+#if USE_MEMORYCRC_DRV
+   return(!status.isChunkSoftware && MemoryCRC_Drv_IsBusy());
+#else
+   return(false);
+#endif
+}
+
+static uint32_t GetChunkResult(void)
+{
+#if USE_MEMORYCRC_DRV
+   return(status.isChunkSoftware ? status.softwareCrc : MemoryCRC_Drv_GetResult());
+#else
+   return(status.softwareCrc);
+#endif
+}
+
+static void CompleteRegion(void)
+{
+   const Integrity_Mgr_RegionConfig_t *const region = &status.integrityConfig->regionConfigArray[status.regionIndex];
+   Integrity_Mgr_RegionStatus_t *const regionStatus = &status.regionStatus[region->regionId];
+
+   regionStatus->numChecks++;
+   regionStatus->calculatedCrc = status.crc;
+   regionStatus->expectedCrc = *region->expectedCrc;
+   regionStatus->isMatch = (regionStatus->calculatedCrc == regionStatus->expectedCrc);
+
+   if (!regionStatus->isMatch)
+   {
+      // Memory does not repair itself, so the error is left set
+      regionStatus->numFailures++;
+      Error_Mgr_SetErrorState(status.moduleId, ERROR_MGR_ERROR_INTEGRITY, true);
+   }
+
+   NextRegion();
+}
+
+static uint32_t CalculateSoftware(const uint32_t crcSeed, const uint16_t *data, const uint32_t numWords)
+{
+   uint32_t crc = crcSeed;
+
+   for (uint32_t wordIndex = 0UL; wordIndex < numWords; wordIndex++)
+   {
+      // Low byte first, then the high byte
+      const uint16_t word = data[wordIndex];
+
+      for (uint16_t byteIndex = 0U; byteIndex < 2U; byteIndex++)
+      {
+         const uint16_t byte = (byteIndex == 0U) ? (word & 0x00FFU) : (word >> 8U);
+
+         crc ^= (uint32_t)byte << 24U;
+         for (uint16_t bitIndex = 0U; bitIndex < 8U; bitIndex++)
+         {
+            crc = (0UL != (crc & 0x80000000UL)) ? ((crc << 1U) ^ INTEGRITY_CRC_POLYNOMIAL) : (crc << 1U);
+         }
+      }
+   }
+
+   return(crc);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Module initialization
+bool Integrity_Mgr_Init(const uint32_t moduleId, const Integrity_Mgr_Config_t *configPtr)
+{
+   // Default module to uninitialized
+   status.isInitialized = false;
+   // Store the module Id for error reporting
+   status.moduleId = (uint16_t)moduleId;
+
+   // First, validate the given parameter is valid
+   if ((NULL != configPtr) && (NULL != configPtr->regionConfigArray) && (configPtr->numConfigItems > 0U) &&
+       (configPtr->blocksPerPass > 0U) && (configPtr->blocksPerPass <= MEMORYCRC_DRV_MAX_NUM_BLOCKS))
+   {
+      uint16_t numValidRegions = 0U;
+
+      // A region that cannot be checked is skipped and reported, so a bad
+      // entry in the linker command file does not stop the other checks
+      for (uint16_t i = 0U; i < configPtr->numConfigItems; i++)
+      {
+         if (IsRegionValid(&configPtr->regionConfigArray[i]))
+         {
+            numValidRegions++;
+         }
+         else
+         {
+            Error_Mgr_SetErrorState(status.moduleId, ERROR_MGR_ERROR_INTEGRITY, true);
+         }
+      }
+
+      if (numValidRegions > 0U)
+      {
+         // Store the given configuration table
+         status.integrityConfig = configPtr;
+
+         //-----------------------------------------------
+         // Local Variable Initialization
+         //-----------------------------------------------
+         for (uint16_t i = 0U; i < INTEGRITY_MGR_REGION_ID_COUNT; i++)
+         {
+            status.regionStatus[i].numChecks = 0UL;
+            status.regionStatus[i].calculatedCrc = 0UL;
+            status.regionStatus[i].expectedCrc = 0UL;
+            status.regionStatus[i].numFailures = 0U;
+            status.regionStatus[i].isMatch = false;
+         }
+
+         // Start with the first valid region
+         status.regionIndex = configPtr->numConfigItems - 1U;
+         NextRegion();
+         status.isChunkRunning = false;
+         status.isChunkSoftware = false;
+
+#if USE_MEMORYCRC_DRV
+         MemoryCRC_Drv_Init();
+#endif
+
+         // Set to initialized
+         status.isInitialized = true;
+      }
+   }
+
+   // Return initialization state
+   return(status.isInitialized);
+}
+
+// Scheduled function for checking the next chunk
+void Integrity_Mgr_Update(void)
+{
+   if (status.isInitialized)
+   {
+      // Collect the last chunk once it has been read
+      if (status.isChunkRunning && !IsChunkRunning())
+      {
+         status.isChunkRunning = false;
+         status.crc = GetChunkResult();
+         status.offsetWords += status.chunkNumWords;
+
+         if (status.offsetWords >= GetRegionNumWords(&status.integrityConfig->regionConfigArray[status.regionIndex]))
+         {
+            CompleteRegion();
+         }
+      }
+
+      // Keep the engine busy between passes
+      if (!status.isChunkRunning)
+      {
+         status.isChunkRunning = StartChunk();
+      }
+   }
+}
+
+// Return the results of a region
+bool Integrity_Mgr_GetRegionStatus(const Integrity_Mgr_RegionId_t regionId,
+                                   Integrity_Mgr_RegionStatus_t *const regionStatus)
+{
+   bool isChecked = false;
+
+   if (status.isInitialized && (regionId < INTEGRITY_MGR_REGION_ID_COUNT))
+   {
+      // Only regions in the configuration are checked
+      for (uint16_t i = 0U; i < status.integrityConfig->numConfigItems; i++)
+      {
+         isChecked = isChecked || (regionId == status.integrityConfig->regionConfigArray[i].regionId);
+      }
+
+      *regionStatus = status.regionStatus[regionId];
+   }
+
+   return(isChecked);
+}
+
+
+/*******************************************************************************
+// Message Router Function Implementations
+*******************************************************************************/
+
+// Get the results of a region
+void Integrity_Mgr_MessageRouter_GetRegionStatus(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+   // This structure defines the format of the command data.
+   typedef struct
+   {
+      // The region to be queried
+      uint16_t regionId;
+   } Command_t;
+
+   // This structure defines the format of the response.
+   typedef struct
+   {
+      // The number of complete checks of the region
+      uint32_t numChecks;
+      // The CRC found by the last complete check
+      uint32_t calculatedCrc;
+      // The CRC stamped into the image at build time
+      uint32_t expectedCrc;
+      // The number of checks that found a mismatch
+      uint16_t numFailures;
+      // 1 if the last complete check matched
+      uint16_t isMatch;
+      // 1 if the region is being checked, 0 if the identifier is not known
+      uint16_t isSuccessful;
+      // Keeps the size a whole number of 32-bit values
+      uint16_t dummy;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      Integrity_Mgr_RegionStatus_t regionStatus = { 0UL, 0UL, 0UL, 0U, false };
+
+      response->isSuccessful = Integrity_Mgr_GetRegionStatus((Integrity_Mgr_RegionId_t)command->regionId, &regionStatus) ? 1U : 0U;
+      response->numChecks = regionStatus.numChecks;
+      response->calculatedCrc = regionStatus.calculatedCrc;
+      response->expectedCrc = regionStatus.expectedCrc;
+      response->numFailures = regionStatus.numFailures;
+      response->isMatch = regionStatus.isMatch ? 1U : 0U;
+      response->dummy = 0U;
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
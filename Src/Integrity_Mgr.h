@@ -0,0 +1,103 @@
+/*******************************************************************************
+// Integrity Manager
+// Checks in the background that the contents of flash and other fixed memory
+// regions still match the CRCs stamped into the image at build time. Each
+// region is checked in chunks, a bounded number of blocks per call, so the
+// check never delays the main loop. A mismatch raises an Error_Mgr error.
+*******************************************************************************/
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Integrity_Mgr_Config.h" // Defines region identifiers
+#include "Integrity_Mgr_ConfigTypes.h" // Defines region configuration structures
+// Platform Includes
+#include "Error_Mgr.h"
+#include "MessageRouter.h"
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Public Types
+*******************************************************************************/
+
+// Common configuration structure passed to the module initialization function
+// Data is generally defined in the board-specific configuration file
+typedef struct
+{
+    // The number of items in the regionConfigArray - calculated by compiler
+    uint16_t numConfigItems;
+    // Region configuration data
+    const Integrity_Mgr_RegionConfig_t *regionConfigArray;
+    // The most 256 byte blocks read by each call of Integrity_Mgr_Update()
+    uint16_t blocksPerPass;
+} Integrity_Mgr_Config_t;
+
+// The results of checking one region
+typedef struct
+{
+    // The number of complete checks of the region
+    uint32_t numChecks;
+    // The CRC found by the last complete check
+    uint32_t calculatedCrc;
+    // The CRC stamped into the image at build time
+    uint32_t expectedCrc;
+    // The number of checks that found a mismatch
+    uint16_t numFailures;
+    // Set if the last complete check matched
+    bool isMatch;
+} Integrity_Mgr_RegionStatus_t;
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function defines the module initialization. A region with an
+  *    unknown identifier, no expected CRC, no words or a start that is not
+  *    aligned to a 256 byte block is skipped, and ERROR_MGR_ERROR_INTEGRITY
+  *    is set for it. Initialization fails only if no region can be checked.
+*/
+bool Integrity_Mgr_Init(const uint32_t moduleId, const Integrity_Mgr_Config_t *configPtr);
+
+
+/** Description:
+  *    The periodic function called by the scheduler. Collects the result of
+  *    the last chunk and starts the next, reading at most blocksPerPass
+  *    blocks. Once a region has been read completely its CRC is compared to
+  *    the expected CRC and ERROR_MGR_ERROR_INTEGRITY is set on a mismatch.
+  *    The error is never cleared by this module.
+*/
+void Integrity_Mgr_Update(void);
+
+
+/** Description:
+  *    Returns the results of checking a region.
+  * Parameters:
+  *    regionId - The region to be queried
+  *    regionStatus - Filled with the results of the region
+  * Returns:
+  *    bool - false if the region is not being checked
+*/
+bool Integrity_Mgr_GetRegionStatus(const Integrity_Mgr_RegionId_t regionId,
+                                   Integrity_Mgr_RegionStatus_t *const regionStatus);
+
+void Integrity_Mgr_MessageRouter_GetRegionStatus(MessageRouter_Message_t *const message);
+
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,103 @@
+/*******************************************************************************
+// Memory CRC Driver
+// Defines the common interface for a CRC32 engine that reads memory in the
+// background, without using the CPU. The check runs over whole blocks and
+// may be split into several runs by using the result of one run as the seed
+// of the next.
+*******************************************************************************/
+// Prevent multiple inclusion of header file
+#pragma once
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+// Platform Includes
+// Other Includes
+#include <stdbool.h> // Defines C99 boolean type
+#include <stdint.h>  // Defines C99 integer types
+
+
+/*******************************************************************************
+// Start C Binding Section for C++ Compilers
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The number of 16-bit words in one block (256 bytes)
+#define MEMORYCRC_DRV_BLOCK_NUM_WORDS (128U)
+
+// The most blocks that can be checked by one run (256KB)
+#define MEMORYCRC_DRV_MAX_NUM_BLOCKS (1024U)
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/*******************************************************************************
+// Description:
+//    Initialize the CRC engine. Errors are reported to the caller through
+//    the calculated CRC, so the engine does not raise an NMI on failure.
+// Parameters:
+//    none
+// Returns:
+//    none
+*******************************************************************************/
+void MemoryCRC_Drv_Init(void);
+
+
+/*******************************************************************************
+// Description:
+//    Starts calculating the CRC32 (polynomial 0x04C11DB7, no reflection) of a
+//    memory range. The calculation continues in the background and the
+//    result is read with MemoryCRC_Drv_GetResult() once
+//    MemoryCRC_Drv_IsBusy() returns false.
+// Parameters:
+//    address - The first address to be checked. Must be aligned to a block.
+//    numBlocks - The number of blocks to be checked, from 1 to
+//       MEMORYCRC_DRV_MAX_NUM_BLOCKS
+//    crcSeed - The starting CRC, the result of the previous run when a range
+//       is checked in several runs
+// Returns:
+//    bool - true if the run was started, false if the engine was busy or the
+//    number of blocks is out of range
+*******************************************************************************/
+bool MemoryCRC_Drv_Start(const uint32_t address, const uint16_t numBlocks, const uint32_t crcSeed);
+
+
+/*******************************************************************************
+// Description:
+//    Checks if a run started by MemoryCRC_Drv_Start() is still in progress.
+// Parameters:
+//    none
+// Returns:
+//    bool - true until the last run has completed
+*******************************************************************************/
+bool MemoryCRC_Drv_IsBusy(void);
+
+
+/*******************************************************************************
+// Description:
+//    Returns the CRC calculated by the last completed run.
+// Parameters:
+//    none
+// Returns:
+//    uint32_t - The calculated CRC
+*******************************************************************************/
+uint32_t MemoryCRC_Drv_GetResult(void);
+
+
+/*******************************************************************************
+// End of C Binding Section
+*******************************************************************************/
+#ifdef __cplusplus
+}
+#endif
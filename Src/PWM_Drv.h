@@ -139,6 +139,14 @@ uint16_t PWM_Drv_GetDeadtime(const PWM_Drv_Channel_t pwmChannelVal);
  */
 void PWM_Drv_SetDeadtime(PWM_Drv_Channel_t pwmChannel, uint16_t deadtime);
 
+/** Description:
+ *    This function clears the PWM time base (TBCTR_ZERO) interrupt so the
+ *    next event can be taken. It is intended to be called from the handler
+ *    of that interrupt.
+ *
+ */
+void PWM_Drv_AcknowledgeInterrupt(void);
+
 
 /*******************************************************************************
 // Command Processor Functions
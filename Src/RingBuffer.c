@@ -13,19 +13,119 @@
 #include <stdint.h>
 
 
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
 
+static bool IsNonZeroPowerOfTwo(const uint32_t valueToCheck);
 
+/** Description:
+ *    Describe the region of the data buffer that starts at the given
+ *    free-running index, splitting it where it wraps.
+ * Parameters:
+ *    ringBuffer - The ring buffer that holds the region
+ *    index - The free-running index of the first element of the region
+ *    length - The number of elements in the region, at most the buffer size
+ *    spans - Where the region is described
+ */
+static void GetSpans(RingBuffer_t *const ringBuffer, const uint16_t index, const uint16_t length,
+                     RingBuffer_Spans_t *const spans);
 
+/** Description:
+ *    Copy elements into the data buffer starting at the given free-running
+ *    index. The copy is made in up to two contiguous parts. The elements are
+ *    stored through a volatile pointer so the compiler keeps them ahead of
+ *    the index update that publishes them.
+ * Parameters:
+ *    ringBuffer - The ring buffer to be written
+ *    index - The free-running index of the first element to be written
+ *    source - The elements to be copied
+ *    length - The number of elements to copy, at most the buffer size
+ */
+static void CopyIn(RingBuffer_t *const ringBuffer, const uint16_t index, const RingBuffer_Data_t *source,
+                   const uint16_t length);
 
+/** Description:
+ *    Copy elements out of the data buffer starting at the given free-running
+ *    index. See CopyIn().
+ * Parameters:
+ *    ringBuffer - The ring buffer to be read
+ *    index - The free-running index of the first element to be read
+ *    destination - Where the elements are copied
+ *    length - The number of elements to copy, at most the buffer size
+ */
+static void CopyOut(RingBuffer_t *const ringBuffer, const uint16_t index, RingBuffer_Data_t *destination,
+                    const uint16_t length);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
 
-static bool IsNonZeroPowerOfTwo(const uint32_t valueToCheck);
 static bool IsNonZeroPowerOfTwo(const uint32_t valueToCheck)
 {
     // (!(x & (x - 1)) && x)
     return (valueToCheck != 0) && ((valueToCheck & (valueToCheck - 1)) == 0);
 }
 
-bool RingBuffer_Init(RingBuffer_t *const ringBuffer, RingBuffer_Data_t *const buffer, const uint16_t powerOfTwoSize)
+static void GetSpans(RingBuffer_t *const ringBuffer, const uint16_t index, const uint16_t length,
+                     RingBuffer_Spans_t *const spans)
+{
+    const uint16_t position = index & (ringBuffer->bufferSize - 1);
+    const uint16_t lengthToEnd = ringBuffer->bufferSize - position;
+
+    // The first span runs from the position to the end of the region or the data buffer
+    spans->data[0] = &ringBuffer->buffer[position];
+    spans->length[0] = (length < lengthToEnd) ? length : lengthToEnd;
+
+    // Anything left continues from the start of the data buffer
+    spans->data[1] = ringBuffer->buffer;
+    spans->length[1] = length - spans->length[0];
+}
+
+static void CopyIn(RingBuffer_t *const ringBuffer, const uint16_t index, const RingBuffer_Data_t *source,
+                   const uint16_t length)
+{
+    RingBuffer_Spans_t spans;
+
+    GetSpans(ringBuffer, index, length, &spans);
+
+    for (uint16_t span = 0; span < 2; span++)
+    {
+        volatile RingBuffer_Data_t *destination = spans.data[span];
+
+        for (uint16_t i = 0; i < spans.length[span]; i++)
+        {
+            *destination++ = *source++;
+        }
+    }
+}
+
+static void CopyOut(RingBuffer_t *const ringBuffer, const uint16_t index, RingBuffer_Data_t *destination,
+                    const uint16_t length)
+{
+    RingBuffer_Spans_t spans;
+
+    GetSpans(ringBuffer, index, length, &spans);
+
+    for (uint16_t span = 0; span < 2; span++)
+    {
+        const volatile RingBuffer_Data_t *source = spans.data[span];
+
+        for (uint16_t i = 0; i < spans.length[span]; i++)
+        {
+            *destination++ = *source++;
+        }
+    }
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+bool RingBuffer_Init(RingBuffer_t *const ringBuffer, RingBuffer_Data_t *const buffer, const uint16_t powerOfTwoSize,
+                     const RingBuffer_OverflowPolicy_t overflowPolicy)
 {
     //Assume failure until initialization is completed
     bool wasSuccessful = false;
@@ -37,6 +137,8 @@ bool RingBuffer_Init(RingBuffer_t *const ringBuffer, RingBuffer_Data_t *const bu
        // Initialize the ring buffer indices
        ringBuffer->readIndex = 0;
        ringBuffer->writeIndex = 0;
+       ringBuffer->dropCount = 0;
+       ringBuffer->overflowPolicy = overflowPolicy;
 
        // Verify the buffer and given size are valid 
        // Because of the optimization, 
@@ -73,17 +175,18 @@ uint16_t RingBuffer_GetDataLength(RingBuffer_t *const ringBuffer)
     if (ringBuffer)
     {
         // Buffer pointer is valid - calculate length
-        // To allow length claculation in a single step, we use an optimzation using AND to elimante sign information
-        // Note that this requires the buffer size to be a power of 2
-        // Ex:  => (WriteIndex=5 - ReadIndex=6) & (BufferSize=8 - 1)
-        //      => [0 1 2 3 4 5 6 7] 
-        //      => [          w r  ] 
-        //      => [+ + + + + - + +]
-        //      => (  5 - 6  ) & (  8 - 1  )
-        //      => (    -1   ) & (    7    )
-        //      => (11111111b) & (00000111b)
-        //      => (00000111b) => 7
-        calculatedLength = (ringBuffer->writeIndex - ringBuffer->readIndex) & (ringBuffer->bufferSize - 1);
+        // The indices are free-running, so the unsigned difference is the number
+        // of elements even after the indices wrap
+        // Ex:  => WriteIndex=2 (wrapped), ReadIndex=65534
+        //      => (  2 - 65534  ) => 4 (modulo 65536)
+        calculatedLength = (uint16_t)(ringBuffer->writeIndex - ringBuffer->readIndex);
+
+        // In overwrite mode the producer may have lapped the consumer. The
+        // replaced elements are skipped by the next read.
+        if (calculatedLength > ringBuffer->bufferSize)
+        {
+            calculatedLength = ringBuffer->bufferSize;
+        }
     }
 
     // Return the calculated length (0 if buffer was invalid)
@@ -95,31 +198,43 @@ bool RingBuffer_WriteChar(RingBuffer_t *const ringBuffer, const RingBuffer_Data_
     // Assume failure until successful write
     bool wasSuccessful = false;
 
-    // Verify buffer parameter and verify buffer has space available, verify data buffer pointer is valid 
-    // Buffer is full at Size-1 since we do not allow write and read to be the same 
+    // Verify buffer parameter and verify data buffer pointer is valid 
     // If buffer size is 0,  this will do nothing (Assumes buffer was set if size is valid)
     if ((ringBuffer) && (ringBuffer->buffer))
     {
-        // See if we are at the maximum buffer size (size - 1)
-        if (RingBuffer_GetDataLength(ringBuffer) >= (ringBuffer->bufferSize - 1))
+        // Only the producer changes the write index, so it can be read once
+        const uint16_t writeIndex = ringBuffer->writeIndex;
+
+        // See if the buffer is full. The read index may still advance, which
+        // only makes more room.
+        if ((uint16_t)(writeIndex - ringBuffer->readIndex) < ringBuffer->bufferSize)
         {
-            // At max size, move read index to make room
-            ringBuffer->readIndex = (ringBuffer->readIndex + 1) & (ringBuffer->bufferSize - 1);
+            wasSuccessful = true;
         }
+        else if (RINGBUFFER_OVERFLOW_OVERWRITE == ringBuffer->overflowPolicy)
+        {
+            // Write over the oldest element. The read index is left to the
+            // consumer, which sees that it has been lapped.
+            wasSuccessful = true;
+        }
+        else if (RINGBUFFER_OVERFLOW_COUNT_DROPS == ringBuffer->overflowPolicy)
+        {
+            ringBuffer->dropCount++;
+        }
+        // else RINGBUFFER_OVERFLOW_REJECT, just discard the data
 
-        // Write the new data at the current write index
-        ringBuffer->buffer[ringBuffer->writeIndex] = data;
-
-        // Update the write index to reflect the new positon after the read
-        // See the GetDataLength() function for a detailed explanation of the AND operation
-        // TODO: Verify atomic write of index
-        ringBuffer->writeIndex = (ringBuffer->writeIndex + 1) & (ringBuffer->bufferSize - 1);
+        if (wasSuccessful)
+        {
+            // Write the new data at the current write position
+            ((volatile RingBuffer_Data_t *)ringBuffer->buffer)[writeIndex & (ringBuffer->bufferSize - 1)] = data;
 
-        // Write was successful
-        wasSuccessful = true;
+            // The data must be stored before the consumer can see the new index
+            RINGBUFFER_MEMORY_BARRIER();
+            ringBuffer->writeIndex = writeIndex + 1;
+        }
     }
 
-    // Return the success state (false if buffer was invalid)
+    // Return the success state (false if buffer was invalid or the data was discarded)
     return (wasSuccessful);
 }
 
@@ -129,23 +244,223 @@ bool RingBuffer_ReadChar(RingBuffer_t *const ringBuffer, RingBuffer_Data_t *cons
     bool wasSuccessful = false;
 
     // Verify given buffer and data parameters are valid, also verify data buffer pointer is valid
-    // And see if the Buffer is full at Size-1 since we do not allow write and read to be the same 
-    if (ringBuffer && (RingBuffer_GetDataLength(ringBuffer) > 0) && (ringBuffer->buffer))
+    if (ringBuffer && data && (ringBuffer->buffer))
     {
-        // Buffer has data, get data at current read index and sotre in the given buffer
-        *data = ringBuffer->buffer[ringBuffer->readIndex];
+        // Only the consumer changes the read index, so it can be read once
+        uint16_t readIndex = ringBuffer->readIndex;
+        uint16_t writeIndex;
+        RingBuffer_Data_t value;
+
+        do
+        {
+            writeIndex = ringBuffer->writeIndex;
+
+            // Skip any elements replaced by an overwriting producer
+            if ((uint16_t)(writeIndex - readIndex) > ringBuffer->bufferSize)
+            {
+                readIndex = writeIndex - ringBuffer->bufferSize;
+            }
+
+            // Stop if the buffer is empty
+            if (writeIndex == readIndex)
+            {
+                break;
+            }
+
+            // The index must be read before the data it covers
+            RINGBUFFER_MEMORY_BARRIER();
+            value = ((volatile RingBuffer_Data_t *)ringBuffer->buffer)[readIndex & (ringBuffer->bufferSize - 1)];
+            RINGBUFFER_MEMORY_BARRIER();
 
-        // Update the write index to reflect the new positon after the read
-        // See the GetDataLength() function for a detailed explanation of the AND operation
-        // TODO: Verify atomic write of index
-        ringBuffer->readIndex = (ringBuffer->readIndex + 1) & (ringBuffer->bufferSize - 1);
+            // The element is only valid if it was not replaced while it was
+            // being read. This can only happen in overwrite mode.
+            wasSuccessful = ((uint16_t)(ringBuffer->writeIndex - readIndex) <= ringBuffer->bufferSize);
+        } while (!wasSuccessful);
 
-        // Read was successful
-        wasSuccessful = true;
+        if (wasSuccessful)
+        {
+            *data = value;
+
+            // Release the element to the producer
+            ringBuffer->readIndex = readIndex + 1;
+        }
+        else
+        {
+            // Keep the position of any skipped elements
+            ringBuffer->readIndex = readIndex;
+        }
     }
 
     // Return the success state (false if buffers were invalid)
     return (wasSuccessful);
 }
 
+uint16_t RingBuffer_GetDropCount(RingBuffer_t *const ringBuffer)
+{
+    // Return 0 for an invalid buffer
+    return ((ringBuffer) ? ringBuffer->dropCount : 0);
+}
 
+uint16_t RingBuffer_Write(RingBuffer_t *const ringBuffer, const RingBuffer_Data_t *const data, const uint16_t length)
+{
+    // Assume nothing is stored until the buffers are verified
+    uint16_t numStored = 0;
+
+    // Verify the given parameters and the data buffer pointer
+    if ((ringBuffer) && (ringBuffer->buffer) && (data))
+    {
+        // Only the producer changes the write index, so it can be read once
+        const uint16_t writeIndex = ringBuffer->writeIndex;
+        const uint16_t freeLength = ringBuffer->bufferSize - RingBuffer_GetDataLength(ringBuffer);
+        const RingBuffer_Data_t *source = data;
+        uint16_t numToCopy = length;
+
+        if (length > freeLength)
+        {
+            if (RINGBUFFER_OVERFLOW_OVERWRITE == ringBuffer->overflowPolicy)
+            {
+                // Only the newest elements that fit in the whole buffer survive
+                if (length > ringBuffer->bufferSize)
+                {
+                    source += length - ringBuffer->bufferSize;
+                    numToCopy = ringBuffer->bufferSize;
+                }
+            }
+            else
+            {
+                // Store what fits and discard the rest
+                numToCopy = freeLength;
+
+                if (RINGBUFFER_OVERFLOW_COUNT_DROPS == ringBuffer->overflowPolicy)
+                {
+                    ringBuffer->dropCount += length - freeLength;
+                }
+            }
+        }
+
+        CopyIn(ringBuffer, writeIndex, source, numToCopy);
+
+        // The data must be stored before the consumer can see the new index
+        RINGBUFFER_MEMORY_BARRIER();
+        ringBuffer->writeIndex = writeIndex + numToCopy;
+
+        // In overwrite mode every element is accepted, even if later replaced
+        numStored = (RINGBUFFER_OVERFLOW_OVERWRITE == ringBuffer->overflowPolicy) ? length : numToCopy;
+    }
+
+    // Return the number of elements stored (0 if buffers were invalid)
+    return (numStored);
+}
+
+uint16_t RingBuffer_Read(RingBuffer_t *const ringBuffer, RingBuffer_Data_t *const data, const uint16_t maxLength)
+{
+    // Assume nothing is read until the buffers are verified
+    uint16_t numRead = 0;
+
+    // Verify the given parameters and the data buffer pointer
+    if ((ringBuffer) && (ringBuffer->buffer) && (data))
+    {
+        // Only the consumer changes the read index, so it can be read once
+        uint16_t readIndex = ringBuffer->readIndex;
+        bool isValid;
+
+        do
+        {
+            const uint16_t writeIndex = ringBuffer->writeIndex;
+
+            // Skip any elements replaced by an overwriting producer
+            if ((uint16_t)(writeIndex - readIndex) > ringBuffer->bufferSize)
+            {
+                readIndex = writeIndex - ringBuffer->bufferSize;
+            }
+
+            numRead = (uint16_t)(writeIndex - readIndex);
+            if (numRead > maxLength)
+            {
+                numRead = maxLength;
+            }
+
+            // The index must be read before the data it covers
+            RINGBUFFER_MEMORY_BARRIER();
+            CopyOut(ringBuffer, readIndex, data, numRead);
+            RINGBUFFER_MEMORY_BARRIER();
+
+            // The oldest element is replaced first, so the copy is only valid if
+            // it was not replaced while the copy was made. This can only happen
+            // in overwrite mode.
+            isValid = ((uint16_t)(ringBuffer->writeIndex - readIndex) <= ringBuffer->bufferSize);
+        } while (!isValid);
+
+        // Release the elements to the producer
+        ringBuffer->readIndex = readIndex + numRead;
+    }
+
+    // Return the number of elements read (0 if buffers were invalid)
+    return (numRead);
+}
+
+uint16_t RingBuffer_GetWriteSpans(RingBuffer_t *const ringBuffer, RingBuffer_Spans_t *const spans)
+{
+    // Assume no space until the buffers are verified
+    uint16_t freeLength = 0;
+
+    // Verify the given parameters and the data buffer pointer
+    if ((ringBuffer) && (ringBuffer->buffer) && (spans))
+    {
+        freeLength = ringBuffer->bufferSize - RingBuffer_GetDataLength(ringBuffer);
+
+        GetSpans(ringBuffer, ringBuffer->writeIndex, freeLength, spans);
+    }
+
+    return (freeLength);
+}
+
+void RingBuffer_CommitWrite(RingBuffer_t *const ringBuffer, const uint16_t length)
+{
+    // Verify the given parameter
+    if (ringBuffer)
+    {
+        // The data must be stored before the consumer can see the new index
+        RINGBUFFER_MEMORY_BARRIER();
+        ringBuffer->writeIndex = ringBuffer->writeIndex + length;
+    }
+}
+
+uint16_t RingBuffer_GetReadSpans(RingBuffer_t *const ringBuffer, RingBuffer_Spans_t *const spans)
+{
+    // Assume no data until the buffers are verified
+    uint16_t dataLength = 0;
+
+    // Verify the given parameters and the data buffer pointer
+    if ((ringBuffer) && (ringBuffer->buffer) && (spans))
+    {
+        const uint16_t writeIndex = ringBuffer->writeIndex;
+        uint16_t readIndex = ringBuffer->readIndex;
+
+        // Skip any elements replaced by an overwriting producer
+        if ((uint16_t)(writeIndex - readIndex) > ringBuffer->bufferSize)
+        {
+            readIndex = writeIndex - ringBuffer->bufferSize;
+            ringBuffer->readIndex = readIndex;
+        }
+
+        dataLength = (uint16_t)(writeIndex - readIndex);
+
+        // The index must be read before the data it covers
+        RINGBUFFER_MEMORY_BARRIER();
+        GetSpans(ringBuffer, readIndex, dataLength, spans);
+    }
+
+    return (dataLength);
+}
+
+void RingBuffer_CommitRead(RingBuffer_t *const ringBuffer, const uint16_t length)
+{
+    // Verify the given parameter
+    if (ringBuffer)
+    {
+        // The data must be used before the producer can reuse the space
+        RINGBUFFER_MEMORY_BARRIER();
+        ringBuffer->readIndex = ringBuffer->readIndex + length;
+    }
+}
@@ -1,5 +1,9 @@
 /*******************************************************************************
 // Ring Buffer Library
+// Each ring buffer may be shared between one producer and one consumer running
+// in different contexts (for example a UART interrupt and the background loop)
+// without disabling interrupts. Only the producer changes the write index and
+// only the consumer changes the read index.
 *******************************************************************************/
 #pragma once
 
@@ -21,6 +25,17 @@ extern "C"
 // Public Constant Definitions
 *******************************************************************************/
 
+// Orders the data and index accesses shared between the producer and consumer.
+// The indices are volatile so the compiler keeps them in program order with the
+// volatile data accesses around them. The C28x pipeline performs loads and
+// stores to RAM in program order, so no barrier instruction is needed there.
+// Other targets (such as host builds) use a full barrier.
+#if defined(__TMS320C28XX__)
+#define RINGBUFFER_MEMORY_BARRIER()
+#else
+#define RINGBUFFER_MEMORY_BARRIER() __sync_synchronize()
+#endif
+
 /*******************************************************************************
 // Public Type Declarations
 *******************************************************************************/
@@ -28,6 +43,19 @@ extern "C"
 // Defines the type used by the ring buffer. This allows uint16_t to be used for TI DSP.
 typedef uint16_t RingBuffer_Data_t;
 
+// Defines what happens when data is written to a full ring buffer
+typedef enum
+{
+    // The oldest data is replaced. The consumer skips any data replaced
+    // while it was waiting. Data is only lost, never duplicated, when the
+    // producer runs in an interrupt that the consumer cannot preempt.
+    RINGBUFFER_OVERFLOW_OVERWRITE,
+    // The new data is discarded and the write fails
+    RINGBUFFER_OVERFLOW_REJECT,
+    // The new data is discarded, the write fails and the drop count is incremented
+    RINGBUFFER_OVERFLOW_COUNT_DROPS
+} RingBuffer_OverflowPolicy_t;
+
 // Structure that defines all parameters for managing a single circular buffer
 // The type used for holding all data for a ring buffer
 // Note that the data buffer must be set using Init() before use
@@ -37,17 +65,32 @@ typedef struct
     RingBuffer_Data_t *buffer;
     // Size of the data buffer - must be power of two
     // Note this is the whole buffer size, not the amount of data currently in the buffer
-    // One character is used to seperate read/write so that a full buffer won't have
-    // read=write which would be indistinguishable from an empty buffer.
     uint16_t bufferSize;
-    // The current read position: 0 to (size-1)
-    // Note: Max is size-1 because we do not let read and write be equal
-    uint16_t readIndex;
-    // The current write position: 0 to (size-1)
-    // Note: Max is size-1 because we do not let read and write be equal
-    uint16_t writeIndex;
+    // What to do when data is written to a full buffer
+    RingBuffer_OverflowPolicy_t overflowPolicy;
+    // The number of elements read since initialization. Only changed by the consumer.
+    // The index is free-running and masked by (size-1) to find the position, so
+    // read=write is empty and write-read=size is full.
+    volatile uint16_t readIndex;
+    // The number of elements written since initialization. Only changed by the producer.
+    volatile uint16_t writeIndex;
+    // The number of elements discarded by RINGBUFFER_OVERFLOW_COUNT_DROPS.
+    // Only changed by the producer. Wraps at 0xFFFF.
+    volatile uint16_t dropCount;
 } RingBuffer_t;
 
+// Describes a region of a ring buffer that can be accessed in place. Because
+// the region may wrap past the end of the data buffer, it is made of up to two
+// contiguous spans. The second span is only used when the first one reaches
+// the end of the data buffer.
+typedef struct
+{
+    // Start of each span within the data buffer
+    RingBuffer_Data_t *data[2];
+    // Number of elements in each span, 0 if the span is unused
+    uint16_t length[2];
+} RingBuffer_Spans_t;
+
 /*******************************************************************************
 // Public Function Declarations
 *******************************************************************************/
@@ -61,7 +104,7 @@ typedef struct
  *    buffer - The data buffer to be used by this ring buffer item
  *    powerOfTwoSize - The total size of given buffer. Note that the optimizations
  *      in this library require buffers to be a non-zero power of two (Ex. 2,8,16,128,...32768 [max])
- *      Note that the internal optimizations will only allow a max of (powerOfTwoSize-1) elements to be stored.
+ *    overflowPolicy - What to do when data is written to a full buffer
  *  Returns:
  *    bool - The result of the initialization
  *  Return Value List:
@@ -69,15 +112,15 @@ typedef struct
  *    false - The circular buffer structure could not be initialized with the given parameters
  *    (Ex. invalid pointers or size is not a power of two)
  */
-bool RingBuffer_Init(RingBuffer_t *const ringBuffer, RingBuffer_Data_t *const buffer, const uint16_t powerOfTwoSize);
+bool RingBuffer_Init(RingBuffer_t *const ringBuffer, RingBuffer_Data_t *const buffer, const uint16_t powerOfTwoSize,
+                     const RingBuffer_OverflowPolicy_t overflowPolicy);
 
 /** Description:
  *    This function calculates the current number of elements
  *    currently in the given ring buffer structure.  To maintain
  *    atomicity, size is not stored and is always calculated
- *    based on the current read/write indices.
- *    Note that the maximum length is one less than the size of
- *    internal buffer due to internal optimizations.
+ *    based on the current read/write indices. May be called
+ *    by either the producer or the consumer.
  * Parameters:
  *    ringBuffer - A pointer to the ring buffer structure for
  *    which the number of elements is to be calculated.
@@ -90,10 +133,10 @@ uint16_t RingBuffer_GetDataLength(RingBuffer_t *const ringBuffer);
 
 /** Description:
  *    Adds the given data to the end of internal FIFO for the
- *    given ring buffer (if space is available). If the buffer
- *    is full, no change is made. If successful, the internal
- *    indices are updated in the given structure.  The updates
- *    to read/write indices are atomic.
+ *    given ring buffer. If the buffer is full, the overflow
+ *    policy given to Init() decides whether the oldest data is
+ *    replaced or the new data is discarded. Must only be called
+ *    by the producer.
  * Parameters: 
  *    ringBuffer - Pointer to the ring buffer structure where
  *       the data is to be added.
@@ -105,7 +148,7 @@ uint16_t RingBuffer_GetDataLength(RingBuffer_t *const ringBuffer);
  *             buffer.
  *    false :  The given data could not be stored in the ring
  *             buffer. Either the buffer is invalid or the
- *             buffer is currently full.  
+ *             buffer is currently full and the data was discarded.
  */
 bool RingBuffer_WriteChar(RingBuffer_t *const ringBuffer, const RingBuffer_Data_t data);
 
@@ -113,8 +156,8 @@ bool RingBuffer_WriteChar(RingBuffer_t *const ringBuffer, const RingBuffer_Data_
 /** Description:
  *    Retrieves the first (oldest) available byte from the
  *    internal FIFO of the given ring buffer. If
- *    successful, the internal indices are updated in the given
- *    structure.  The updates to read/write indices are atomic.
+ *    successful, the read index is updated in the given
+ *    structure. Must only be called by the consumer.
  * Parameters:
  *    ringBuffer - Pointer to the ring buffer structure
  *       from which the data is to be retrieved.
@@ -130,6 +173,110 @@ bool RingBuffer_WriteChar(RingBuffer_t *const ringBuffer, const RingBuffer_Data_
 bool RingBuffer_ReadChar(RingBuffer_t *const ringBuffer, RingBuffer_Data_t *const data);
 
 
+/** Description:
+ *    Returns the number of elements discarded because the buffer
+ *    was full, when the RINGBUFFER_OVERFLOW_COUNT_DROPS policy
+ *    is used. The count is never cleared and wraps at 0xFFFF, so
+ *    callers should compare against an earlier reading.
+ * Parameters:
+ *    ringBuffer - Pointer to the ring buffer structure to be queried
+ * Returns:
+ *    uint16_t - The number of discarded elements. Returns 0 if
+ *    the buffer is invalid.
+ */
+uint16_t RingBuffer_GetDropCount(RingBuffer_t *const ringBuffer);
+
+
+/** Description:
+ *    Adds a block of data to the end of the FIFO. The copy is
+ *    split at the end of the data buffer rather than masking
+ *    each element. If there is not enough space, the overflow
+ *    policy decides the outcome: overwrite keeps the newest
+ *    data, reject and count drops store what fits and discard
+ *    the rest. Must only be called by the producer.
+ * Parameters:
+ *    ringBuffer - Pointer to the ring buffer structure where
+ *       the data is to be added.
+ *    data - The data to be added
+ *    length - The number of elements to be added
+ * Returns:
+ *    uint16_t - The number of elements stored. Returns 0 if the
+ *    buffer or data is invalid.
+ */
+uint16_t RingBuffer_Write(RingBuffer_t *const ringBuffer, const RingBuffer_Data_t *const data, const uint16_t length);
+
+
+/** Description:
+ *    Retrieves up to the given number of the oldest elements
+ *    from the FIFO. Must only be called by the consumer.
+ * Parameters:
+ *    ringBuffer - Pointer to the ring buffer structure from
+ *       which the data is to be retrieved.
+ *    data - Where the retrieved data is stored
+ *    maxLength - The largest number of elements to retrieve
+ * Returns:
+ *    uint16_t - The number of elements retrieved. Returns 0 if
+ *    no data is available or the pointers are invalid.
+ */
+uint16_t RingBuffer_Read(RingBuffer_t *const ringBuffer, RingBuffer_Data_t *const data, const uint16_t maxLength);
+
+
+/** Description:
+ *    Finds the free space of the buffer so the producer (or a
+ *    DMA channel acting for it) can fill it in place. Nothing is
+ *    added until RingBuffer_CommitWrite() is called. In
+ *    overwrite mode, only the free space is returned.
+ * Parameters:
+ *    ringBuffer - Pointer to the ring buffer structure to be filled
+ *    spans - Where the free region is described
+ * Returns:
+ *    uint16_t - The total number of free elements in both spans.
+ *    Returns 0 if the buffer is full or invalid.
+ */
+uint16_t RingBuffer_GetWriteSpans(RingBuffer_t *const ringBuffer, RingBuffer_Spans_t *const spans);
+
+
+/** Description:
+ *    Adds the given number of elements, already placed in the
+ *    spans from RingBuffer_GetWriteSpans(), to the FIFO. Must
+ *    only be called by the producer.
+ * Parameters:
+ *    ringBuffer - Pointer to the ring buffer structure that was filled
+ *    length - The number of elements written, no more than the
+ *       free space returned by RingBuffer_GetWriteSpans()
+ */
+void RingBuffer_CommitWrite(RingBuffer_t *const ringBuffer, const uint16_t length);
+
+
+/** Description:
+ *    Finds the data waiting in the buffer so the consumer (or a
+ *    DMA channel acting for it) can use it in place. Nothing is
+ *    removed until RingBuffer_CommitRead() is called. In
+ *    overwrite mode, the producer may replace the data while it
+ *    is being used, so only the copying RingBuffer_Read() is
+ *    safe in that mode.
+ * Parameters:
+ *    ringBuffer - Pointer to the ring buffer structure to be drained
+ *    spans - Where the waiting data is described
+ * Returns:
+ *    uint16_t - The total number of waiting elements in both
+ *    spans. Returns 0 if the buffer is empty or invalid.
+ */
+uint16_t RingBuffer_GetReadSpans(RingBuffer_t *const ringBuffer, RingBuffer_Spans_t *const spans);
+
+
+/** Description:
+ *    Removes the given number of elements, already used from the
+ *    spans from RingBuffer_GetReadSpans(), from the FIFO. Must
+ *    only be called by the consumer.
+ * Parameters:
+ *    ringBuffer - Pointer to the ring buffer structure that was drained
+ *    length - The number of elements used, no more than the data
+ *       length returned by RingBuffer_GetReadSpans()
+ */
+void RingBuffer_CommitRead(RingBuffer_t *const ringBuffer, const uint16_t length);
+
+
 #ifdef __cplusplus
 extern "C"
 }
@@ -0,0 +1,187 @@
+/*******************************************************************************
+// Typed Ring Buffer Library
+// Generates ring buffers that hold fixed-size records (ADC frames, timestamped
+// events, trace entries) rather than single 16-bit words. The capacity and
+// record type are fixed at compile time. Each generated buffer follows the
+// same rules as RingBuffer.c: power-of-two indexing with free-running indices,
+// one producer and one consumer in any two contexts, and a selectable overflow
+// policy. Each buffer also keeps statistics.
+*******************************************************************************/
+#pragma once
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "RingBuffer.h" // Overflow policies and barrier
+// Platform Includes
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+// Statistics kept by each typed ring buffer. All fields are updated by the
+// producer only, so the consumer may read them at any time.
+typedef struct
+{
+    // The number of records accepted since initialization. Wraps at 0xFFFFFFFF.
+    uint32_t totalWritten;
+    // The most records that have been waiting at once
+    uint16_t highWaterMark;
+    // The number of records that found the buffer full, whatever the policy.
+    // Under the overwrite policy these replaced the oldest record. Wraps at 0xFFFF.
+    uint16_t overflowCount;
+} RingBuffer_Stats_t;
+
+
+/*******************************************************************************
+// Public Macro Definitions
+*******************************************************************************/
+
+/** Description:
+ *    Defines a ring buffer type for the given record type together with its
+ *    access functions. The functions are static inline so the macro may be
+ *    used in a header shared by the producer and consumer. For a name of
+ *    Foo_Queue the following are generated:
+ *       Foo_Queue_t - The ring buffer type
+ *       void Foo_Queue_Init(Foo_Queue_t *queue, RingBuffer_OverflowPolicy_t policy)
+ *       bool Foo_Queue_Write(Foo_Queue_t *queue, const type *record) - Producer only
+ *       bool Foo_Queue_Read(Foo_Queue_t *queue, type *record) - Consumer only
+ *       uint16_t Foo_Queue_GetLength(Foo_Queue_t *queue)
+ *       void Foo_Queue_GetStats(Foo_Queue_t *queue, RingBuffer_Stats_t *stats)
+ *    Write returns false if the record was discarded. Read returns false if
+ *    no record was waiting.
+ * Parameters:
+ *    name - The prefix for the generated type and functions
+ *    type - The record type held by the buffer
+ *    capacity - The number of records held. Must be a power of two from 2 to
+ *       32768 or the build fails.
+ */
+#define RINGBUFFER_TYPED_DEFINE(name, type, capacity) \
+    \
+    /* Fails to compile unless the capacity is a non-zero power of two */ \
+    typedef char name##_CapacityCheck_t[(((capacity) > 1U) && ((capacity) <= 32768U) && \
+                                         (((capacity) & ((capacity) - 1U)) == 0U)) ? 1 : -1]; \
+    \
+    typedef struct \
+    { \
+        /* Storage for the records, indexed by the masked free-running indices */ \
+        type records[capacity]; \
+        /* What to do when a record is written to a full buffer */ \
+        RingBuffer_OverflowPolicy_t overflowPolicy; \
+        /* The number of records read since initialization. Only changed by the consumer. */ \
+        volatile uint16_t readIndex; \
+        /* The number of records written since initialization. Only changed by the producer. */ \
+        volatile uint16_t writeIndex; \
+        /* Statistics, only changed by the producer */ \
+        volatile RingBuffer_Stats_t stats; \
+    } name##_t; \
+    \
+    static inline void name##_Init(name##_t *const queue, const RingBuffer_OverflowPolicy_t overflowPolicy) \
+    { \
+        queue->overflowPolicy = overflowPolicy; \
+        queue->readIndex = 0U; \
+        queue->writeIndex = 0U; \
+        queue->stats.totalWritten = 0U; \
+        queue->stats.highWaterMark = 0U; \
+        queue->stats.overflowCount = 0U; \
+    } \
+    \
+    static inline uint16_t name##_GetLength(name##_t *const queue) \
+    { \
+        /* The producer may have lapped the consumer in overwrite mode */ \
+        const uint16_t length = (uint16_t)(queue->writeIndex - queue->readIndex); \
+        return ((length > (capacity)) ? (uint16_t)(capacity) : length); \
+    } \
+    \
+    static inline bool name##_Write(name##_t *const queue, const type *const record) \
+    { \
+        /* Only the producer changes the write index, so it can be read once */ \
+        const uint16_t writeIndex = queue->writeIndex; \
+        const uint16_t length = name##_GetLength(queue); \
+        bool wasSuccessful = true; \
+        \
+        if (length >= (capacity)) \
+        { \
+            queue->stats.overflowCount++; \
+            wasSuccessful = (RINGBUFFER_OVERFLOW_OVERWRITE == queue->overflowPolicy); \
+        } \
+        \
+        if (wasSuccessful) \
+        { \
+            *(volatile type *)&queue->records[writeIndex & ((capacity) - 1U)] = *record; \
+            \
+            /* The record must be stored before the consumer can see the new index */ \
+            RINGBUFFER_MEMORY_BARRIER(); \
+            queue->writeIndex = writeIndex + 1U; \
+            \
+            queue->stats.totalWritten++; \
+            if (length >= queue->stats.highWaterMark) \
+            { \
+                queue->stats.highWaterMark = (length < (capacity)) ? (length + 1U) : (uint16_t)(capacity); \
+            } \
+        } \
+        \
+        return (wasSuccessful); \
+    } \
+    \
+    static inline bool name##_Read(name##_t *const queue, type *const record) \
+    { \
+        /* Only the consumer changes the read index, so it can be read once */ \
+        uint16_t readIndex = queue->readIndex; \
+        bool wasSuccessful = false; \
+        \
+        for (;;) \
+        { \
+            const uint16_t writeIndex = queue->writeIndex; \
+            \
+            /* Skip any records replaced by an overwriting producer */ \
+            if ((uint16_t)(writeIndex - readIndex) > (capacity)) \
+            { \
+                readIndex = writeIndex - (uint16_t)(capacity); \
+            } \
+            \
+            if (writeIndex == readIndex) \
+            { \
+                break; \
+            } \
+            \
+            /* The index must be read before the record it covers */ \
+            RINGBUFFER_MEMORY_BARRIER(); \
+            *record = *(volatile type *)&queue->records[readIndex & ((capacity) - 1U)]; \
+            RINGBUFFER_MEMORY_BARRIER(); \
+            \
+            /* The record is only valid if it was not replaced while it was read */ \
+            if ((uint16_t)(queue->writeIndex - readIndex) <= (capacity)) \
+            { \
+                readIndex++; \
+                wasSuccessful = true; \
+                break; \
+            } \
+        } \
+        \
+        /* Release the record to the producer */ \
+        queue->readIndex = readIndex; \
+        \
+        return (wasSuccessful); \
+    } \
+    \
+    static inline void name##_GetStats(name##_t *const queue, RingBuffer_Stats_t *const stats) \
+    { \
+        stats->totalWritten = queue->stats.totalWritten; \
+        stats->highWaterMark = queue->stats.highWaterMark; \
+        stats->overflowCount = queue->stats.overflowCount; \
+    }
+
+
+#ifdef __cplusplus
+}
+#endif
@@ -8,20 +8,167 @@
 // Module Includes
 #include "Scheduler.h"
 // Platform Includes
-#include "SoftTimerLib.h"
+#include "SoftTimerLib.h" // Maximum timer duration
+#include "Sys.h" // Interrupt registration
+#include "Timebase.h"
 // Other Includes
 #include <stdbool.h> // Defines C99 boolean type
+#include <stddef.h> // Defines NULL
 
 
 /*******************************************************************************
 // Private Constant Definitions
 *******************************************************************************/
 
+// Position of the item with the earliest deadline in the deadline queue
+#define DEADLINE_QUEUE_HEAD (0U)
+
+// Queue position of an item that is not in the deadline queue
+#define NOT_QUEUED (UINT16_MAX)
+
+// Longest interval for which the interval can be expressed in cycles without
+// overflowing the 32-bit cycle counter. Jitter and overruns are not measured
+// for items with longer intervals.
+#define MAX_PROFILED_INTERVAL_MILLISECONDS (UINT32_MAX / TIMEBASE_NUM_CYCLES_PER_MILLISECOND)
+
+// Length of one CPU load measurement window (in cycles)
+#define LOAD_WINDOW_CYCLES ((uint32_t)SCHEDULER_LOAD_WINDOW_MILLISECONDS * TIMEBASE_NUM_CYCLES_PER_MILLISECOND)
+
+// Longest frame, after which a new frame starts even if nothing was idle (in cycles)
+#define MAX_FRAME_CYCLES ((uint32_t)SCHEDULER_MAX_FRAME_MILLISECONDS * TIMEBASE_NUM_CYCLES_PER_MILLISECOND)
+
 
 /*******************************************************************************
 // Private Type Declarations
 *******************************************************************************/
 
+// This structure holds the runtime copy of a single schedule slot. The slots
+// are loaded from the configuration table at initialization and may then be
+// changed at runtime. A slot with neither a function nor a coroutine is spare.
+typedef struct
+{
+   // Periodic interval in which the function is to be called (in Milliseconds)
+   uint32_t intervalMilliseconds;
+
+   // The function to be called (NULL if the slot is spare or holds a coroutine)
+   Scheduler_Function_t scheduledFunction;
+
+   // The coroutine to be called (NULL if the slot is spare or holds a function)
+   Scheduler_Coroutine_t coroutine;
+
+   // State kept by the coroutine between calls
+   CoroutineLib_Context_t coroutineContext;
+
+   // Defines how the interval is measured between calls
+   Scheduler_Mode_t mode;
+
+   // Delay added to the first call of the function (in Milliseconds)
+   uint32_t phaseOffsetMilliseconds;
+
+   // A suspended item is kept in its slot but is not called
+   bool isSuspended;
+
+   // Order of items due on the same tick. Lower values are called first.
+   uint16_t priority;
+
+   // The item may be skipped when a pass overruns the frame budget
+   bool isSheddable;
+
+   // Set if the last call of the item was skipped, so the next is not
+   bool wasShed;
+
+   // Events that cause the item to be called before its interval
+   Scheduler_EventMask_t eventMask;
+} TaskState_t;
+
+// This structure holds the execution profile of a single scheduled item
+typedef struct
+{
+   // Number of times the function has been called
+   uint32_t runCount;
+
+   // Number of the calls that were made because of a posted event
+   uint32_t eventRunCount;
+
+   // Shortest execution time of the function (in cycles)
+   uint32_t minExecutionCycles;
+
+   // Longest execution time of the function (in cycles)
+   uint32_t maxExecutionCycles;
+
+   // Sum of all execution times, used to calculate the mean (in cycles)
+   uint64_t totalExecutionCycles;
+
+   // Cycle count at the start of the previous call
+   Timebase_CycleCount_t lastStartCycles;
+
+   // Largest deviation of the time between two calls from the interval (in cycles)
+   uint32_t maxStartJitterCycles;
+
+   // Number of calls that took longer to execute than the item's interval
+   uint32_t overrunCount;
+
+   // The number of calls skipped by fixed rate items because a whole period was missed
+   uint32_t skippedPeriodCount;
+
+   // The number of calls skipped because the frame budget was already used
+   uint32_t shedCount;
+
+   // Number of calls by how late they started (in ticks). See SCHEDULER_LATENCY_HISTOGRAM_BINS.
+   uint32_t latencyHistogram[SCHEDULER_LATENCY_HISTOGRAM_BINS];
+} TaskProfile_t;
+
+// This structure holds the execution profile of a single fast tier function
+typedef struct
+{
+   // Number of times the function has been called
+   uint32_t runCount;
+
+   // Longest execution time of the function (in cycles)
+   uint32_t maxExecutionCycles;
+
+   // Number of calls skipped because the tier budget was already used
+   uint32_t budgetSkipCount;
+} FastTaskProfile_t;
+
+// This structure holds the CPU load measurement of the background loop
+typedef struct
+{
+   // Cycle count at the start of the current window
+   Timebase_CycleCount_t windowStartCycles;
+
+   // Cycles spent idle in the current window
+   uint32_t windowIdleCycles;
+
+   // Load of the most recent completed windows (in hundredths of a percent)
+   uint16_t windowLoad[SCHEDULER_LOAD_HISTORY_WINDOWS];
+
+   // Position in windowLoad that the next completed window is written to
+   uint16_t windowLoadIndex;
+
+   // Number of valid entries in windowLoad
+   uint16_t numWindows;
+
+   // Highest load of any completed window (in hundredths of a percent)
+   uint16_t peakLoad;
+
+   // A frame is running from the first call after an idle pass until the
+   // next idle pass, or for at most MAX_FRAME_CYCLES
+   bool isFrameActive;
+
+   // true once the current frame has used its budget
+   bool isFrameOverrun;
+
+   // Cycle count at the start of the current frame
+   Timebase_CycleCount_t frameStartCycles;
+
+   // Number of frames that used more than the frame budget
+   uint32_t frameOverrunCount;
+
+   // Number of calls skipped because the frame budget was already used
+   uint32_t shedCount;
+} LoadStatus_t;
+
 // This structure defines the internal variables used by the module
 typedef struct
 {
@@ -37,8 +184,49 @@ typedef struct
    // Enable state for the scheduler module
    bool enableState;
 
-   // The following array allocates a timer object for each scheduled item.
-   SoftTimerLib_Timer_t schedulerItemTimer[MAX_SCHEDULED_FUNCTIONS];
+   // Events posted since the last pass of the loop. This is written from
+   // interrupts so it must only be changed inside a critical section.
+   volatile Scheduler_EventMask_t pendingEvents;
+
+   // The runtime state of each schedule slot
+   TaskState_t task[MAX_SCHEDULED_FUNCTIONS];
+
+   // The absolute Timebase tick at which each scheduled item is next due
+   Timebase_Tick_t nextDeadline[MAX_SCHEDULED_FUNCTIONS];
+
+   // Position of each item in the deadline queue (NOT_QUEUED if not queued)
+   uint16_t queuePosition[MAX_SCHEDULED_FUNCTIONS];
+
+   // Binary min-heap of scheduled item indices ordered by next deadline.
+   // The item at DEADLINE_QUEUE_HEAD is always the next item to be called.
+   uint16_t deadlineQueue[MAX_SCHEDULED_FUNCTIONS];
+
+   // The number of scheduled items currently held in the deadline queue
+   uint16_t deadlineQueueLength;
+
+   // Execution profile of each scheduled item
+   TaskProfile_t taskProfile[MAX_SCHEDULED_FUNCTIONS];
+
+   // Fast tier function indices in the order they are called (by priority)
+   uint16_t fastTaskOrder[MAX_FAST_SCHEDULED_FUNCTIONS];
+
+   // Number of interrupts since each fast tier function was last called
+   uint16_t fastTaskDividerCount[MAX_FAST_SCHEDULED_FUNCTIONS];
+
+   // Execution profile of each fast tier function
+   FastTaskProfile_t fastTaskProfile[MAX_FAST_SCHEDULED_FUNCTIONS];
+
+   // Number of times the fast tier has been dispatched
+   uint32_t fastTierDispatchCount;
+
+   // Number of dispatches that took longer than the tier budget
+   uint32_t fastTierOverrunCount;
+
+   // Longest dispatch of the fast tier (in cycles)
+   uint32_t fastTierMaxDispatchCycles;
+
+   // CPU load and load shedding statistics of the background loop
+   LoadStatus_t load;
 } Scheduler_Status_t;
 
 
@@ -54,131 +242,1812 @@ static Scheduler_Status_t status;
 // Private Function Declarations
 *******************************************************************************/
 
-/*******************************************************************************
-// Private Function Implementations
-*******************************************************************************/
+/** Description:
+ *    Compare two absolute deadlines. The comparison is made on the signed
+ *    difference so the result remains correct when the Timebase wraps.
+ * Parameters:
+ *    deadline - The deadline being tested
+ *    reference - The deadline it is compared against
+ * Returns:
+ *    bool - true if deadline is earlier than reference
+ */
+static bool IsDeadlineBefore(const Timebase_Tick_t deadline, const Timebase_Tick_t reference);
+
+/** Description:
+ *    Compare the order in which two queued items are to be called. Items are
+ *    ordered by deadline and items with the same deadline by priority.
+ * Parameters:
+ *    itemIndex - The item being tested
+ *    referenceIndex - The item it is compared against
+ * Returns:
+ *    bool - true if itemIndex is to be called before referenceIndex
+ */
+static bool IsDueBefore(const uint16_t itemIndex, const uint16_t referenceIndex);
+
+/** Description:
+ *    Move the queue entry at the given position toward the head until the
+ *    heap ordering is restored.
+ * Parameters:
+ *    queuePosition - Position in the deadline queue of the entry to be moved
+ * Returns:
+ *    none
+ */
+static void SiftUp(uint16_t queuePosition);
+
+/** Description:
+ *    Move the queue entry at the given position away from the head until the
+ *    heap ordering is restored.
+ * Parameters:
+ *    queuePosition - Position in the deadline queue of the entry to be moved
+ * Returns:
+ *    none
+ */
+static void SiftDown(uint16_t queuePosition);
+
+/** Description:
+ *    Store an item at the given position of the deadline queue.
+ * Parameters:
+ *    queuePosition - Position in the deadline queue
+ *    itemIndex - Index of the schedule slot
+ * Returns:
+ *    none
+ */
+static void PlaceInQueue(const uint16_t queuePosition, const uint16_t itemIndex);
+
+/** Description:
+ *    Add a scheduled item to the deadline queue using the deadline currently
+ *    stored for it.
+ * Parameters:
+ *    itemIndex - Index into the Scheduler_configTable
+ * Returns:
+ *    none
+ */
+static void QueueItem(const uint16_t itemIndex);
+
+/** Description:
+ *    Remove a scheduled item from the deadline queue, if it is queued.
+ * Parameters:
+ *    itemIndex - Index of the schedule slot
+ * Returns:
+ *    none
+ */
+static void DequeueItem(const uint16_t itemIndex);
+
+/** Description:
+ *    Queue an item to be first called one interval plus the given delay
+ *    after the given tick.
+ * Parameters:
+ *    itemIndex - Index of the schedule slot
+ *    startTick - The tick from which the first deadline is measured
+ *    delayMilliseconds - Delay added to the interval for the first call
+ * Returns:
+ *    none
+ */
+static void StartItem(const uint16_t itemIndex, const Timebase_Tick_t startTick, const uint32_t delayMilliseconds);
+
+/** Description:
+ *    Verify the given settings can be used for a schedule slot.
+ * Parameters:
+ *    configItem - The settings to be verified
+ * Returns:
+ *    bool - true if the function is valid and the interval and phase offset
+ *    are within the maximum timer duration
+ */
+static bool IsConfigItemValid(const Scheduler_ConfigItem_t *const configItem);
+
+/** Description:
+ *    Verify the given index refers to a schedule slot holding a function.
+ * Parameters:
+ *    itemIndex - Index of the schedule slot
+ * Returns:
+ *    bool - true if the slot is in use
+ */
+static bool IsItemInUse(const uint16_t itemIndex);
+
+/** Description:
+ *    Find the first spare schedule slot.
+ * Parameters:
+ *    itemIndex - Set to the index of the spare slot
+ * Returns:
+ *    bool - true if a spare slot was found
+ */
+static bool FindSpareItem(uint16_t *const itemIndex);
+
+/** Description:
+ *    Call the function or coroutine held in a schedule slot. A coroutine that
+ *    ends or exits is removed from the schedule.
+ * Parameters:
+ *    itemIndex - Index of the schedule slot
+ * Returns:
+ *    none
+ */
+static void CallItem(const uint16_t itemIndex);
+
+/** Description:
+ *    Calculate the next deadline of a scheduled item that is due according
+ *    to its configured scheduling mode.
+ * Parameters:
+ *    itemIndex - Index into the Scheduler_configTable
+ *    currentTick - The Timebase tick at which the item was found to be due
+ * Returns:
+ *    bool - true if whole periods were missed and skipped
+ */
+static bool ScheduleNextCall(const uint16_t itemIndex, const Timebase_Tick_t currentTick);
+
+/** Description:
+ *    Validate the fast tier configuration and sort its functions by priority.
+ * Parameters:
+ *    fastTierConfig - The fast tier configuration (may be NULL)
+ * Returns:
+ *    bool - true if the configuration is valid or no fast tier is configured
+ */
+static bool InitFastTier(const Scheduler_FastTierConfig_t *const fastTierConfig);
+
+/** Description:
+ *    Clear the dispatch statistics of the fast tier.
+ * Returns:
+ *    none
+ */
+static void ResetFastTierProfile(void);
+
+/** Description:
+ *    Clear the execution profile of a scheduled item.
+ * Parameters:
+ *    itemIndex - Index into the Scheduler_configTable
+ * Returns:
+ *    none
+ */
+static void ResetProfile(const uint16_t itemIndex);
+
+/** Description:
+ *    Add the measurements of a single call to the execution profile of a
+ *    scheduled item.
+ * Parameters:
+ *    itemIndex - Index into the Scheduler_configTable
+ *    latencyTicks - How late the call started relative to its deadline
+ *    startCycles - Cycle count immediately before the function was called
+ *    endCycles - Cycle count immediately after the function returned
+ *    periodsSkipped - true if whole periods were skipped before this call
+ * Returns:
+ *    none
+ */
+static void UpdateProfile(const uint16_t itemIndex, const Timebase_Tick_t latencyTicks,
+                          const Timebase_CycleCount_t startCycles, const Timebase_CycleCount_t endCycles,
+                          const bool periodsSkipped);
+
+/** Description:
+ *    Add the execution time of a single call to the profile of a scheduled
+ *    item.
+ * Parameters:
+ *    itemIndex - Index of the schedule slot
+ *    executionCycles - Time taken by the call (in cycles)
+ * Returns:
+ *    none
+ */
+static void RecordExecutionTime(const uint16_t itemIndex, const uint32_t executionCycles);
+
+/** Description:
+ *    Read and clear the pending events.
+ * Returns:
+ *    Scheduler_EventMask_t - The events posted since the previous call
+ */
+static Scheduler_EventMask_t TakePendingEvents(void);
+
+/** Description:
+ *    Call every item waiting on any of the given events. Fixed delay items
+ *    measure their next interval from this call. Fixed rate items keep their
+ *    deadline.
+ * Parameters:
+ *    events - The events that have been posted
+ * Returns:
+ *    none
+ */
+static void DispatchEvents(const Scheduler_EventMask_t events);
+
+/** Description:
+ *    Clear the CPU load history and shedding statistics and start a new
+ *    load window.
+ * Parameters:
+ *    currentCycles - The current cycle count
+ * Returns:
+ *    none
+ */
+static void ResetLoad(const Timebase_CycleCount_t currentCycles);
+
+/** Description:
+ *    Close the current load window once it has run for its full length and
+ *    add its load to the history.
+ * Parameters:
+ *    currentCycles - The current cycle count
+ * Returns:
+ *    none
+ */
+static void UpdateLoad(const Timebase_CycleCount_t currentCycles);
+
+/** Description:
+ *    Check the frame budget before a due item is called. The frame starts
+ *    with the first item called after the loop was last idle, or with the
+ *    first item called once the frame has lasted MAX_FRAME_CYCLES, so an item
+ *    that is always due cannot hold a frame open. An item is never shed twice
+ *    in a row, so one whose period lines up with the frames is slowed rather
+ *    than stopped when the loop never idles.
+ * Parameters:
+ *    itemIndex - Index of the schedule slot that is due
+ *    currentCycles - The current cycle count
+ * Returns:
+ *    bool - true if the item is sheddable and the frame budget is used, in
+ *    which case the item is to be skipped
+ */
+static bool IsItemShed(const uint16_t itemIndex, const Timebase_CycleCount_t currentCycles);
 
 /** Description:
- *    Function to start the timer for a scheduled function.
+ *    Copy the settings of a configuration item into a schedule slot.
  * Parameters:
- *    timerIndex - Index into the Scheduler_configTable
+ *    itemIndex - Index of the schedule slot
+ *    configItem - The settings to be copied
  * Returns:
  *    none
  */
-static void StartTimer(const uint16_t timerIndex);
+static void LoadItem(const uint16_t itemIndex, const Scheduler_ConfigItem_t *const configItem);
 
 
 /*******************************************************************************
 // Private Function Implementations
 *******************************************************************************/
 
-// Function to start the timer for the function at the given index
-static void StartTimer(const uint16_t timerIndex)
+// Wrap-safe comparison of two absolute deadlines
+static bool IsDeadlineBefore(const Timebase_Tick_t deadline, const Timebase_Tick_t reference)
+{
+   return((int32_t)(deadline - reference) < 0);
+}
+
+// Order two queued items by deadline and then by priority
+static bool IsDueBefore(const uint16_t itemIndex, const uint16_t referenceIndex)
+{
+   return(IsDeadlineBefore(status.nextDeadline[itemIndex], status.nextDeadline[referenceIndex]) ||
+          ((status.nextDeadline[itemIndex] == status.nextDeadline[referenceIndex]) &&
+           (status.task[itemIndex].priority < status.task[referenceIndex].priority)));
+}
+
+// Restore the heap ordering moving toward the head
+static void SiftUp(uint16_t queuePosition)
 {
-   // Verify the timer index is valid
-   if (timerIndex < status.schedulerConfig->numConfigItems)
+   const uint16_t itemIndex = status.deadlineQueue[queuePosition];
+
+   while (DEADLINE_QUEUE_HEAD != queuePosition)
    {
-      // Calculate the desired interval in milliseconds and start the timer
-      SoftTimerLib_StartTimer(&status.schedulerItemTimer[timerIndex], (uint32_t)status.schedulerConfig->schedulerConfigArray[timerIndex].intervalMilliseconds);
+      const uint16_t parentPosition = (queuePosition - 1U) >> 1U;
+      const uint16_t parentIndex = status.deadlineQueue[parentPosition];
+
+      // Stop once the parent is due no later than the item being moved
+      if (!IsDueBefore(itemIndex, parentIndex))
+      {
+         break;
+      }
+
+      PlaceInQueue(queuePosition, parentIndex);
+      queuePosition = parentPosition;
    }
+
+   PlaceInQueue(queuePosition, itemIndex);
 }
 
+// Restore the heap ordering moving away from the head
+static void SiftDown(uint16_t queuePosition)
+{
+   const uint16_t itemIndex = status.deadlineQueue[queuePosition];
 
-/*******************************************************************************
-// Public Function Implementations
-*******************************************************************************/
+   for (;;)
+   {
+      uint16_t childPosition = (queuePosition << 1U) + 1U;
 
-// Initialize the scheduler module
-bool Scheduler_Init(const uint32_t moduleID, const Scheduler_Config_t *schedulerConfig)
-{
-    // Start with Scheduler disabled and uninitialized
-    status.isInitialized = false;
-    status.enableState = false;
+      if (childPosition >= status.deadlineQueueLength)
+      {
+         break;
+      }
 
-    // Store the module Id for error reporting
-    status.moduleId = moduleID;
+      // Select the child that is due first
+      if (((childPosition + 1U) < status.deadlineQueueLength) &&
+          IsDueBefore(status.deadlineQueue[childPosition + 1U], status.deadlineQueue[childPosition]))
+      {
+         childPosition++;
+      }
 
-    // First, validate the given parameter is valid
-    if ((NULL != schedulerConfig) && (NULL != schedulerConfig->schedulerConfigArray))
-    {
-        // Store the given configuration table
-        status.schedulerConfig = (Scheduler_Config_t *)schedulerConfig;
+      // Stop once the item being moved is due no later than either child
+      if (!IsDueBefore(status.deadlineQueue[childPosition], itemIndex))
+      {
+         break;
+      }
 
-        // Verify the given parameter
-        // Verify the number of entries in the table since that defines the number of timers
-        if ((schedulerConfig) && (MAX_SCHEDULED_FUNCTIONS >= schedulerConfig->numConfigItems))
-        {
-            // Store the given configuration table
-            status.schedulerConfig = (Scheduler_Config_t *)schedulerConfig;
+      PlaceInQueue(queuePosition, status.deadlineQueue[childPosition]);
+      queuePosition = childPosition;
+   }
 
-            // Loop through each timer in the array and initialize
-            for (uint16_t timerIndex = 0U; timerIndex < schedulerConfig->numConfigItems; timerIndex++)
-            {
-                SoftTimerLib_Init(&status.schedulerItemTimer[timerIndex]);
-            }
+   PlaceInQueue(queuePosition, itemIndex);
+}
 
-            // Mark initialization complete
-            status.isInitialized = true;
-        }
-    }
+// Store an item in the queue and remember where it is
+static void PlaceInQueue(const uint16_t queuePosition, const uint16_t itemIndex)
+{
+   status.deadlineQueue[queuePosition] = itemIndex;
+   status.queuePosition[itemIndex] = queuePosition;
+}
 
-    // Return completed initialization status
-    return(status.isInitialized);
+// Add the item at the given index to the deadline queue
+static void QueueItem(const uint16_t itemIndex)
+{
+   // Verify there is room in the queue and the item is not already queued
+   if ((status.deadlineQueueLength < MAX_SCHEDULED_FUNCTIONS) && (NOT_QUEUED == status.queuePosition[itemIndex]))
+   {
+      PlaceInQueue(status.deadlineQueueLength, itemIndex);
+      status.deadlineQueueLength++;
+      SiftUp(status.deadlineQueueLength - 1U);
+   }
 }
 
-// Scheduler entry point
-void Scheduler_Execute(void)
+// Remove the item at the given index from the deadline queue
+static void DequeueItem(const uint16_t itemIndex)
 {
-   // Make sure the scheduler has been initialized
-   if (status.isInitialized)
+   const uint16_t queuePosition = status.queuePosition[itemIndex];
+
+   if (NOT_QUEUED != queuePosition)
    {
-       // Verify the schedule table is valid
-       if (NULL != status.schedulerConfig)
-       {
-           // Enable the scheduler
-           status.enableState = true;
+      status.queuePosition[itemIndex] = NOT_QUEUED;
+      status.deadlineQueueLength--;
 
-           // Loop through and start all of the timers
-           for (uint16_t timerIndex = 0U; timerIndex < status.schedulerConfig->numConfigItems; timerIndex++)
-           {
-              StartTimer(timerIndex);
-           }
+      // Fill the hole with the last entry and restore the heap ordering around it
+      if (queuePosition != status.deadlineQueueLength)
+      {
+         const uint16_t movedIndex = status.deadlineQueue[status.deadlineQueueLength];
 
-           // Loop through the schedule table and call the functions when they have
-           // expired
-           while (status.enableState)
-           {
-              // Loop through and check each timer for expiration
-              // If expired, call the function
-              for (uint16_t timerIndex = 0U; timerIndex < status.schedulerConfig->numConfigItems; timerIndex++)
-              {
-                 // Check the timer to see if it is expired
-                 if (SoftTimerLib_IsTimerExpired(&status.schedulerItemTimer[timerIndex]))
-                 {
-                    // The timer is expired
-
-                    // Restart the timer -- the time is measured from the start of the
-                    // function to the start of the next time it is called
-                    StartTimer(timerIndex);
-
-                    // Verify the scheduler table has been configured and that the scheduled function is valid
-                    if (status.schedulerConfig && status.schedulerConfig->schedulerConfigArray[timerIndex].scheduledFunction)
-                    {
-                        // Finally, call the function
-                        status.schedulerConfig->schedulerConfigArray[timerIndex].scheduledFunction();
-                    }
-                 }
-              }
-           }
-       }
+         PlaceInQueue(queuePosition, movedIndex);
+         SiftUp(queuePosition);
+         SiftDown(status.queuePosition[movedIndex]);
+      }
    }
 }
 
-// Stop the scheduler
-void Scheduler_Stop(void)
+// Queue an item relative to the given tick
+static void StartItem(const uint16_t itemIndex, const Timebase_Tick_t startTick, const uint32_t delayMilliseconds)
+{
+   status.nextDeadline[itemIndex] = startTick +
+      ((status.task[itemIndex].intervalMilliseconds + delayMilliseconds) * (uint32_t)TIMEBASE_NUM_TICKS_PER_MILLISECOND);
+   QueueItem(itemIndex);
+}
+
+// Verify the settings of a schedule slot
+static bool IsConfigItemValid(const Scheduler_ConfigItem_t *const configItem)
+{
+   return((NULL != configItem) &&
+          (NULL != configItem->scheduledFunction) &&
+          (configItem->intervalMilliseconds <= POWER_SOFTTIMERLIB_MAX_DURATION_MILLISECONDS) &&
+          (configItem->phaseOffsetMilliseconds <= POWER_SOFTTIMERLIB_MAX_DURATION_MILLISECONDS));
+}
+
+// Verify the slot holds a function
+static bool IsItemInUse(const uint16_t itemIndex)
+{
+   return((status.isInitialized) && (itemIndex < MAX_SCHEDULED_FUNCTIONS) &&
+          ((NULL != status.task[itemIndex].scheduledFunction) || (NULL != status.task[itemIndex].coroutine)));
+}
+
+// Find the first spare slot
+static bool FindSpareItem(uint16_t *const itemIndex)
+{
+   bool isFound = false;
+
+   for (uint16_t spareIndex = 0U; (spareIndex < MAX_SCHEDULED_FUNCTIONS) && !isFound; spareIndex++)
+   {
+      if (!IsItemInUse(spareIndex))
+      {
+         *itemIndex = spareIndex;
+         isFound = true;
+      }
+   }
+
+   return(isFound);
+}
+
+// Call the contents of a slot
+static void CallItem(const uint16_t itemIndex)
+{
+   TaskState_t *const task = &status.task[itemIndex];
+
+   if (NULL != task->coroutine)
+   {
+      const CoroutineLib_Status_t coroutineStatus = task->coroutine(&task->coroutineContext);
+
+      // A finished coroutine gives up its slot
+      if ((COROUTINELIB_STATUS_ENDED == coroutineStatus) || (COROUTINELIB_STATUS_EXITED == coroutineStatus))
+      {
+         DequeueItem(itemIndex);
+         task->coroutine = NULL;
+      }
+   }
+   else
+   {
+      task->scheduledFunction();
+   }
+}
+
+// Calculate the next deadline of a due item
+static bool ScheduleNextCall(const uint16_t itemIndex, const Timebase_Tick_t currentTick)
+{
+   bool periodsSkipped = false;
+   const TaskState_t *const configItem = &status.task[itemIndex];
+   const Timebase_Tick_t intervalTicks = configItem->intervalMilliseconds * (uint32_t)TIMEBASE_NUM_TICKS_PER_MILLISECOND;
+
+   if ((SCHEDULER_MODE_FIXED_RATE == configItem->mode) && (0U != intervalTicks))
+   {
+      // Anchor the next call to the previous deadline so lateness does not accumulate
+      status.nextDeadline[itemIndex] += intervalTicks;
+
+      // If the next call is also already due, whole periods were missed.
+      // Skip them rather than calling back-to-back, keeping the original phase.
+      if (!IsDeadlineBefore(currentTick, status.nextDeadline[itemIndex]))
+      {
+         const uint32_t missedPeriods = ((currentTick - status.nextDeadline[itemIndex]) / intervalTicks) + 1U;
+
+         status.nextDeadline[itemIndex] += missedPeriods * intervalTicks;
+         status.taskProfile[itemIndex].skippedPeriodCount += missedPeriods;
+         periodsSkipped = true;
+      }
+   }
+   else
+   {
+      // The time is measured from the start of the function to the start of
+      // the next time it is called
+      status.nextDeadline[itemIndex] = currentTick + intervalTicks;
+   }
+
+   return(periodsSkipped);
+}
+
+// Validate the fast tier and build its call order
+static bool InitFastTier(const Scheduler_FastTierConfig_t *const fastTierConfig)
+{
+   bool isValid = true;
+
+   if (NULL != fastTierConfig)
+   {
+      isValid = ((NULL != fastTierConfig->fastTierConfigArray) &&
+                 (MAX_FAST_SCHEDULED_FUNCTIONS >= fastTierConfig->numConfigItems));
+
+      if (isValid)
+      {
+         // Insertion sort by priority. Equal priorities keep their table order.
+         for (uint16_t taskIndex = 0U; taskIndex < fastTierConfig->numConfigItems; taskIndex++)
+         {
+            uint16_t orderIndex = taskIndex;
+
+            while ((0U != orderIndex) &&
+                   (fastTierConfig->fastTierConfigArray[status.fastTaskOrder[orderIndex - 1U]].priority > fastTierConfig->fastTierConfigArray[taskIndex].priority))
+            {
+               status.fastTaskOrder[orderIndex] = status.fastTaskOrder[orderIndex - 1U];
+               orderIndex--;
+            }
+            status.fastTaskOrder[orderIndex] = taskIndex;
+
+            status.fastTaskDividerCount[taskIndex] = 0U;
+         }
+
+         ResetFastTierProfile();
+      }
+   }
+
+   return(isValid);
+}
+
+// Clear the fast tier statistics
+static void ResetFastTierProfile(void)
+{
+   status.fastTierDispatchCount = 0U;
+   status.fastTierOverrunCount = 0U;
+   status.fastTierMaxDispatchCycles = 0U;
+
+   for (uint16_t taskIndex = 0U; taskIndex < MAX_FAST_SCHEDULED_FUNCTIONS; taskIndex++)
+   {
+      status.fastTaskProfile[taskIndex].runCount = 0U;
+      status.fastTaskProfile[taskIndex].maxExecutionCycles = 0U;
+      status.fastTaskProfile[taskIndex].budgetSkipCount = 0U;
+   }
+}
+
+// Clear the execution profile of an item
+static void ResetProfile(const uint16_t itemIndex)
+{
+   TaskProfile_t *const profile = &status.taskProfile[itemIndex];
+
+   profile->runCount = 0U;
+   profile->eventRunCount = 0U;
+   profile->minExecutionCycles = UINT32_MAX;
+   profile->maxExecutionCycles = 0U;
+   profile->totalExecutionCycles = 0U;
+   profile->lastStartCycles = 0U;
+   profile->maxStartJitterCycles = 0U;
+   profile->overrunCount = 0U;
+   profile->skippedPeriodCount = 0U;
+   profile->shedCount = 0U;
+
+   for (uint16_t bin = 0U; bin < SCHEDULER_LATENCY_HISTOGRAM_BINS; bin++)
+   {
+      profile->latencyHistogram[bin] = 0U;
+   }
+}
+
+// Add the measurements of a single call to the profile of an item
+static void UpdateProfile(const uint16_t itemIndex, const Timebase_Tick_t latencyTicks,
+                          const Timebase_CycleCount_t startCycles, const Timebase_CycleCount_t endCycles,
+                          const bool periodsSkipped)
+{
+   TaskProfile_t *const profile = &status.taskProfile[itemIndex];
+   const uint32_t intervalMilliseconds = status.task[itemIndex].intervalMilliseconds;
+   const uint32_t executionCycles = endCycles - startCycles;
+   uint16_t bin = 0U;
+
+   // Jitter is only measured between calls made by interval, so note
+   // whether there was a previous one before this call is counted
+   const bool isFirstTimedRun = (profile->runCount == profile->eventRunCount);
+
+   RecordExecutionTime(itemIndex, executionCycles);
+
+   // Jitter and overruns can only be measured if the interval fits in the cycle counter
+   if (intervalMilliseconds <= MAX_PROFILED_INTERVAL_MILLISECONDS)
+   {
+      const uint32_t intervalCycles = intervalMilliseconds * TIMEBASE_NUM_CYCLES_PER_MILLISECOND;
+
+      if (executionCycles > intervalCycles)
+      {
+         profile->overrunCount++;
+      }
+
+      // Jitter is the deviation of the time since the previous call from the
+      // interval. There is no previous call to compare the first call with and
+      // the spacing is meaningless when whole periods were skipped.
+      if (!isFirstTimedRun && !periodsSkipped)
+      {
+         const uint32_t periodCycles = startCycles - profile->lastStartCycles;
+         const uint32_t jitterCycles = (periodCycles > intervalCycles) ? (periodCycles - intervalCycles) : (intervalCycles - periodCycles);
+
+         if (jitterCycles > profile->maxStartJitterCycles)
+         {
+            profile->maxStartJitterCycles = jitterCycles;
+         }
+      }
+   }
+   profile->lastStartCycles = startCycles;
+
+   // Bin 0 counts calls that started on time, bin n counts calls that started
+   // between 2^(n-1) and 2^n - 1 ticks late and the last bin counts the rest
+   for (Timebase_Tick_t remainingTicks = latencyTicks;
+        (0U != remainingTicks) && (bin < (SCHEDULER_LATENCY_HISTOGRAM_BINS - 1U));
+        remainingTicks >>= 1U)
+   {
+      bin++;
+   }
+   profile->latencyHistogram[bin]++;
+}
+
+// Add the execution time of a call to the profile of an item
+static void RecordExecutionTime(const uint16_t itemIndex, const uint32_t executionCycles)
+{
+   TaskProfile_t *const profile = &status.taskProfile[itemIndex];
+
+   if (executionCycles < profile->minExecutionCycles)
+   {
+      profile->minExecutionCycles = executionCycles;
+   }
+   if (executionCycles > profile->maxExecutionCycles)
+   {
+      profile->maxExecutionCycles = executionCycles;
+   }
+   profile->totalExecutionCycles += executionCycles;
+
+   profile->runCount++;
+}
+
+// Read and clear the pending events
+static Scheduler_EventMask_t TakePendingEvents(void)
+{
+   const uint16_t interruptState = Sys_EnterCritical();
+   const Scheduler_EventMask_t events = status.pendingEvents;
+
+   status.pendingEvents = 0U;
+   Sys_ExitCritical(interruptState);
+
+   return(events);
+}
+
+// Call every item waiting on the posted events
+static void DispatchEvents(const Scheduler_EventMask_t events)
+{
+   for (uint16_t itemIndex = 0U; itemIndex < MAX_SCHEDULED_FUNCTIONS; itemIndex++)
+   {
+      if (IsItemInUse(itemIndex) && !status.task[itemIndex].isSuspended &&
+          (0U != (status.task[itemIndex].eventMask & events)))
+      {
+         const Timebase_CycleCount_t startCycles = Timebase_GetCycleCount();
+
+         CallItem(itemIndex);
+         RecordExecutionTime(itemIndex, Timebase_GetCycleCount() - startCycles);
+         status.taskProfile[itemIndex].eventRunCount++;
+
+         // The item has just run, so a fixed delay item does not need its
+         // timed call until a full interval from now
+         if ((SCHEDULER_MODE_FIXED_DELAY == status.task[itemIndex].mode) &&
+             (NOT_QUEUED != status.queuePosition[itemIndex]))
+         {
+            DequeueItem(itemIndex);
+            StartItem(itemIndex, Timebase_GetCurrentTickCount(), 0U);
+         }
+      }
+   }
+}
+
+// Start a new load history
+static void ResetLoad(const Timebase_CycleCount_t currentCycles)
+{
+   status.load.windowStartCycles = currentCycles;
+   status.load.windowIdleCycles = 0U;
+   status.load.windowLoadIndex = 0U;
+   status.load.numWindows = 0U;
+   status.load.peakLoad = 0U;
+   status.load.frameOverrunCount = 0U;
+   status.load.shedCount = 0U;
+}
+
+// Close the load window once it is complete
+static void UpdateLoad(const Timebase_CycleCount_t currentCycles)
+{
+   const uint32_t elapsedCycles = currentCycles - status.load.windowStartCycles;
+
+   if (elapsedCycles >= LOAD_WINDOW_CYCLES)
+   {
+      // Everything that was not measured as idle counts as load, including
+      // the scheduler itself and any interrupts
+      const uint32_t busyCycles = (status.load.windowIdleCycles < elapsedCycles) ? (elapsedCycles - status.load.windowIdleCycles) : 0U;
+      const uint16_t windowLoad = (uint16_t)(((uint64_t)busyCycles * SCHEDULER_LOAD_FULL_SCALE) / elapsedCycles);
+
+      status.load.windowLoad[status.load.windowLoadIndex] = windowLoad;
+      status.load.windowLoadIndex = (status.load.windowLoadIndex + 1U) % SCHEDULER_LOAD_HISTORY_WINDOWS;
+      if (status.load.numWindows < SCHEDULER_LOAD_HISTORY_WINDOWS)
+      {
+         status.load.numWindows++;
+      }
+      if (windowLoad > status.load.peakLoad)
+      {
+         status.load.peakLoad = windowLoad;
+      }
+
+      status.load.windowStartCycles = currentCycles;
+      status.load.windowIdleCycles = 0U;
+   }
+}
+
+// Decide whether a due item is skipped to protect the frame budget
+static bool IsItemShed(const uint16_t itemIndex, const Timebase_CycleCount_t currentCycles)
+{
+   bool isShed = false;
+
+   if (!status.load.isFrameActive || ((currentCycles - status.load.frameStartCycles) >= MAX_FRAME_CYCLES))
+   {
+      status.load.isFrameActive = true;
+      status.load.isFrameOverrun = false;
+      status.load.frameStartCycles = currentCycles;
+   }
+   else if ((0U != status.schedulerConfig->frameBudgetCycles) &&
+            ((currentCycles - status.load.frameStartCycles) > status.schedulerConfig->frameBudgetCycles))
+   {
+      // Count each overrunning frame once
+      if (!status.load.isFrameOverrun)
+      {
+         status.load.isFrameOverrun = true;
+         status.load.frameOverrunCount++;
+      }
+
+      isShed = status.task[itemIndex].isSheddable && !status.task[itemIndex].wasShed;
+   }
+
+   status.task[itemIndex].wasShed = isShed;
+
+   return(isShed);
+}
+
+// Copy configuration settings into a slot
+static void LoadItem(const uint16_t itemIndex, const Scheduler_ConfigItem_t *const configItem)
+{
+   TaskState_t *const task = &status.task[itemIndex];
+
+   task->intervalMilliseconds = configItem->intervalMilliseconds;
+   task->scheduledFunction = configItem->scheduledFunction;
+   task->coroutine = NULL;
+   task->mode = configItem->mode;
+   task->phaseOffsetMilliseconds = configItem->phaseOffsetMilliseconds;
+   task->priority = configItem->priority;
+   task->isSheddable = configItem->isSheddable;
+   task->wasShed = false;
+   task->eventMask = configItem->eventMask;
+   task->isSuspended = false;
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Initialize the scheduler module
+bool Scheduler_Init(const uint32_t moduleID, const Scheduler_Config_t *schedulerConfig)
+{
+    // Start with Scheduler disabled and uninitialized
+    status.isInitialized = false;
+    status.enableState = false;
+
+    // Store the module Id for error reporting
+    status.moduleId = moduleID;
+
+    // Start with an empty deadline queue and no events
+    status.deadlineQueueLength = 0U;
+    status.pendingEvents = 0U;
+
+    // First, validate the given parameter is valid
+    if ((NULL != schedulerConfig) && (NULL != schedulerConfig->schedulerConfigArray))
+    {
+        // Verify the number of entries in the table since that defines the size of the deadline queue
+        if ((MAX_SCHEDULED_FUNCTIONS >= schedulerConfig->numConfigItems) &&
+            (InitFastTier(schedulerConfig->fastTierConfig)))
+        {
+            // Store the given configuration table
+            status.schedulerConfig = (Scheduler_Config_t *)schedulerConfig;
+
+            // Load the configuration table into the schedule slots. The
+            // remaining slots are left spare for functions added at runtime.
+            for (uint16_t itemIndex = 0U; itemIndex < MAX_SCHEDULED_FUNCTIONS; itemIndex++)
+            {
+               status.queuePosition[itemIndex] = NOT_QUEUED;
+               status.task[itemIndex].isSuspended = false;
+               status.task[itemIndex].scheduledFunction = NULL;
+               status.task[itemIndex].coroutine = NULL;
+
+               // Items with an interval beyond the maximum timer duration are never called
+               if ((itemIndex < schedulerConfig->numConfigItems) &&
+                   IsConfigItemValid(&schedulerConfig->schedulerConfigArray[itemIndex]))
+               {
+                  LoadItem(itemIndex, &schedulerConfig->schedulerConfigArray[itemIndex]);
+               }
+            }
+
+            // Mark initialization complete
+            status.isInitialized = true;
+        }
+    }
+
+    // Return completed initialization status
+    return(status.isInitialized);
+}
+
+// Scheduler entry point
+void Scheduler_Execute(void)
+{
+   // Make sure the scheduler has been initialized
+   if (status.isInitialized)
+   {
+       // Verify the schedule table is valid
+       if (NULL != status.schedulerConfig)
+       {
+           const Timebase_Tick_t startTick = Timebase_GetCurrentTickCount();
+
+           // Queue every item that is not suspended to be first called one
+           // interval plus its phase offset from now. All items share the same
+           // start tick so the phase offsets of fixed rate items remain fixed
+           // relative to each other.
+           status.deadlineQueueLength = 0U;
+           for (uint16_t itemIndex = 0U; itemIndex < MAX_SCHEDULED_FUNCTIONS; itemIndex++)
+           {
+              status.queuePosition[itemIndex] = NOT_QUEUED;
+              ResetProfile(itemIndex);
+
+              if (IsItemInUse(itemIndex) && !status.task[itemIndex].isSuspended)
+              {
+                 StartItem(itemIndex, startTick, status.task[itemIndex].phaseOffsetMilliseconds);
+              }
+           }
+
+           // Start measuring the CPU load
+           ResetLoad(Timebase_GetCycleCount());
+           status.load.isFrameActive = false;
+
+           // Enable the scheduler. Items added from now on are queued immediately.
+           status.enableState = true;
+
+           // Start dispatching the fast tier from its interrupt
+           if (NULL != status.schedulerConfig->fastTierConfig)
+           {
+              Sys_RegisterInterrupt(status.schedulerConfig->fastTierConfig->interruptNumber, Scheduler_FastTierHandler);
+              Sys_SetInterruptEnableState(status.schedulerConfig->fastTierConfig->interruptNumber, true);
+           }
+
+           // Only the head of the queue needs to be checked on each pass since
+           // it is always the item with the earliest deadline
+           while (status.enableState)
+           {
+              const Timebase_Tick_t currentTick = Timebase_GetCurrentTickCount();
+              const Scheduler_EventMask_t events = TakePendingEvents();
+
+              UpdateLoad(Timebase_GetCycleCount());
+
+              if (0U != events)
+              {
+                 // Items woken by an event are called ahead of any timed item
+                 DispatchEvents(events);
+              }
+              else if ((0U != status.deadlineQueueLength) &&
+                  !IsDeadlineBefore(currentTick, status.nextDeadline[status.deadlineQueue[DEADLINE_QUEUE_HEAD]]))
+              {
+                 const uint16_t itemIndex = status.deadlineQueue[DEADLINE_QUEUE_HEAD];
+                 const Timebase_Tick_t latencyTicks = currentTick - status.nextDeadline[itemIndex];
+                 Timebase_CycleCount_t startCycles;
+                 bool periodsSkipped;
+
+                 // Reschedule the item before calling it
+                 periodsSkipped = ScheduleNextCall(itemIndex, currentTick);
+                 SiftDown(DEADLINE_QUEUE_HEAD);
+
+                 startCycles = Timebase_GetCycleCount();
+                 if (IsItemShed(itemIndex, startCycles))
+                 {
+                    // The frame has used its budget. Skip this call of the
+                    // low priority item so the remaining items keep their rate.
+                    status.taskProfile[itemIndex].shedCount++;
+                    status.load.shedCount++;
+                 }
+                 else
+                 {
+                    // Finally, call the function and record how long it took
+                    CallItem(itemIndex);
+                    UpdateProfile(itemIndex, latencyTicks, startCycles, Timebase_GetCycleCount(), periodsSkipped);
+                 }
+              }
+              else
+              {
+                 // Nothing is due, so the current frame is complete. The time
+                 // until something is due again is counted as idle.
+                 const Timebase_CycleCount_t idleStartCycles = Timebase_GetCycleCount();
+
+                 status.load.isFrameActive = false;
+
+                 // Allow the CPU to sleep until the next deadline. An event
+                 // posted just before the CPU sleeps is handled when the next
+                 // interrupt wakes the CPU.
+                 if (NULL != status.schedulerConfig->idleFunction)
+                 {
+                    status.schedulerConfig->idleFunction(Scheduler_GetTicksUntilNextDeadline());
+                 }
+
+                 status.load.windowIdleCycles += Timebase_GetCycleCount() - idleStartCycles;
+              }
+           }
+
+           // The fast tier stops with the scheduler
+           if (NULL != status.schedulerConfig->fastTierConfig)
+           {
+              Sys_SetInterruptEnableState(status.schedulerConfig->fastTierConfig->interruptNumber, false);
+           }
+       }
+   }
+}
+
+// Stop the scheduler
+void Scheduler_Stop(void)
 {
     // Just set the scheduler state to disabled
     // This will allow the while loop to exit.
     // Note that this typically would not stop operation since it would cause the watchdog to reset the device, if enabled.
     status.enableState = false;
 }
+
+// Get the time remaining until the next scheduled item is due
+Timebase_Tick_t Scheduler_GetTicksUntilNextDeadline(void)
+{
+    // Default to nothing scheduled
+    Timebase_Tick_t remainingTicks = TIMEBASE_MAX_TICK_VALUE;
+
+    if (0U != status.pendingEvents)
+    {
+        // Items waiting on a posted event are due immediately
+        remainingTicks = 0U;
+    }
+    else if (0U != status.deadlineQueueLength)
+    {
+        const Timebase_Tick_t currentTick = Timebase_GetCurrentTickCount();
+        const Timebase_Tick_t headDeadline = status.nextDeadline[status.deadlineQueue[DEADLINE_QUEUE_HEAD]];
+
+        // An item that is already due has no time remaining
+        remainingTicks = IsDeadlineBefore(currentTick, headDeadline) ? (headDeadline - currentTick) : 0U;
+    }
+
+    return(remainingTicks);
+}
+
+// Post events from the background loop or an interrupt
+void Scheduler_PostEvent(const Scheduler_EventMask_t eventMask)
+{
+    const uint16_t interruptState = Sys_EnterCritical();
+
+    status.pendingEvents |= eventMask;
+    Sys_ExitCritical(interruptState);
+}
+
+// Stop calling a scheduled item
+bool Scheduler_SuspendTask(const uint16_t taskIndex)
+{
+    bool isSuccessful = false;
+
+    if (IsItemInUse(taskIndex))
+    {
+        status.task[taskIndex].isSuspended = true;
+        DequeueItem(taskIndex);
+        isSuccessful = true;
+    }
+
+    return(isSuccessful);
+}
+
+// Start calling a suspended item again
+bool Scheduler_ResumeTask(const uint16_t taskIndex)
+{
+    bool isSuccessful = false;
+
+    if (IsItemInUse(taskIndex))
+    {
+        if (status.task[taskIndex].isSuspended)
+        {
+            status.task[taskIndex].isSuspended = false;
+
+            // The first call after resuming is one interval from now. If the
+            // scheduler is not running yet, the item is queued when it starts.
+            if (status.enableState)
+            {
+                StartItem(taskIndex, Timebase_GetCurrentTickCount(), 0U);
+            }
+        }
+
+        isSuccessful = true;
+    }
+
+    return(isSuccessful);
+}
+
+// Change the interval of a scheduled item
+bool Scheduler_SetTaskInterval(const uint16_t taskIndex, const uint32_t intervalMilliseconds)
+{
+    bool isSuccessful = false;
+
+    if ((IsItemInUse(taskIndex)) && (intervalMilliseconds <= POWER_SOFTTIMERLIB_MAX_DURATION_MILLISECONDS))
+    {
+        status.task[taskIndex].intervalMilliseconds = intervalMilliseconds;
+
+        // Re-anchor a queued item so the new interval takes effect immediately
+        if (NOT_QUEUED != status.queuePosition[taskIndex])
+        {
+            DequeueItem(taskIndex);
+            StartItem(taskIndex, Timebase_GetCurrentTickCount(), 0U);
+        }
+
+        isSuccessful = true;
+    }
+
+    return(isSuccessful);
+}
+
+// Place a new item in a spare slot
+bool Scheduler_AddTask(const Scheduler_ConfigItem_t *const configItem, uint16_t *const taskIndex)
+{
+    bool isSuccessful = false;
+    uint16_t itemIndex;
+
+    if ((status.isInitialized) && (NULL != taskIndex) && IsConfigItemValid(configItem) && FindSpareItem(&itemIndex))
+    {
+        LoadItem(itemIndex, configItem);
+        ResetProfile(itemIndex);
+
+        // If the scheduler is not running yet, the item is queued when it starts
+        if (status.enableState)
+        {
+            StartItem(itemIndex, Timebase_GetCurrentTickCount(), configItem->phaseOffsetMilliseconds);
+        }
+
+        *taskIndex = itemIndex;
+        isSuccessful = true;
+    }
+
+    return(isSuccessful);
+}
+
+// Place a new coroutine in a spare slot
+bool Scheduler_StartCoroutine(const Scheduler_Coroutine_t coroutine, const uint32_t intervalMilliseconds,
+                              const Scheduler_EventMask_t eventMask, uint16_t *const taskIndex)
+{
+    bool isSuccessful = false;
+    uint16_t itemIndex;
+
+    if ((status.isInitialized) && (NULL != coroutine) && (NULL != taskIndex) &&
+        (intervalMilliseconds <= POWER_SOFTTIMERLIB_MAX_DURATION_MILLISECONDS) && FindSpareItem(&itemIndex))
+    {
+        TaskState_t *const task = &status.task[itemIndex];
+
+        task->intervalMilliseconds = intervalMilliseconds;
+        task->scheduledFunction = NULL;
+        task->coroutine = coroutine;
+        task->mode = SCHEDULER_MODE_FIXED_DELAY;
+        task->phaseOffsetMilliseconds = 0U;
+        task->priority = UINT16_MAX;
+        // A shed call would stall the coroutine part way through its work
+        task->isSheddable = false;
+        task->wasShed = false;
+        task->eventMask = eventMask;
+        task->isSuspended = false;
+        COROUTINELIB_INIT(&task->coroutineContext);
+        ResetProfile(itemIndex);
+
+        // If the scheduler is not running yet, the coroutine is queued when it starts
+        if (status.enableState)
+        {
+            StartItem(itemIndex, Timebase_GetCurrentTickCount(), 0U);
+        }
+
+        *taskIndex = itemIndex;
+        isSuccessful = true;
+    }
+
+    return(isSuccessful);
+}
+
+// Free the slot of a scheduled item
+bool Scheduler_RemoveTask(const uint16_t taskIndex)
+{
+    bool isSuccessful = false;
+
+    if (IsItemInUse(taskIndex))
+    {
+        DequeueItem(taskIndex);
+        status.task[taskIndex].scheduledFunction = NULL;
+        status.task[taskIndex].coroutine = NULL;
+        isSuccessful = true;
+    }
+
+    return(isSuccessful);
+}
+
+// Get the execution profile of a scheduled item
+void Scheduler_MessageRouter_GetTaskProfile(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the command
+   typedef struct
+   {
+      // Index of the item in the schedule table
+      uint16_t taskIndex;
+   } Command_t;
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // Index of the item in the schedule table
+      uint16_t taskIndex;
+      // Padding for 32-bit alignment
+      uint16_t dummy;
+      // Number of times the function has been called
+      uint32_t runCount;
+      // Shortest, longest and mean execution time (in cycles)
+      uint32_t minExecutionCycles;
+      uint32_t maxExecutionCycles;
+      uint32_t meanExecutionCycles;
+      // Largest deviation of the time between two calls from the interval (in cycles)
+      uint32_t maxStartJitterCycles;
+      // Number of calls that took longer to execute than the interval
+      uint32_t overrunCount;
+      // Number of calls skipped because a whole period was missed
+      uint32_t skippedPeriodCount;
+      // Number of the calls that were made because of a posted event
+      uint32_t eventRunCount;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // Verify the index is valid
+      if (IsItemInUse(command->taskIndex))
+      {
+         const TaskProfile_t *const profile = &status.taskProfile[command->taskIndex];
+
+         response->taskIndex = command->taskIndex;
+         response->dummy = 0U;
+         response->runCount = profile->runCount;
+         response->minExecutionCycles = (0U != profile->runCount) ? profile->minExecutionCycles : 0U;
+         response->maxExecutionCycles = profile->maxExecutionCycles;
+         response->meanExecutionCycles = (0U != profile->runCount) ? (uint32_t)(profile->totalExecutionCycles / profile->runCount) : 0U;
+         response->maxStartJitterCycles = profile->maxStartJitterCycles;
+         response->overrunCount = profile->overrunCount;
+         response->skippedPeriodCount = profile->skippedPeriodCount;
+         response->eventRunCount = profile->eventRunCount;
+
+         // Set the response length
+         MessageRouter_SetResponseSize(message, sizeof(Response_t));
+      }
+   }
+}
+
+// Get the start latency histogram of a scheduled item
+void Scheduler_MessageRouter_GetLatencyHistogram(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the command
+   typedef struct
+   {
+      // Index of the item in the schedule table
+      uint16_t taskIndex;
+   } Command_t;
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // Index of the item in the schedule table
+      uint16_t taskIndex;
+      // Padding for 32-bit alignment
+      uint16_t dummy;
+      // Number of calls in each latency bin
+      uint32_t latencyHistogram[SCHEDULER_LATENCY_HISTOGRAM_BINS];
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // Verify the index is valid
+      if (IsItemInUse(command->taskIndex))
+      {
+         response->taskIndex = command->taskIndex;
+         response->dummy = 0U;
+
+         for (uint16_t bin = 0U; bin < SCHEDULER_LATENCY_HISTOGRAM_BINS; bin++)
+         {
+            response->latencyHistogram[bin] = status.taskProfile[command->taskIndex].latencyHistogram[bin];
+         }
+
+         // Set the response length
+         MessageRouter_SetResponseSize(message, sizeof(Response_t));
+      }
+   }
+}
+
+// Clear the execution profile of all scheduled items
+void Scheduler_MessageRouter_ResetProfile(MessageRouter_Message_t *const message)
+{
+   // Verify no parameters were given and there is room for an empty response
+   if (MessageRouter_VerifyParameterSizes(message, 0, 0))
+   {
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      if (status.isInitialized)
+      {
+         for (uint16_t itemIndex = 0U; itemIndex < MAX_SCHEDULED_FUNCTIONS; itemIndex++)
+         {
+            ResetProfile(itemIndex);
+         }
+
+         ResetFastTierProfile();
+         ResetLoad(Timebase_GetCycleCount());
+      }
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, 0);
+   }
+}
+
+// Get the dispatch statistics of the fast tier
+void Scheduler_MessageRouter_GetFastTierStatus(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // Number of times the fast tier has been dispatched
+      uint32_t dispatchCount;
+      // Number of dispatches that took longer than the tier budget
+      uint32_t overrunCount;
+      // Longest dispatch of the fast tier (in cycles)
+      uint32_t maxDispatchCycles;
+      // The configured budget of the fast tier (in cycles)
+      uint32_t budgetCycles;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      response->dispatchCount = status.fastTierDispatchCount;
+      response->overrunCount = status.fastTierOverrunCount;
+      response->maxDispatchCycles = status.fastTierMaxDispatchCycles;
+      response->budgetCycles = ((status.isInitialized) && (NULL != status.schedulerConfig->fastTierConfig)) ?
+                                  status.schedulerConfig->fastTierConfig->budgetCycles : 0U;
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Get the execution profile of a fast tier function
+void Scheduler_MessageRouter_GetFastTaskProfile(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the command
+   typedef struct
+   {
+      // Index of the function in the fast tier table
+      uint16_t taskIndex;
+   } Command_t;
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // Index of the function in the fast tier table
+      uint16_t taskIndex;
+      // Padding for 32-bit alignment
+      uint16_t dummy;
+      // Number of times the function has been called
+      uint32_t runCount;
+      // Longest execution time of the function (in cycles)
+      uint32_t maxExecutionCycles;
+      // Number of calls skipped because the tier budget was already used
+      uint32_t budgetSkipCount;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // Verify the index is valid
+      if ((status.isInitialized) && (NULL != status.schedulerConfig->fastTierConfig) &&
+          (command->taskIndex < status.schedulerConfig->fastTierConfig->numConfigItems))
+      {
+         response->taskIndex = command->taskIndex;
+         response->dummy = 0U;
+         response->runCount = status.fastTaskProfile[command->taskIndex].runCount;
+         response->maxExecutionCycles = status.fastTaskProfile[command->taskIndex].maxExecutionCycles;
+         response->budgetSkipCount = status.fastTaskProfile[command->taskIndex].budgetSkipCount;
+
+         // Set the response length
+         MessageRouter_SetResponseSize(message, sizeof(Response_t));
+      }
+   }
+}
+
+// Suspend a scheduled item
+void Scheduler_MessageRouter_SuspendTask(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the command
+   typedef struct
+   {
+      // Index of the schedule slot
+      uint16_t taskIndex;
+   } Command_t;
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // 1 if the item was suspended, 0 if the index is not in use
+      uint16_t isSuccessful;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      response->isSuccessful = Scheduler_SuspendTask(command->taskIndex);
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Resume a suspended item
+void Scheduler_MessageRouter_ResumeTask(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the command
+   typedef struct
+   {
+      // Index of the schedule slot
+      uint16_t taskIndex;
+   } Command_t;
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // 1 if the item was resumed, 0 if the index is not in use
+      uint16_t isSuccessful;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      response->isSuccessful = Scheduler_ResumeTask(command->taskIndex);
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Change the interval of a scheduled item
+void Scheduler_MessageRouter_SetTaskInterval(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the command
+   typedef struct
+   {
+      // Index of the schedule slot
+      uint16_t taskIndex;
+      // Padding for 32-bit alignment
+      uint16_t dummy;
+      // New interval (in Milliseconds)
+      uint32_t intervalMilliseconds;
+   } Command_t;
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // 1 if the interval was changed, 0 if the index or interval is not valid
+      uint16_t isSuccessful;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      response->isSuccessful = Scheduler_SetTaskInterval(command->taskIndex, command->intervalMilliseconds);
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Get the current settings of a schedule slot
+void Scheduler_MessageRouter_GetTaskInfo(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the command
+   typedef struct
+   {
+      // Index of the schedule slot
+      uint16_t taskIndex;
+   } Command_t;
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // Index of the schedule slot
+      uint16_t taskIndex;
+      // 0: Spare, 1: Active, 2: Suspended
+      uint16_t taskState;
+      // Interval (in Milliseconds)
+      uint32_t intervalMilliseconds;
+      // Scheduler_Mode_t value
+      uint16_t mode;
+      // Padding for 32-bit alignment
+      uint16_t dummy;
+      // Phase offset of the first call (in Milliseconds)
+      uint32_t phaseOffsetMilliseconds;
+      // Order of items due on the same tick
+      uint16_t priority;
+      // 1 if the item may be skipped when the frame budget is used
+      uint16_t isSheddable;
+      // Number of calls skipped because the frame budget was already used
+      uint32_t shedCount;
+      // Events that cause the item to be called before its interval
+      uint16_t eventMask;
+      // Padding for 32-bit alignment
+      uint16_t dummy2;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // Verify the index is valid
+      if ((status.isInitialized) && (command->taskIndex < MAX_SCHEDULED_FUNCTIONS))
+      {
+         const TaskState_t *const task = &status.task[command->taskIndex];
+
+         response->taskIndex = command->taskIndex;
+         response->taskState = !IsItemInUse(command->taskIndex) ? 0U : (task->isSuspended ? 2U : 1U);
+         response->intervalMilliseconds = task->intervalMilliseconds;
+         response->mode = (uint16_t)task->mode;
+         response->dummy = 0U;
+         response->phaseOffsetMilliseconds = task->phaseOffsetMilliseconds;
+         response->priority = task->priority;
+         response->isSheddable = task->isSheddable;
+         response->shedCount = status.taskProfile[command->taskIndex].shedCount;
+         response->eventMask = task->eventMask;
+         response->dummy2 = 0U;
+
+         // Set the response length
+         MessageRouter_SetResponseSize(message, sizeof(Response_t));
+      }
+   }
+}
+
+// Add one of the board's optional functions to a spare slot
+void Scheduler_MessageRouter_AddTask(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the command
+   typedef struct
+   {
+      // Index into the optional function table of the board configuration
+      uint16_t optionalIndex;
+      // Padding for 32-bit alignment
+      uint16_t dummy;
+      // Interval (in Milliseconds). 0 uses the interval from the optional function table.
+      uint32_t intervalMilliseconds;
+   } Command_t;
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // Index of the schedule slot used or SCHEDULER_INVALID_TASK_INDEX if the function could not be added
+      uint16_t taskIndex;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      response->taskIndex = SCHEDULER_INVALID_TASK_INDEX;
+
+      if ((status.isInitialized) && (NULL != status.schedulerConfig->optionalConfigArray) &&
+          (command->optionalIndex < status.schedulerConfig->numOptionalItems))
+      {
+         const Scheduler_ConfigItem_t *const optionalItem = &status.schedulerConfig->optionalConfigArray[command->optionalIndex];
+         const Scheduler_ConfigItem_t newItem =
+         {
+            .intervalMilliseconds = (0U != command->intervalMilliseconds) ? command->intervalMilliseconds : optionalItem->intervalMilliseconds,
+            .scheduledFunction = optionalItem->scheduledFunction,
+            .mode = optionalItem->mode,
+            .phaseOffsetMilliseconds = optionalItem->phaseOffsetMilliseconds,
+            .priority = optionalItem->priority,
+            .isSheddable = optionalItem->isSheddable,
+            .eventMask = optionalItem->eventMask
+         };
+         uint16_t taskIndex;
+
+         if (Scheduler_AddTask(&newItem, &taskIndex))
+         {
+            response->taskIndex = taskIndex;
+         }
+      }
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Free the slot of a scheduled item
+void Scheduler_MessageRouter_RemoveTask(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the command
+   typedef struct
+   {
+      // Index of the schedule slot
+      uint16_t taskIndex;
+   } Command_t;
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // 1 if the item was removed, 0 if the index is not in use
+      uint16_t isSuccessful;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      response->isSuccessful = Scheduler_RemoveTask(command->taskIndex);
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+
+// Get the CPU load and load shedding statistics
+void Scheduler_MessageRouter_GetLoad(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // Load of the most recent completed window (in hundredths of a percent)
+      uint16_t lastLoad;
+      // Mean load over the completed windows in the history (in hundredths of a percent)
+      uint16_t averageLoad;
+      // Highest load of any completed window (in hundredths of a percent)
+      uint16_t peakLoad;
+      // Number of windows included in averageLoad
+      uint16_t numWindows;
+      // Length of one window (in Milliseconds)
+      uint32_t windowMilliseconds;
+      // Number of frames that used more than the frame budget
+      uint32_t frameOverrunCount;
+      // Number of calls skipped because the frame budget was already used
+      uint32_t shedCount;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+      uint32_t totalLoad = 0U;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      for (uint16_t window = 0U; window < status.load.numWindows; window++)
+      {
+         totalLoad += status.load.windowLoad[window];
+      }
+
+      // The most recent window is the one before the next write position
+      response->lastLoad = (0U != status.load.numWindows) ?
+         status.load.windowLoad[(status.load.windowLoadIndex + SCHEDULER_LOAD_HISTORY_WINDOWS - 1U) % SCHEDULER_LOAD_HISTORY_WINDOWS] : 0U;
+      response->averageLoad = (0U != status.load.numWindows) ? (uint16_t)(totalLoad / status.load.numWindows) : 0U;
+      response->peakLoad = status.load.peakLoad;
+      response->numWindows = status.load.numWindows;
+      response->windowMilliseconds = SCHEDULER_LOAD_WINDOW_MILLISECONDS;
+      response->frameOverrunCount = status.load.frameOverrunCount;
+      response->shedCount = status.load.shedCount;
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+/*******************************************************************************
+// Interrupt Handler
+*******************************************************************************/
+
+// Dispatch the fast tier functions in priority order
+INTERRUPT_FUNC void Scheduler_FastTierHandler(void)
+{
+   const Timebase_CycleCount_t dispatchStartCycles = Timebase_GetCycleCount();
+   const Scheduler_FastTierConfig_t *const fastTier = status.schedulerConfig->fastTierConfig;
+   uint32_t dispatchCycles;
+
+   // Clear the interrupt source first so an event that occurs during a long
+   // dispatch is held pending rather than lost
+   if (NULL != fastTier->acknowledgeFunction)
+   {
+      fastTier->acknowledgeFunction();
+   }
+
+   for (uint16_t orderIndex = 0U; orderIndex < fastTier->numConfigItems; orderIndex++)
+   {
+      const uint16_t taskIndex = status.fastTaskOrder[orderIndex];
+      FastTaskProfile_t *const profile = &status.fastTaskProfile[taskIndex];
+
+      status.fastTaskDividerCount[taskIndex]++;
+
+      if (status.fastTaskDividerCount[taskIndex] >= fastTier->fastTierConfigArray[taskIndex].rateDivider)
+      {
+         status.fastTaskDividerCount[taskIndex] = 0U;
+
+         // The highest priority function is always called. The others are
+         // skipped once the tier has used its budget for this interrupt.
+         if ((0U != orderIndex) && ((Timebase_GetCycleCount() - dispatchStartCycles) >= fastTier->budgetCycles))
+         {
+            profile->budgetSkipCount++;
+         }
+         else
+         {
+            const Timebase_CycleCount_t startCycles = Timebase_GetCycleCount();
+            uint32_t executionCycles;
+
+            fastTier->fastTierConfigArray[taskIndex].scheduledFunction();
+
+            executionCycles = Timebase_GetCycleCount() - startCycles;
+            if (executionCycles > profile->maxExecutionCycles)
+            {
+               profile->maxExecutionCycles = executionCycles;
+            }
+            profile->runCount++;
+         }
+      }
+   }
+
+   // Record the total cost of this dispatch
+   dispatchCycles = Timebase_GetCycleCount() - dispatchStartCycles;
+   if (dispatchCycles > fastTier->budgetCycles)
+   {
+      status.fastTierOverrunCount++;
+   }
+   if (dispatchCycles > status.fastTierMaxDispatchCycles)
+   {
+      status.fastTierMaxDispatchCycles = dispatchCycles;
+   }
+   status.fastTierDispatchCount++;
+}
@@ -11,6 +11,9 @@
 // Module Includes
 #include "Scheduler_Config.h" // Defines scheduled functions
 // Platform Includes
+#include "CoroutineLib.h" // Defines coroutine contexts
+#include "MessageRouter.h"
+#include "Timebase.h" // Defines Timebase_Tick_t
 // Other Includes
 #include <stdbool.h> // Defines C99 boolean type
 #include <stdint.h>  // Defines C99 integer types
@@ -29,6 +32,19 @@ extern "C"
 // Public Constant Definitions
 *******************************************************************************/
 
+// Number of bins in the start latency histogram kept for each scheduled item.
+// Bin 0 counts calls that started on the tick they were due, bin n counts
+// calls that started 2^(n-1) to 2^n - 1 ticks late and the last bin counts
+// all later calls.
+#define SCHEDULER_LATENCY_HISTOGRAM_BINS (8U)
+
+// CPU load reported for a fully loaded window. Load is reported in hundredths
+// of a percent.
+#define SCHEDULER_LOAD_FULL_SCALE (10000U)
+
+// Task index returned when a function could not be added to the schedule
+#define SCHEDULER_INVALID_TASK_INDEX (UINT16_MAX)
+
 
 /*******************************************************************************
 // Public Type Declarations
@@ -37,11 +53,39 @@ extern "C"
 // This is the type definition for all scheduled functions.
 typedef void (*Scheduler_Function_t)(void);
 
+// This is the type definition for scheduled coroutines. A coroutine is called
+// like a scheduled function but may wait or yield part way through and
+// continue from that point on its next call (see CoroutineLib.h).
+typedef CoroutineLib_Status_t (*Scheduler_Coroutine_t)(CoroutineLib_Context_t *const context);
+
+// This is the type definition for the optional idle function. The function is
+// called whenever no scheduled item is due and is given the number of Timebase
+// ticks remaining until the next deadline so the CPU can be put to sleep.
+typedef void (*Scheduler_IdleFunction_t)(const Timebase_Tick_t ticksUntilNextDeadline);
+
+// Set of event flags. Each bit is one event defined by the board configuration
+// (see SCHEDULER_EVENT_* in Scheduler_Config.h).
+typedef uint16_t Scheduler_EventMask_t;
+
+// Defines how the next call of a scheduled function is timed
+typedef enum
+{
+   // The interval is measured from the time the function is called. Any delay
+   // in calling the function pushes all later calls out by the same amount.
+   SCHEDULER_MODE_FIXED_DELAY,
+   // The function is called at fixed absolute ticks (start + phase + n * interval)
+   // so the period never drifts. If one or more periods are missed entirely,
+   // the missed calls are skipped and the next call keeps the original phase.
+   SCHEDULER_MODE_FIXED_RATE
+} Scheduler_Mode_t;
+
 // This is the structure for each scheduler entry. Interval is
 // the number of scheduler ticks (milliseconds) in which this
 // function is to be called. scheduledFunction is the address of
 // the scheduled function. Each entry should have an Interval,
-// and a pointer to the function to be called.
+// a pointer to the function to be called, the scheduling mode,
+// a phase offset, a priority, whether it may be shed and the
+// events that wake it.
 typedef struct
 {
    // Periodic interval in which the specified function is to be called (in Milliseconds)
@@ -50,8 +94,66 @@ typedef struct
 
    // The function that is to be called upon when the specified duration elaspes.
    const Scheduler_Function_t scheduledFunction;
+
+   // Defines how the interval is measured between calls
+   Scheduler_Mode_t mode;
+
+   // Delay added to the first call of the function (in Milliseconds). Giving
+   // functions with the same interval different offsets spreads them across
+   // different ticks. Note that this value should be less than the interval.
+   uint32_t phaseOffsetMilliseconds;
+
+   // Order in which functions due on the same tick are called. Lower values
+   // are called first.
+   uint16_t priority;
+
+   // A sheddable function is skipped for a period when the frame budget has
+   // already been used, so that the other functions keep their rate. It is
+   // never skipped twice in a row.
+   bool isSheddable;
+
+   // Events that also cause the function to be called. When any of these
+   // events is posted, the function is called on the next pass of the loop
+   // rather than waiting for its interval (0 if only called by interval).
+   Scheduler_EventMask_t eventMask;
 } Scheduler_ConfigItem_t;
 
+// This is the structure for each entry of the fast tier. Fast tier functions
+// are called from a hardware interrupt rather than the background loop.
+typedef struct
+{
+   // Order in which the functions are called on each interrupt. Lower values
+   // are called first. Functions with equal priority are called in table order.
+   uint16_t priority;
+
+   // The function is called once every rateDivider interrupts (1 = every interrupt)
+   uint16_t rateDivider;
+
+   // The function that is to be called from the interrupt
+   const Scheduler_Function_t scheduledFunction;
+} Scheduler_FastTierConfigItem_t;
+
+// Defines the fast tier of the scheduler.
+typedef struct
+{
+    // The number of items defined in the fastTierConfigArray
+    uint32_t numConfigItems;
+
+    // The functions dispatched by the fast tier
+    const Scheduler_FastTierConfigItem_t *fastTierConfigArray;
+
+    // The device interrupt that dispatches the fast tier (Ex. INT_EPWM2)
+    uint32_t interruptNumber;
+
+    // Called at the start of each dispatch to clear the interrupt source
+    const Scheduler_Function_t acknowledgeFunction;
+
+    // The number of cycles the tier may use for one dispatch. Once exceeded,
+    // the remaining (lower priority) functions are skipped for that interrupt.
+    // The highest priority function is always called.
+    uint32_t budgetCycles;
+} Scheduler_FastTierConfig_t;
+
 // Defines the structure that contains the configuration data for the module.
 // This should be passed at structure to the module's initialization function.
 typedef struct
@@ -63,6 +165,25 @@ typedef struct
     // This is allows the the API functions ramain the same for all platforms but 
     // still allows each platform to customized the configuration data.
     const Scheduler_ConfigItem_t *schedulerConfigArray;
+
+    // Optional function called when no scheduled item is due (NULL if unused)
+    const Scheduler_IdleFunction_t idleFunction;
+
+    // Optional interrupt-driven fast tier (NULL if unused)
+    const Scheduler_FastTierConfig_t *fastTierConfig;
+
+    // The number of cycles the background loop may spend calling due
+    // functions back-to-back before sheddable functions are skipped (0 to
+    // never shed). A frame ends whenever nothing is due, and otherwise after
+    // SCHEDULER_MAX_FRAME_MILLISECONDS.
+    uint32_t frameBudgetCycles;
+
+    // The number of items defined in the optionalConfigArray
+    uint32_t numOptionalItems;
+
+    // Optional functions that are not scheduled at startup but may be added
+    // to a spare slot at runtime by command (NULL if unused)
+    const Scheduler_ConfigItem_t *optionalConfigArray;
 } Scheduler_Config_t;
 
 
@@ -72,9 +193,10 @@ typedef struct
 
 /*******************************************************************************
 // Description:
-//    Initialize the scheduler module and configure a timer for each function
-//    in the given configuration structure.  The timers are not started until
-//    Scheduler_Execute() is called.
+//    Initialize the scheduler module and load each function in the given
+//    configuration structure into a schedule slot. Slot indices match the
+//    configuration table and the remaining slots are spare. The functions are
+//    not queued until Scheduler_Execute() is called.
 // Parameters:
 //    moduleId - The numeric module identifier to be used for the module.
 //       Note that this value should be unique to to each module in the system.
@@ -93,10 +215,13 @@ bool Scheduler_Init(const uint32_t moduleID, const Scheduler_Config_t *scheduler
 /** Description:
  *     Entry point for the scheduler module.  Note that the
  *     function will not return until the scheduler is stopped.
- *     This function will loop through the configured schedule
- *     table and check the corresponding timer for expiration.
- *     When a timer for a scheduled item is expired, the
+ *     Scheduled items are kept in a queue ordered by their next
+ *     deadline so only the item at the head of the queue is
+ *     checked on each pass. When the head item is due, the
  *     function pointer for that scheduled item is executed.
+ *     Otherwise the configured idle function (if any) is called.
+ *     The time spent idle is used to measure the CPU load and
+ *     sheddable items are skipped while the frame budget is used.
  * Returns:
  *     none
  *
@@ -112,6 +237,187 @@ void Scheduler_Execute(void);
  */
 void Scheduler_Stop(void);
 
+/** Description:
+ *     Get the number of Timebase ticks remaining until the next
+ *     scheduled item is due.
+ * Returns:
+ *     Timebase_Tick_t - The number of ticks until the next deadline. Zero is
+ *     returned if an item is already due or an event is pending and
+ *     TIMEBASE_MAX_TICK_VALUE is
+ *     returned if no items are scheduled.
+ */
+Timebase_Tick_t Scheduler_GetTicksUntilNextDeadline(void);
+
+/** Description:
+ *     Post one or more events. Every item waiting on any of the given events
+ *     is called on the next pass of the scheduler loop. Posting an event
+ *     that is already pending has no further effect. This function may be
+ *     called from an interrupt.
+ * Parameters:
+ *     eventMask - The events to be posted
+ * Returns:
+ *     none
+ */
+void Scheduler_PostEvent(const Scheduler_EventMask_t eventMask);
+
+/** Description:
+ *     Start a coroutine in the first spare schedule slot. The coroutine is
+ *     called once per interval (and on the given events) until it ends or
+ *     exits, after which its slot is made spare again. Coroutines run at the
+ *     lowest priority and are never shed. Use Scheduler_RemoveTask() to stop a
+ *     coroutine early.
+ * Parameters:
+ *     coroutine - The coroutine to be started from its beginning
+ *     intervalMilliseconds - Time between calls. 0 calls the coroutine on
+ *     every pass of the loop, which keeps the CPU from idling.
+ *     eventMask - Events that also cause the coroutine to be called (0 if none)
+ *     taskIndex - Set to the index of the slot used
+ * Returns:
+ *     bool - true if the coroutine was started, false if the settings are not
+ *     valid or there are no spare slots
+ */
+bool Scheduler_StartCoroutine(const Scheduler_Coroutine_t coroutine, const uint32_t intervalMilliseconds,
+                              const Scheduler_EventMask_t eventMask, uint16_t *const taskIndex);
+
+/** Description:
+ *     Stop calling a scheduled item. The item keeps its slot and settings.
+ * Parameters:
+ *     taskIndex - Index of the schedule slot
+ * Returns:
+ *     bool - true if the slot is in use and is now suspended
+ */
+bool Scheduler_SuspendTask(const uint16_t taskIndex);
+
+/** Description:
+ *     Start calling a suspended item again. The first call is made one
+ *     interval after this function is called.
+ * Parameters:
+ *     taskIndex - Index of the schedule slot
+ * Returns:
+ *     bool - true if the slot is in use and is no longer suspended
+ */
+bool Scheduler_ResumeTask(const uint16_t taskIndex);
+
+/** Description:
+ *     Change the interval of a scheduled item. The next call is made one new
+ *     interval after this function is called.
+ * Parameters:
+ *     taskIndex - Index of the schedule slot
+ *     intervalMilliseconds - The new interval. This must not be more than the
+ *     maximum software timer duration.
+ * Returns:
+ *     bool - true if the slot is in use and the interval was changed
+ */
+bool Scheduler_SetTaskInterval(const uint16_t taskIndex, const uint32_t intervalMilliseconds);
+
+/** Description:
+ *     Add a function to the first spare schedule slot. If the scheduler is
+ *     running, the first call is one interval plus the phase offset from now.
+ * Parameters:
+ *     configItem - The settings of the function to be added
+ *     taskIndex - Set to the index of the slot used
+ * Returns:
+ *     bool - true if the function was added, false if the settings are not
+ *     valid or there are no spare slots
+ */
+bool Scheduler_AddTask(const Scheduler_ConfigItem_t *const configItem, uint16_t *const taskIndex);
+
+/** Description:
+ *     Remove a function or coroutine from the schedule and make its slot
+ *     spare.
+ * Parameters:
+ *     taskIndex - Index of the schedule slot
+ * Returns:
+ *     bool - true if the slot was in use
+ */
+bool Scheduler_RemoveTask(const uint16_t taskIndex);
+
+/** Description:
+ *    This is the command handler used for querying the execution profile
+ *    (run count, execution time, start jitter and overruns) of a scheduled
+ *    item. Times are reported in CPU cycles.
+ * Parameters:
+ *    message :  A pointer to a common Message Router message
+ *               object. The response is expected to be placed in
+ *               this object.
+ */
+void Scheduler_MessageRouter_GetTaskProfile(MessageRouter_Message_t *const message);
+
+/** Description:
+ *    This is the command handler used for querying the start latency
+ *    histogram of a scheduled item.
+ * Parameters:
+ *    message :  A pointer to a common Message Router message
+ *               object. The response is expected to be placed in
+ *               this object.
+ */
+void Scheduler_MessageRouter_GetLatencyHistogram(MessageRouter_Message_t *const message);
+
+/** Description:
+ *    This is the command handler used for clearing the execution profiles
+ *    of all scheduled items.
+ * Parameters:
+ *    message :  A pointer to a common Message Router message
+ *               object. The response is expected to be placed in
+ *               this object.
+ */
+void Scheduler_MessageRouter_ResetProfile(MessageRouter_Message_t *const message);
+
+/** Description:
+ *    This is the command handler used for querying the dispatch statistics
+ *    (dispatch count, longest dispatch and budget overruns) of the fast tier.
+ * Parameters:
+ *    message :  A pointer to a common Message Router message
+ *               object. The response is expected to be placed in
+ *               this object.
+ */
+void Scheduler_MessageRouter_GetFastTierStatus(MessageRouter_Message_t *const message);
+
+/** Description:
+ *    This is the command handler used for querying the execution profile
+ *    of a single fast tier function.
+ * Parameters:
+ *    message :  A pointer to a common Message Router message
+ *               object. The response is expected to be placed in
+ *               this object.
+ */
+void Scheduler_MessageRouter_GetFastTaskProfile(MessageRouter_Message_t *const message);
+
+/** Description:
+ *    These are the command handlers used for changing the schedule at
+ *    runtime. They call Scheduler_SuspendTask(), Scheduler_ResumeTask(),
+ *    Scheduler_SetTaskInterval() and Scheduler_RemoveTask() respectively.
+ *    AddTask adds one of the board's optional functions to a spare slot and
+ *    GetTaskInfo returns the current settings of a slot.
+ * Parameters:
+ *    message :  A pointer to a common Message Router message
+ *               object. The response is expected to be placed in
+ *               this object.
+ */
+void Scheduler_MessageRouter_SuspendTask(MessageRouter_Message_t *const message);
+void Scheduler_MessageRouter_ResumeTask(MessageRouter_Message_t *const message);
+void Scheduler_MessageRouter_SetTaskInterval(MessageRouter_Message_t *const message);
+void Scheduler_MessageRouter_GetTaskInfo(MessageRouter_Message_t *const message);
+void Scheduler_MessageRouter_AddTask(MessageRouter_Message_t *const message);
+void Scheduler_MessageRouter_RemoveTask(MessageRouter_Message_t *const message);
+
+/** Description:
+ *    This is the command handler used for querying the CPU load of the
+ *    background loop (last, mean and peak over the load history) and the
+ *    number of frame overruns and shed calls.
+ * Parameters:
+ *    message :  A pointer to a common Message Router message
+ *               object. The response is expected to be placed in
+ *               this object.
+ */
+void Scheduler_MessageRouter_GetLoad(MessageRouter_Message_t *const message);
+
+/** Description:
+ *    Interrupt handler that dispatches the fast tier. This is registered for
+ *    the configured interrupt when Scheduler_Execute() is called.
+ */
+__interrupt void Scheduler_FastTierHandler(void);
+
 
 /*******************************************************************************
 // End of C Binding Section
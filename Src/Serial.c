@@ -8,13 +8,15 @@
 
 // Module Includes
 #include "Serial.h"
+#include "Serial_Config.h" // Defines the command budget of each update
 // Platform Includes
 #include "CRCLib.h"
+#include "HexLib.h"
 #include "MessageRouter.h"
+#include "Timebase.h"
 // Other Includes
 #include "UART_Drv.h"        // For UART API
 #include "UART_Drv_Config.h" // For UART channel enumeration
-#include <limits.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
@@ -27,12 +29,6 @@
 // This is just used for debugging serial port
 //#define DEBUG_SEND_CONSTANT_DATA
 
-// Size of the local circular buffer used for transmitting data (Max 255 in Send function)
-#define TX_BUFFER_SIZE (128)
-
-// Size of the local circular buffer used for receiving data.
-#define RX_BUFFER_SIZE (128)
-
 // Address used to identifying messages intended for any device
 #define BROADCAST_ADDRESS (0xFFU)
 
@@ -63,13 +59,7 @@
 #define COMMAND_HEADER_SIZE (NUM_ADDRESS_BYTES + sizeof(MessageRouter_MessageItemHeader_t) + DATA_LENGTH_SIZE)
 
 // 2 ASCII characters per byte ("FF")
-#define HEX_CHARS_PER_BYTE (2)
-
-#if (16 == CHAR_BIT)
-#define HEX_MULTIPLE (2)
-#else
-#define HEX_MULTIPLE (1)
-#endif
+#define HEX_CHARS_PER_BYTE (HEXLIB_CHARS_PER_BYTE)
 
 /** This defines the length of a command header in ASCII-coded
  * hex.
@@ -151,21 +141,104 @@
 // This is the stop byte used for all outgoing responses.
 #define RESPONSE_STOP_BYTE ('\r')
 
+// The number of start and stop bytes around an ASCII-coded hex response
+#define RESPONSE_FRAMING_SIZE_HASCII (2)
+
+// The number of bytes converted to ASCII-hex for each write to the UART driver
+#define SEND_CHUNK_SIZE (16U)
+
+//-----------------------------------------------
+// Binary Packet
+//-----------------------------------------------
+
+// Binary commands and responses carry the same fields as ASCII-hex ones, one
+// byte each, followed by the CRC16 (high byte first). The packet is COBS
+// encoded so it holds no zero bytes, and each frame starts and ends with a
+// zero. Back-to-back frames may share a delimiter.
+#define BINARY_FRAME_DELIMITER (0x00U)
+
+// COBS adds one code byte for each 254 data bytes, so one is enough here
+#define COBS_OVERHEAD_SIZE (1)
+
+// The largest COBS code byte, which is not followed by an implied zero
+#define COBS_MAX_CODE (0xFFU)
+
+// This defines the maximum binary response size in bytes before COBS encoding
+#define RESPONSE_MAX_SIZE_BINARY (RESPONSE_MAX_SIZE + NUM_CRC_BYTES)
+
+// This defines the maximum binary response frame in bytes, with both delimiters
+#define RESPONSE_MAX_SIZE_COBS (RESPONSE_MAX_SIZE_BINARY + COBS_OVERHEAD_SIZE + 2)
+
+//-----------------------------------------------
+// Command Parser
+//-----------------------------------------------
+
+// The first field of every command
+#if (NUM_ADDRESS_BYTES > 0)
+#define PARSE_STATE_FIRST (PARSE_STATE_ADDRESS)
+#else
+#define PARSE_STATE_FIRST (PARSE_STATE_MODULE_ID)
+#endif
+
 /*******************************************************************************
 // Private Type Declarations
 *******************************************************************************/
 
-// Structure to hold the ASCII hex data when retrieving a valid command from the
-// RX circular buffer
+// The fields of a command, in the order they are received. The same fields
+// are carried by both encodings.
+typedef enum
+{
+   // The destination address, if addressing is enabled
+   PARSE_STATE_ADDRESS,
+   PARSE_STATE_MODULE_ID,
+   PARSE_STATE_COMMAND_ID,
+   PARSE_STATE_MESSAGE_ID,
+   PARSE_STATE_DATA_LENGTH,
+   // The number of bytes given by the data length
+   PARSE_STATE_DATA,
+   // The CRC16, high byte first
+   PARSE_STATE_CRC_HIGH,
+   PARSE_STATE_CRC_LOW,
+   // Every field has been received
+   PARSE_STATE_DONE,
+   // More bytes were received than the data length allows
+   PARSE_STATE_OVERRUN
+} ParseState_t;
+
+// Holds the progress of the command being received on a port. Each byte is
+// decoded as it is read from the RX circular buffer, straight into the message
+// of the port, so the ASCII hex or COBS form of the command is never stored.
 typedef struct
 {
    // Denotes if the start byte has been found while searching for a complete message
    bool isStartByteFound;
-   // Size of the data buffer
-   uint16_t dataBufferLen;
-   // Buffer used for storing the complete ASCII command during processing
-   char data[COMMAND_MAX_SIZE_HASCII];
-} ASCIICommandItem_t;
+   // The framing of the command, set by the start byte that was found
+   Serial_Encoding_t encoding;
+   // Set once the command is complete. It waits here until there is room in
+   // the TX buffer for its response.
+   bool isComplete;
+   // Set once a character or COBS byte has followed the start byte
+   bool hasFrameData;
+   // Set if a character that is not a hex digit, or an incomplete COBS
+   // block, was received
+   bool isMalformed;
+   // ASCII: set if highNibble holds the first character of a byte
+   bool isNibblePending;
+   uint16_t highNibble;
+   // Binary: the code of the current COBS block, and the bytes left in it
+   uint16_t cobsCode;
+   uint16_t cobsRemaining;
+   // The field the next byte belongs to
+   ParseState_t parseState;
+   // The number of data bytes received
+   uint16_t dataIndex;
+   // The destination address of the command
+   uint16_t destinationAddress;
+   // The CRC received with the command
+   uint16_t messageCRC;
+   // The CRC of every byte received before the CRC field
+   CRCLib_Context_t crcContext;
+} CommandItem_t;
 
 // Holds statistics on TX/RX data and messages
 // Note this structure needs to be packed properly since it is reused in the GetSerialStatistics method
@@ -190,6 +263,9 @@ typedef struct
 // Structure to hold buffers and data for each port
 typedef struct
 {
+   // The configuration of this port, NULL if the port is not served
+   const Serial_PortConfig_t *portConfig;
+
    // This is the message structure for the message that must be
    // populated and sent to the message router for routing to the
    // destination software module.
@@ -205,9 +281,15 @@ typedef struct
 
    // This is the information for assembling the next command as we
    // dequeue bytes from the UART driver
-   // The data in this buffer is ASCII data that must be converted to binary
-   // before sending on to the command processor.
-   ASCIICommandItem_t asciiCommand;
+   // The data in this buffer is ASCII or COBS data that must be converted to
+   // binary before sending on to the command processor.
+   CommandItem_t command;
+
+   // The encoding negotiated for this port by the framing of the last valid
+   // command, so ASCII and binary tools can both connect without any
+   // configuration. Responses always use the framing of their command, and
+   // this selects the encoding of data sent without one.
+   Serial_Encoding_t encoding;
 
    /** The address for this device on this port For simplicity in
     * the driver, this initializes to BROADCAST_ADDRESS if
@@ -233,6 +315,10 @@ typedef struct
 
    // Create a status object for each port used
    PortData_t portData[UART_DRV_CHANNEL_COUNT];
+
+   // The port served first by the next update. It moves on each update so a
+   // busy port cannot use the whole budget every time.
+   uint16_t firstChannel;
 } Serial_Status_t;
 
 /*******************************************************************************
@@ -247,24 +333,122 @@ static Serial_Status_t status;
 *******************************************************************************/
 
 /** Description:
- *    This function searches the circular buffer for the given channel to find
- *    a complete command to be processed. (All data between Start and Stop
- *    characters.) Note that it may take mutiple calls to this function to
- *    locate a complete message.
+ *    This function reads the circular buffer for the given channel until a
+ *    command is complete. (All data between Start and Stop characters.) Each
+ *    byte is decoded and parsed as it is read, so it may take mutiple calls
+ *    to this function to receive a complete message, and no byte is read
+ *    twice.
  * Parameters:
  *    channel : The enumerated channel value for which this function will search for a command.
- *    asciiCommand : The located command in ASCII format
+ *    command : The progress of the command being received
  * Returns:
  *    bool: The result of the command search
  * Return Value List:
- *    true: Command found and placed into the ASCII command buffer for
- *    processing
+ *    true: Command complete, with its fields in the message of the port
  *    false: No command found
  * History:
  *    * Date: Function created (EJH)    
  *
  */
-static bool FindNextCommand(const UART_Drv_Channel_t channel, ASCIICommandItem_t *const asciiCommand);
+static bool FindNextCommand(const UART_Drv_Channel_t channel, CommandItem_t *const command);
+
+/** Description:
+ *    This function processes the next complete command of the given channel,
+ *    if there is one and there is room in the TX buffer for its response.
+ * Parameters:
+ *    channel : The enumerated channel value to be served.
+ * Returns:
+ *    bool: true if a command was processed
+ */
+static bool ProcessNextCommand(const UART_Drv_Channel_t channel);
+
+/** Description:
+ *    This function returns the number of bytes queued for transmit by a
+ *    response, including its framing.
+ * Parameters:
+ *    encoding : The encoding of the response
+ *    responseLength : The number of bytes of response data
+ */
+static uint16_t GetResponseFrameSize(const Serial_Encoding_t encoding, const uint16_t responseLength);
+
+/** Description:
+ *    This function returns the TX buffer space kept free for the response of
+ *    the next command of a port: the largest response in the largest
+ *    encoding the port accepts. Messages sent without a command leave this
+ *    much free, so they cannot hold back a command.
+ * Parameters:
+ *    channel : The enumerated channel value of the port
+ */
+static uint16_t GetResponseReserve(const UART_Drv_Channel_t channel);
+
+/** Description:
+ *    This function starts receiving a command after its start byte or frame
+ *    delimiter, dropping any partial command.
+ * Parameters:
+ *    channel : The enumerated channel value on which the command is received.
+ *    command : The progress of the command being received
+ *    encoding : The framing of the command
+ */
+static void StartCommand(const UART_Drv_Channel_t channel, CommandItem_t *const command,
+                         const Serial_Encoding_t encoding);
+
+/** Description:
+ *    This function decodes one character of an ASCII-coded hex command. Each
+ *    second character completes a byte, which is parsed.
+ * Parameters:
+ *    channel : The enumerated channel value on which the command is received.
+ *    command : The progress of the command being received
+ *    character : The character that was received
+ */
+static void ReceiveAsciiChar(const UART_Drv_Channel_t channel, CommandItem_t *const command,
+                             const uint16_t character);
+
+/** Description:
+ *    This function decodes one byte of a COBS frame, other than a delimiter.
+ *    Each code byte after the first stands for a zero, unless the block
+ *    before it was full.
+ * Parameters:
+ *    channel : The enumerated channel value on which the command is received.
+ *    command : The progress of the command being received
+ *    encodedByte : The byte that was received
+ */
+static void ReceiveCobsByte(const UART_Drv_Channel_t channel, CommandItem_t *const command,
+                            const uint16_t encodedByte);
+
+/** Description:
+ *    This function parses one decoded byte of a command into the message for
+ *    the given channel and adds it to the CRC. The data length is checked as
+ *    soon as it arrives. Data beyond the command buffer is not kept, but is
+ *    still received so the command ends where the host expects.
+ * Parameters:
+ *    channel : The enumerated channel value on which the command is received.
+ *    command : The progress of the command being received
+ *    commandByte : The decoded byte
+ */
+static void ReceiveCommandByte(const UART_Drv_Channel_t channel, CommandItem_t *const command,
+                               const uint16_t commandByte);
+
+/** Description:
+ *    This function checks a complete ASCII-coded hex command, sends it to the
+ *    Message Router and sends the response. A command that is malformed,
+ *    the wrong length or fails the CRC is answered with its header and no
+ *    data.
+ * Parameters:
+ *    channel : The enumerated channel value on which the command was received.
+ *    asciiCommand : The command that was received
+ */
+static void ProcessAsciiCommand(const UART_Drv_Channel_t channel, CommandItem_t *const asciiCommand);
+
+/** Description:
+ *    This function checks a complete COBS framed binary command, sends it to
+ *    the Message Router and sends the response. Frames that are malformed,
+ *    the wrong length or fail the CRC are dropped without a response, since
+ *    none of their header can be trusted.
+ * Parameters:
+ *    channel : The enumerated channel value on which the command was received.
+ *    binaryCommand : The command that was received
+ */
+static void ProcessBinaryCommand(const UART_Drv_Channel_t channel, CommandItem_t *const binaryCommand);
 
 /** Description:
  *    This function packetizes the given message response as ASCII-coded hex data and add the
@@ -280,97 +464,372 @@ static void SendResponseAsciiHex(const UART_Drv_Channel_t channel,
                                  MessageRouter_Message_t *const message);
 
 /** Description:
- *    This function takes a character '0' - 'F' and converts it to its hex equivalent
- *    ('F' becomes 0x0F)
+ *    This function packetizes the given message response as a COBS framed
+ *    binary packet and adds it to the outgoing transmit buffer.
  * Parameters:
- *    charToConvert: The character to be to be converted.
- * Returns:
- *    uint16_t: The Hex representation of the given character.
- * History:
- *    * Date: Function created (EJH)    
- *
+ *    channel : The enumerated channel value used for sending this message.
+ *    message : A pointer to the Message Router object defining the message to be sent.
  */
-static uint16_t ConvertAsciiHexCharToNumeric(const uint16_t charToConvert);
+static void SendResponseBinary(const UART_Drv_Channel_t channel,
+                               MessageRouter_Message_t *const message);
 
 /** Description:
- *    This function converts a 16-bit value to an ASCII-coded hex string
- *    and stores it in the given buffer. NOTE: The given buffer must be as long
- *    as the specified length
+ *    This function COBS encodes the given bytes so the result holds no zeros.
+ *    The delimiters are not added.
  * Parameters:
- *    destinationBuffer: The pointer to the buffer where the conversion is to be stored
- *    desiredLength: The number of nibbles to be converted (Max 4)
- *    valueToConvert: The value that is to be converted
- * History:
- *    * Date: Function created (EJH)    
- *
+ *    data : The bytes to be encoded, one per word
+ *    dataLength : The number of bytes to be encoded (Max 254)
+ *    encodedData : The buffer for the result, one byte per word. It must hold
+ *       dataLength + COBS_OVERHEAD_SIZE bytes.
+ * Returns:
+ *    uint16_t: The number of encoded bytes
  */
-static void ConvertNumericToAsciiHexString(uint16_t *const destinationBuffer, const uint16_t desiredLength,
-                                           const uint16_t valueToConvert);
+static uint16_t EncodeCobs(const uint16_t *const data, const uint16_t dataLength, uint16_t *const encodedData);
 
 /*******************************************************************************
 // Private Function Implementations
 *******************************************************************************/
 
 // Search circular buffer for the next command
-static bool FindNextCommand(const UART_Drv_Channel_t channel, ASCIICommandItem_t *const asciiCommand)
+static bool FindNextCommand(const UART_Drv_Channel_t channel, CommandItem_t *const command)
 {
    // Start with no command found
    bool wasCommandFound = false;
 
    // Verify the channel is valid
-   if ((asciiCommand != 0) && (channel < UART_DRV_CHANNEL_COUNT))
+   if ((command != 0) && (channel < UART_DRV_CHANNEL_COUNT))
    {
       // Init to null char
       uint16_t tmpByte = 0U;
+      // A port with a fixed encoding ignores the framing of the other one
+      const Serial_PortConfig_t *const portConfig = status.portData[channel].portConfig;
+      const bool isBinaryAccepted = portConfig->isEncodingNegotiated || (portConfig->encoding == SERIAL_ENCODING_BINARY);
+      const bool isAsciiAccepted = portConfig->isEncodingNegotiated ||
+                                   (portConfig->encoding == SERIAL_ENCODING_ASCII_CODED_HEX);
 
       // Get all bytes from the circular RX buffer
       // Note this reads from the buffer not the port so it does not block.
-      //while ((!wasCommandFound) && (UART_Drv_ReadCharArray(channel, &tmpByte, 1)))
-      while ((!wasCommandFound) && (tmpByte = UART_Drv_ReadChar(channel)))
+      // The count is checked rather than the byte, since binary frames are
+      // delimited by zeros. Reading stops at the end of a command, so the
+      // next one stays in the buffer until this one has been processed.
+      while ((!wasCommandFound) && (UART_Drv_ReadCharArray(channel, &tmpByte, 1) > 0U))
       {
          // Increase the number of bytes received for this channel
          status.portData[channel].statistics.numBytesReceived += sizeof(tmpByte);
 
+         // Inside a binary frame, everything up to the next delimiter is data
+         if ((command->isStartByteFound) && (command->encoding == SERIAL_ENCODING_BINARY) &&
+             ((command->hasFrameData) || (tmpByte != COMMAND_START_BYTE) || !isAsciiAccepted))
+         {
+            if (tmpByte == BINARY_FRAME_DELIMITER)
+            {
+               // Repeated delimiters are only idle fill, not empty frames
+               if (command->hasFrameData)
+               {
+                  // The last COBS block must be complete
+                  if (command->cobsRemaining != 0U)
+                  {
+                     command->isMalformed = true;
+                  }
+
+                  // Complete command found. The delimiter also opens the next frame,
+                  // which will start once this command has been processed.
+                  wasCommandFound = true;
+               }
+            }
+            else
+            {
+               // Frames too long to be a command are received to the
+               // delimiter without being kept, then dropped
+               ReceiveCobsByte(channel, command, tmpByte);
+            }
+         }
+         // See if the current byte is a binary frame delimiter.
+         else if ((tmpByte == BINARY_FRAME_DELIMITER) && isBinaryAccepted)
+         {
+            // A partial ASCII command is dropped, as it is for a new start byte
+            StartCommand(channel, command, SERIAL_ENCODING_BINARY);
+         }
          // See if the current byte is a command "Start" byte.
-         if (tmpByte == COMMAND_START_BYTE)
+         else if ((tmpByte == COMMAND_START_BYTE) && isAsciiAccepted)
          {
-            // Store the flag so if the buffer only contains the first half of the
-            // message, we will continue next time.
-            asciiCommand->isStartByteFound = true;
-            // Always reset the size when a start byte is found.  If
+            // Always restart when a start byte is found.  If
             // the start byte of the next message is received before
             // the stop byte of the previous message, then the previous
             // message will be ignored.
-            asciiCommand->dataBufferLen = 0;
+            StartCommand(channel, command, SERIAL_ENCODING_ASCII_CODED_HEX);
          }
-         else if ((tmpByte == COMMAND_STOP_BYTE_1) || (tmpByte == COMMAND_STOP_BYTE_2))
+         else if (((tmpByte == COMMAND_STOP_BYTE_1) || (tmpByte == COMMAND_STOP_BYTE_2)) && isAsciiAccepted)
          {
+            // A stop byte outside a command, such as the second of "\r\n", is ignored
+            if (command->isStartByteFound)
+            {
+               // A byte with only one of its characters is malformed
+               if (command->isNibblePending)
+               {
+                  command->isMalformed = true;
+               }
+
+               // Mark that we have found a command (which will exit the loop)
+               wasCommandFound = true;
+            }
+
             // Complete command found: clear start byte flag
-            asciiCommand->isStartByteFound = false;
-            // Mark that we have found a command (which will exit the loop)
-            wasCommandFound = true;
+            command->isStartByteFound = false;
          }
-         else if (asciiCommand->isStartByteFound)
+         else if (command->isStartByteFound)
          {
-            // If we have room for the next byte of the command...
-            if (asciiCommand->dataBufferLen < (uint16_t)COMMAND_MAX_SIZE_HASCII)
+            // Commands too long for the buffer are received to the stop byte
+            // without being kept, so they are still answered
+            ReceiveAsciiChar(channel, command, tmpByte);
+         }
+         // else, byte is not part of a valid message.  Throw it away
+      }
+   }
+
+   return(wasCommandFound);
+}
+
+
+// Start receiving a command
+static void StartCommand(const UART_Drv_Channel_t channel, CommandItem_t *const command,
+                         const Serial_Encoding_t encoding)
+{
+   // Store the message object for easy access
+   MessageRouter_Message_t *const message = &(status.portData[channel].currentMessage);
+
+   command->isStartByteFound = true;
+   command->encoding = encoding;
+   command->hasFrameData = false;
+   command->isMalformed = false;
+   command->isNibblePending = false;
+   command->highNibble = 0U;
+   command->cobsCode = 0U;
+   command->cobsRemaining = 0U;
+   command->parseState = PARSE_STATE_FIRST;
+   command->dataIndex = 0U;
+   command->messageCRC = 0U;
+   CRCLib_Begin(&command->crcContext, CRC_SEED);
+
+   // If addressing is not used, the command is for any device
+   command->destinationAddress = (uint16_t)BROADCAST_ADDRESS;
+
+   // The command is decoded straight into the command buffer
+   message->commandParams.data = status.portData[channel].commandBuffer;
+   // Set the max size to prevent other modules from overwriting the bounds of the data buffer.
+   message->commandParams.maxLength = (uint16_t)COMMAND_DATA_MAX_SIZE;
+   message->commandParams.length = 0U;
+}
+
+
+// Decode a character of an ASCII-coded hex command
+static void ReceiveAsciiChar(const UART_Drv_Channel_t channel, CommandItem_t *const command,
+                             const uint16_t character)
+{
+   uint16_t nibble = 0U;
+
+   command->hasFrameData = true;
+
+   if (!HexLib_DecodeValue(&nibble, &character, 1U))
+   {
+      // The command is still received to the stop byte, then answered without data
+      command->isMalformed = true;
+   }
+   else if (!command->isNibblePending)
+   {
+      // High nibble first
+      command->highNibble = nibble;
+      command->isNibblePending = true;
+   }
+   else
+   {
+      command->isNibblePending = false;
+      ReceiveCommandByte(channel, command, (uint16_t)(command->highNibble << 4U) | nibble);
+   }
+}
+
+
+// Decode a byte of a COBS frame
+static void ReceiveCobsByte(const UART_Drv_Channel_t channel, CommandItem_t *const command,
+                            const uint16_t encodedByte)
+{
+   command->hasFrameData = true;
+
+   if (command->cobsRemaining == 0U)
+   {
+      // A code byte holds the distance to the next zero, which was dropped.
+      // Only the first block, and those after a full block, had no zero before them.
+      if ((command->cobsCode != 0U) && (command->cobsCode != COBS_MAX_CODE))
+      {
+         ReceiveCommandByte(channel, command, 0U);
+      }
+
+      command->cobsCode = encodedByte & 0xFFU;
+      command->cobsRemaining = command->cobsCode - 1U;
+   }
+   else
+   {
+      ReceiveCommandByte(channel, command, encodedByte & 0xFFU);
+      command->cobsRemaining--;
+   }
+}
+
+
+// Parse a decoded byte of a command
+static void ReceiveCommandByte(const UART_Drv_Channel_t channel, CommandItem_t *const command,
+                               const uint16_t commandByte)
+{
+   // Store the message object for easy access
+   MessageRouter_Message_t *const message = &(status.portData[channel].currentMessage);
+
+   // The CRC covers every byte before it, as received
+   if (command->parseState < PARSE_STATE_CRC_HIGH)
+   {
+      CRCLib_UpdateByte(&command->crcContext, commandByte);
+   }
+
+   switch (command->parseState)
+   {
+      case PARSE_STATE_ADDRESS:
+         command->destinationAddress = commandByte;
+         command->parseState = PARSE_STATE_MODULE_ID;
+         break;
+      case PARSE_STATE_MODULE_ID:
+         message->header.moduleID = commandByte;
+         command->parseState = PARSE_STATE_COMMAND_ID;
+         break;
+      case PARSE_STATE_COMMAND_ID:
+         message->header.commandID = commandByte;
+         command->parseState = PARSE_STATE_MESSAGE_ID;
+         break;
+      case PARSE_STATE_MESSAGE_ID:
+         message->header.messageID = commandByte;
+         command->parseState = PARSE_STATE_DATA_LENGTH;
+         break;
+      case PARSE_STATE_DATA_LENGTH:
+         // A length beyond the command buffer is rejected once the command is
+         // complete, and its data is not kept
+         message->commandParams.length = commandByte;
+         command->parseState = (commandByte > 0U) ? PARSE_STATE_DATA : PARSE_STATE_CRC_HIGH;
+         break;
+      case PARSE_STATE_DATA:
+         if (command->dataIndex < (uint16_t)COMMAND_DATA_MAX_SIZE)
+         {
+            // Pack the data two bytes per word, low byte first, the same as HexLib_Decode()
+            if ((command->dataIndex & 1U) == 0U)
             {
-               // Add byte to command buffer and increment size
-               asciiCommand->data[asciiCommand->dataBufferLen++] = tmpByte;
+               status.portData[channel].commandBuffer[command->dataIndex / 2U] = commandByte;
             }
-            // Otherwise, clear the command buffer and send an error...
             else
             {
-               // Reset command buffer
-               asciiCommand->isStartByteFound = false;
-               asciiCommand->dataBufferLen = 0;
+               status.portData[channel].commandBuffer[command->dataIndex / 2U] |= (uint16_t)(commandByte << 8U);
             }
          }
-         // else, byte is not part of a valid message.  Throw it away
+
+         command->dataIndex++;
+         if (command->dataIndex == message->commandParams.length)
+         {
+            command->parseState = PARSE_STATE_CRC_HIGH;
+         }
+         break;
+      case PARSE_STATE_CRC_HIGH:
+         command->messageCRC = (uint16_t)(commandByte << 8U);
+         command->parseState = PARSE_STATE_CRC_LOW;
+         break;
+      case PARSE_STATE_CRC_LOW:
+         command->messageCRC |= commandByte;
+         command->parseState = PARSE_STATE_DONE;
+         break;
+      case PARSE_STATE_DONE:
+      case PARSE_STATE_OVERRUN:
+      default:
+         // The rest of the command is ignored. It cannot be processed.
+         command->parseState = PARSE_STATE_OVERRUN;
+         break;
+   }
+}
+
+
+// Process the next waiting command of a port
+static bool ProcessNextCommand(const UART_Drv_Channel_t channel)
+{
+   // Store the command object for easy access
+   CommandItem_t *const command = &(status.portData[channel].command);
+   bool wasProcessed = false;
+
+   // Look for a valid command in the circular RX buffer of a served port,
+   // unless one is already waiting
+   if ((status.portData[channel].portConfig != 0) && (!command->isComplete))
+   {
+      command->isComplete = FindNextCommand(channel, command);
+   }
+
+   // Leave the command in place rather than overflow the TX buffer, and ask
+   // to be woken once there is room. The port is not read meanwhile, so
+   // further commands wait in the RX buffer. There is no flow control, so
+   // bytes that do not fit are dropped, and a host must not send more
+   // commands ahead of their responses than the RX buffer holds.
+   if ((command->isComplete) &&
+       (UART_Drv_GetTxBufferSpace(channel) < GetResponseFrameSize(command->encoding, (uint16_t)RESPONSE_DATA_MAX_SIZE)))
+   {
+      UART_Drv_RequestTxSpace(channel, GetResponseFrameSize(command->encoding, (uint16_t)RESPONSE_DATA_MAX_SIZE));
+   }
+   else if (command->isComplete)
+   {
+      // A complete command was received and already parsed into the standard
+      // message structure, now it needs to be checked and processed.
+      if (command->encoding == SERIAL_ENCODING_BINARY)
+      {
+         ProcessBinaryCommand(channel, command);
+      }
+      else
+      {
+         ProcessAsciiCommand(channel, command);
+      }
+
+      // Command has been processed, remove it.
+      command->isComplete = false;
+
+      // The delimiter that ended a binary command also opened the next one
+      if (command->isStartByteFound)
+      {
+         StartCommand(channel, command, command->encoding);
       }
+      wasProcessed = true;
    }
 
-   return(wasCommandFound);
+   return(wasProcessed);
+}
+
+
+// Get the number of bytes queued by a response
+static uint16_t GetResponseFrameSize(const Serial_Encoding_t encoding, const uint16_t responseLength)
+{
+   const uint16_t packetSize = (uint16_t)RESPONSE_HEADER_SIZE + responseLength + (uint16_t)NUM_CRC_BYTES;
+
+   // Binary responses add the COBS code byte and both delimiters
+   return((encoding == SERIAL_ENCODING_BINARY) ? (packetSize + (uint16_t)COBS_OVERHEAD_SIZE + 2U) :
+                                                  ((HEX_CHARS_PER_BYTE * packetSize) + (uint16_t)RESPONSE_FRAMING_SIZE_HASCII));
+}
+
+
+// Get the TX space kept free for the response of the next command
+static uint16_t GetResponseReserve(const UART_Drv_Channel_t channel)
+{
+   const Serial_PortConfig_t *const portConfig = status.portData[channel].portConfig;
+   uint16_t reserve = 0U;
+
+   // Only a served port receives commands
+   if (portConfig != 0)
+   {
+      // ASCII-hex is the larger, so it is reserved if the port accepts it
+      const Serial_Encoding_t encoding = ((portConfig->encoding == SERIAL_ENCODING_BINARY) && !portConfig->isEncodingNegotiated) ?
+                                            SERIAL_ENCODING_BINARY : SERIAL_ENCODING_ASCII_CODED_HEX;
+
+      reserve = GetResponseFrameSize(encoding, (uint16_t)RESPONSE_DATA_MAX_SIZE);
+   }
+
+   return(reserve);
 }
 
 
@@ -389,7 +848,8 @@ static void SendResponseAsciiHex(const UART_Drv_Channel_t channel,
          if (message->responseParams.data != 0)
          {
             // Start with the CRC seed value
-            uint16_t calculatedCRC = CRC_SEED;
+            CRCLib_Context_t crcContext;
+            CRCLib_Begin(&crcContext, CRC_SEED);
 
             // Response data appears to be valid, so send the HASCII response.
             // Start Byte
@@ -400,7 +860,7 @@ static void SendResponseAsciiHex(const UART_Drv_Channel_t channel,
 #if (NUM_ADDRESS_BYTES > 0)
             // Send address - 0 is the master
             Serial_Send(channel, 0, 1, SERIAL_ENCODING_ASCII_CODED_HEX);
-            calculatedCRC = CRCLib_Calculate(calculatedCRC, 0, 1);
+            CRCLib_UpdateByte(&crcContext, 0U);
 #endif
             // ModID
             Serial_Send(channel, &message->header.moduleID, 1, SERIAL_ENCODING_ASCII_CODED_HEX);
@@ -415,18 +875,23 @@ static void SendResponseAsciiHex(const UART_Drv_Channel_t channel,
 
 
 #if (NUM_CRC_BYTES > 0)
-				// Calculate the CRC
-            calculatedCRC = CRCLib_Calculate(calculatedCRC, &message->header.moduleID, 1);
-            calculatedCRC = CRCLib_Calculate(calculatedCRC, &message->header.commandID, 1);
-            calculatedCRC = CRCLib_Calculate(calculatedCRC, &message->header.messageID, 1);
-            calculatedCRC = CRCLib_Calculate(calculatedCRC, &message->responseParams.length, 1);
-            calculatedCRC = CRCLib_Calculate(calculatedCRC, message->responseParams.data, message->responseParams.length);
-            // Send the CRC
-            //Serial_Send(channel, (uint16_t *)&calculatedCRC, sizeof(calculatedCRC)*2, SERIAL_ENCODING_ASCII_CODED_HEX);
-            Serial_Send(channel, (uint16_t *)&calculatedCRC, HEX_MULTIPLE * sizeof(calculatedCRC), SERIAL_ENCODING_ASCII_CODED_HEX);
-            //Serial_Send(channel, (uint16_t *)&calculatedCRC, 1, SERIAL_ENCODING_ASCII_CODED_HEX);
-            //Serial_Send(channel, (uint16_t *)&calculatedCRC, 1, SERIAL_ENCODING_ASCII_CODED_HEX);
-#endif 
+            // Calculate the CRC over every byte before it, as sent, the same
+            // as a binary response and as checked on commands
+            CRCLib_UpdateByte(&crcContext, message->header.moduleID & 0xFFU);
+            CRCLib_UpdateByte(&crcContext, message->header.commandID & 0xFFU);
+            CRCLib_UpdateByte(&crcContext, message->header.messageID & 0xFFU);
+            CRCLib_UpdateByte(&crcContext, message->responseParams.length & 0xFFU);
+            for (uint16_t i = 0U; i < message->responseParams.length; i++)
+            {
+               CRCLib_UpdateByte(&crcContext, 0x00FFU & (__byte((unsigned int*)message->responseParams.data, i)));
+            }
+            const uint16_t calculatedCRC = CRCLib_Finish(&crcContext);
+
+            // Send the CRC, high byte first. Data is sent low byte first, so
+            // the bytes are swapped.
+            uint16_t crcBytes = (uint16_t)((calculatedCRC >> 8U) & 0xFFU) | (uint16_t)((calculatedCRC & 0xFFU) << 8U);
+            Serial_Send(channel, &crcBytes, NUM_CRC_BYTES, SERIAL_ENCODING_ASCII_CODED_HEX);
+#endif
 
             // Stop Byte
             //temp = (uint16_t)RESPONSE_STOP_BYTE;
@@ -441,135 +906,239 @@ static void SendResponseAsciiHex(const UART_Drv_Channel_t channel,
 }
 
 
-// Convert a series of ASCII-coded hex values to a single 16-bit numeric value
-uint16_t Serial_ConvertAsciiHexStringToNumeric(uint16_t *const hexCharacters, const uint16_t numHexCharacters)
+// Send message response as a COBS framed binary packet
+static void SendResponseBinary(const UART_Drv_Channel_t channel,
+                               MessageRouter_Message_t *const message)
 {
-   // Default to 0 result
-   uint16_t resultValue = 0U;
-   uint16_t tmpByte = '0';
-   const uint16_t *nextByte;
-
-   // Check for NULL pointer.  If it is NULL return 0 for the hex value.
-   if (hexCharacters != 0)
+   // Make sure the given channel is valid
+   if (channel < UART_DRV_CHANNEL_COUNT)
    {
-      // Point to the beginning of the data
-      nextByte = hexCharacters;
+      // Check for NULL pointer and make sure the response data buffer is valid.
+      if ((message != 0) && (message->responseParams.data != 0) &&
+          (message->responseParams.length <= (uint16_t)RESPONSE_DATA_MAX_SIZE))
+      {
+         // The packet before encoding, one byte per word
+         uint16_t packet[RESPONSE_MAX_SIZE_BINARY];
+         // The frame that is sent, one byte per word
+         uint16_t frame[RESPONSE_MAX_SIZE_COBS];
+         uint16_t packetLength = 0U;
+         CRCLib_Context_t crcContext;
 
-      // Since this returns a uint16_t, we can only convert a maximum
-      // of 4 characters.  If a length > 4 is specified, only do the
-      // first 4 characters.
-      uint16_t tmpNumHexCharacters = numHexCharacters;
+#if (NUM_ADDRESS_BYTES > 0)
+         // Address - 0 is the master
+         packet[packetLength++] = 0U;
+#endif
+         packet[packetLength++] = message->header.moduleID & 0xFFU;
+         packet[packetLength++] = message->header.commandID & 0xFFU;
+         packet[packetLength++] = message->header.messageID & 0xFFU;
+         packet[packetLength++] = message->responseParams.length & 0xFFU;
 
-      if (tmpNumHexCharacters > 4)
-      {
-         tmpNumHexCharacters = 4;
+         for (uint16_t i = 0U; i < message->responseParams.length; i++)
+         {
+            packet[packetLength++] = 0x00FFU & (__byte((unsigned int*)message->responseParams.data, i));
+         }
+
+         // The CRC covers every byte before it, as sent
+         CRCLib_Begin(&crcContext, CRC_SEED);
+         for (uint16_t i = 0U; i < packetLength; i++)
+         {
+            CRCLib_UpdateByte(&crcContext, packet[i]);
+         }
+         const uint16_t calculatedCRC = CRCLib_Finish(&crcContext);
+         packet[packetLength++] = (calculatedCRC >> 8U) & 0xFFU;
+         packet[packetLength++] = calculatedCRC & 0xFFU;
+
+         // Frame the encoded packet and queue it with a single write
+         frame[0] = BINARY_FRAME_DELIMITER;
+         uint16_t frameLength = 1U + EncodeCobs(packet, packetLength, &frame[1]);
+         frame[frameLength++] = BINARY_FRAME_DELIMITER;
+         Serial_Send(channel, frame, frameLength, SERIAL_ENCODING_BINARY);
+
+         // Increment the number of messages sent
+         status.portData[channel].statistics.numMessagesSent++;
       }
+   }
+}
 
-      // Number of bits to shift
-      uint16_t shiftValue = 0U;
 
-      // Loop through each character
-      // Use 1-based indexing
-      for (uint16_t i = 1U; i <= tmpNumHexCharacters; i++)
-      {
-         // Convert next ASCII character to its HEX equivalent
-         tmpByte = ConvertAsciiHexCharToNumeric(*nextByte);
+// COBS encode a packet
+static uint16_t EncodeCobs(const uint16_t *const data, const uint16_t dataLength, uint16_t *const encodedData)
+{
+   // Each code byte holds the distance to the next zero, which is dropped
+   uint16_t codeIndex = 0U;
+   uint16_t encodedLength = 1U;
+   uint16_t code = 1U;
 
-         // We need to shift the HEX character to it's correct position:
-         // (i.e.) 7 in 0xF7FF must be shifted left 8 positions from zero
-         // to be in the right spot.
-         shiftValue = 4 * (tmpNumHexCharacters - i);
-         resultValue += ((uint16_t)tmpByte) << shiftValue;
+   for (uint16_t i = 0U; i < dataLength; i++)
+   {
+      const uint16_t tmpByte = data[i] & 0xFFU;
 
-         // Move to the next byte for the next pass through loop
-         nextByte++;
+      if (tmpByte != 0U)
+      {
+         encodedData[encodedLength++] = tmpByte;
+         code++;
+      }
+
+      // A zero, or a full block, closes the current block
+      if ((tmpByte == 0U) || (code == COBS_MAX_CODE))
+      {
+         encodedData[codeIndex] = code;
+         codeIndex = encodedLength++;
+         code = 1U;
       }
    }
 
-   // Finally, return the converted value
-   return(resultValue);
+   encodedData[codeIndex] = code;
+
+   return(encodedLength);
 }
 
 
-// Convert ASCII-coded hex value to 8-bit numeric representation
-static uint16_t ConvertAsciiHexCharToNumeric(const uint16_t charToConvert)
+// Check an ASCII-coded hex command and process it
+static void ProcessAsciiCommand(const UART_Drv_Channel_t channel, CommandItem_t *const asciiCommand)
 {
-   uint16_t value = 0U;
+   // Store the message object for easy access
+   MessageRouter_Message_t *const message = &(status.portData[channel].currentMessage);
 
-   // 'A' - 'F'
-   if ((charToConvert > 0x40) && (charToConvert < 0x47))
-   {
-      value = (charToConvert - 0x37);
-   }
-   // 'a' - 'f'
-   else if ((charToConvert > 0x60) && (charToConvert < 0x67))
-   {
-      value = (charToConvert - 0x57);
-   }
-   // '0' - '9'
-   else if ((charToConvert > 0x2F) && (charToConvert < 0x3A))
+   // Make sure the command is at least long enough to contain a complete
+   // header, since the response repeats it
+   if (asciiCommand->parseState > PARSE_STATE_DATA_LENGTH)
    {
-      value = (charToConvert - 0x30);
-   }
+      // Init the message to no error
+      message->responseCode = POWER_MESSAGEROUTER_RESPONSE_CODE_None;
+
+      // Setup the buffer for the response
+      message->responseParams.data = status.portData[channel].responseBuffer;
+      message->responseParams.maxLength = (uint16_t)RESPONSE_DATA_MAX_SIZE;
+      message->responseParams.length = 0U;
+
+      // Verify this message is intended for us
+      // If addressing is not used, our address will be the broadcast address and the message is accepted
+      if ((asciiCommand->destinationAddress == BROADCAST_ADDRESS) ||
+          (asciiCommand->destinationAddress == status.portData[channel].deviceAddress))
+      {
+         // Every field must be present with nothing after them, and every
+         // character must be a hex digit
+         const bool isWellFormed = (asciiCommand->parseState == PARSE_STATE_DONE) && !asciiCommand->isMalformed;
+
+         //-----------------------------------------------
+         // Verify computed CRC
+         //-----------------------------------------------
+         if ((!status.portData[channel].portConfig->isCrcChecked) ||
+             (isWellFormed && (asciiCommand->messageCRC == CRCLib_Finish(&asciiCommand->crcContext))))
+         {
+            //-----------------------------------------------
+            // Process Command
+            //-----------------------------------------------
 
-   // else, invalid hex character -- return 0
+            // Increment the number of messages received since this command will at least generate some sort of
+            // response message
+            status.portData[channel].statistics.numMessagesReceived++;
+            // The host is using ASCII-hex on this port
+            status.portData[channel].encoding = SERIAL_ENCODING_ASCII_CODED_HEX;
 
-   return(value);
+            // The data was decoded into the command buffer as it arrived, but
+            // only the bytes that fit were kept
+            if (isWellFormed && (message->commandParams.length <= message->commandParams.maxLength))
+            {
+               // Process message
+               MessageRouter_ProcessMessage(message);
+               // Send the response out the serial port.
+               SendResponseAsciiHex((UART_Drv_Channel_t)channel, message);
+            }
+            else
+            {
+               // The specified length is incorrect or longer than our available command buffer
+               // size, or the command holds a character that is not a hex digit.
+               // Do not process this command, just send a response with the same
+               // header, with a length of 0 and no data.
+               SendResponseAsciiHex((UART_Drv_Channel_t)channel, message);
+            }
+         }
+         else
+         {
+            // CRC Mismatch
+            // Do not process this message, just send a response with the same
+            // header, with a length of 0 and no data.
+            SendResponseAsciiHex((UART_Drv_Channel_t)channel, message);
+         }
+      } // Dst Address
+   }
 }
 
-//
-static char GetHexNibble(const uint16_t valueToConvert, uint16_t nibbleIndex)
+
+// Check a COBS framed binary command and process it
+static void ProcessBinaryCommand(const UART_Drv_Channel_t channel, CommandItem_t *const binaryCommand)
 {
-    char tmpASCIIChar;
-    uint16_t tmpNibble = 0x0FU & (valueToConvert >> (4 *nibbleIndex));
+   // Store the message object for easy access
+   MessageRouter_Message_t *const message = &(status.portData[channel].currentMessage);
+
+   // Only accept complete, intact messages intended for us. The frame must
+   // end right after the CRC.
+   if ((binaryCommand->parseState == PARSE_STATE_DONE) && !binaryCommand->isMalformed &&
+       ((!status.portData[channel].portConfig->isCrcChecked) ||
+        (binaryCommand->messageCRC == CRCLib_Finish(&binaryCommand->crcContext))) &&
+       ((binaryCommand->destinationAddress == BROADCAST_ADDRESS) ||
+        (binaryCommand->destinationAddress == status.portData[channel].deviceAddress)))
+   {
+      // Init the message to no error
+      message->responseCode = POWER_MESSAGEROUTER_RESPONSE_CODE_None;
 
-    // Convert to ASCII
-    // 0 - 1
-    if (tmpNibble < 10)
-    {
-       tmpASCIIChar = tmpNibble + 0x30;
-    }
-    // A - F
-    else if (tmpNibble < 16)
-    {
-       // character is 11-15 since it was masked to one nibble
-       tmpASCIIChar = tmpNibble + 0x37;
-    }
-    else
-    {
-       // Added so that if statement has a default case
-       tmpASCIIChar = 0;
-    }
+      //-----------------------------------------------
+      // Initialize Response Buffer
+      //-----------------------------------------------
+
+      message->responseParams.data = status.portData[channel].responseBuffer;
+      message->responseParams.maxLength = (uint16_t)RESPONSE_DATA_MAX_SIZE;
+      message->responseParams.length = 0U;
+
+      //-----------------------------------------------
+      // Process Command
+      //-----------------------------------------------
+
+      status.portData[channel].statistics.numMessagesReceived++;
+      // The host is using binary framing on this port
+      status.portData[channel].encoding = SERIAL_ENCODING_BINARY;
+
+      // The data was decoded into the command buffer as it arrived, but only
+      // the bytes that fit were kept
+      if (message->commandParams.length <= message->commandParams.maxLength)
+      {
+         // Process message
+         MessageRouter_ProcessMessage(message);
+      }
 
-    return(tmpASCIIChar);
+      // Send the response, which has a length of 0 and no data if the
+      // specified length was too long.
+      SendResponseBinary(channel, message);
+   }
 }
-// Convert value to ASCII-coded hex
-static void ConvertNumericToAsciiHexString(uint16_t *const destinationBuffer, const uint16_t desiredLength,
-                                           const uint16_t valueToConvert)
+
+
+// Convert a series of ASCII-coded hex values to a single 16-bit numeric value
+uint16_t Serial_ConvertAsciiHexStringToNumeric(uint16_t *const hexCharacters, const uint16_t numHexCharacters)
 {
-   // Check for NULL pointer.
-   if (destinationBuffer != 0)
-   {
-      // Loop through the number of characters requested and build the ASCII string
-       for (int i = 0; i < desiredLength; i+=2)
-       {
-          // Put the ASCII value in the next buffer position
-          // Destination is buffer address
-          *(destinationBuffer + i + 0) = GetHexNibble(valueToConvert, i + 1);
-          *(destinationBuffer + i + 1) = GetHexNibble(valueToConvert, i + 0);
-          //*(destinationBuffer + 2) = GetHexNibble(valueToConvert, 3);
-          //*(destinationBuffer + 3) = GetHexNibble(valueToConvert, 2);
-       }
-   }
+   // Default to 0 result
+   uint16_t resultValue = 0U;
+
+   // Since this returns a uint16_t, we can only convert a maximum
+   // of 4 characters.  If a length > 4 is specified, only do the
+   // first 4 characters.
+   // Malformed characters are converted as 0.
+   (void)HexLib_DecodeValue(&resultValue, hexCharacters, (numHexCharacters > 4U) ? 4U : numHexCharacters);
+
+   // Finally, return the converted value
+   return(resultValue);
 }
 
+
 /*******************************************************************************
 // Private Function Implementations
 *******************************************************************************/
 
 
 // Initialize all configured serial ports
-bool Serial_Init(const uint32_t moduleId, const void *configData)
+bool Serial_Init(const uint32_t moduleId, const Serial_Config_t *configPtr)
 {
     // Default module to uninitialized and not enabled
     status.isInitialized = false;
@@ -577,9 +1146,6 @@ bool Serial_Init(const uint32_t moduleId, const void *configData)
     // Store the module Id for error reporting
     status.moduleId = moduleId;
 
-    // TODO: Move configuration to table
-    // For now, no configuration data is passed in to this module
-
     //-----------------------------------------------
     // Buffer Initialization
     //-----------------------------------------------
@@ -587,14 +1153,51 @@ bool Serial_Init(const uint32_t moduleId, const void *configData)
     for (uint16_t portIndex = 0; portIndex < UART_DRV_CHANNEL_COUNT; portIndex++)
     {
         // Init the port information and buffers
+        // Ports start unconfigured, so they are not served
         memset(&status.portData[portIndex], 0, sizeof(PortData_t));
 
         // Always start with the broadcast address
         status.portData[portIndex].deviceAddress = BROADCAST_ADDRESS;
+
+        // Existing tools use ASCII-hex until a binary command is received
+        status.portData[portIndex].encoding = SERIAL_ENCODING_ASCII_CODED_HEX;
     }
 
-    // Mark initialization is complete
-    status.isInitialized = true;
+    // Start serving commands from the first port
+    status.firstChannel = 0U;
+
+    // First, validate the given parameter is valid
+    if ((configPtr != 0) && (configPtr->portConfigArray != 0))
+    {
+        bool isValid = true;
+
+        // Each port must be a known channel, listed once
+        for (uint16_t i = 0U; i < configPtr->numConfigItems; i++)
+        {
+            const Serial_PortConfig_t *const portConfig = &configPtr->portConfigArray[i];
+
+            if ((portConfig->channel < UART_DRV_CHANNEL_COUNT) &&
+                (status.portData[portConfig->channel].portConfig == 0) &&
+                ((portConfig->encoding == SERIAL_ENCODING_BINARY) ||
+                 (portConfig->encoding == SERIAL_ENCODING_ASCII_CODED_HEX)))
+            {
+                PortData_t *const portData = &status.portData[portConfig->channel];
+
+                portData->portConfig = portConfig;
+                portData->encoding = portConfig->encoding;
+#if (NUM_ADDRESS_BYTES > 0)
+                portData->deviceAddress = portConfig->deviceAddress;
+#endif
+            }
+            else
+            {
+                isValid = false;
+            }
+        }
+
+        // Mark initialization is complete
+        status.isInitialized = isValid;
+    }
 
    // Finally, return the result of the initialization
    return(status.isInitialized);
@@ -604,226 +1207,43 @@ bool Serial_Init(const uint32_t moduleId, const void *configData)
 // Scheduled update loop for processing messages
 void Serial_Update(void)
 {
-   // Loop through each port and check for new commands
-   //for (uint16_t channel = 0U; channel < UART_DRV_CHANNEL_COUNT; channel++)
-   for (uint16_t channel = UART_DRV_CHANNEL_DEBUG; channel <= UART_DRV_CHANNEL_DEBUG; channel++)
-   {
+   const Timebase_CycleCount_t startCycles = Timebase_GetCycleCount();
+   uint16_t numCommandsProcessed = 0U;
+   bool isCommandProcessed = true;
+
 #ifdef DEBUG_SEND_CONSTANT_DATA
-      // Constantly send data during every update loop
-      // This is just used for debugging serial port
-       uint16_t tmpByte = 0x2a;
-      Serial_Send(UART_DRV_CHANNEL_DEBUG, &tmpByte, 1, SERIAL_ENCODING_BINARY);
+   // Constantly send data during every update loop
+   // This is just used for debugging serial port
+   uint16_t tmpByte = 0x2a;
+   Serial_Send(UART_DRV_CHANNEL_DEBUG, &tmpByte, 1, SERIAL_ENCODING_BINARY);
 #endif
 
-      //-----------------------------------------------
-      // Process RX Data
-      //-----------------------------------------------
-      // Store the command object for easy access
-      ASCIICommandItem_t *asciiCommand = &(status.portData[channel].asciiCommand);
+   //-----------------------------------------------
+   // Process RX Data
+   //-----------------------------------------------
+   // Process every waiting command so a host may pipeline several, each with
+   // its own message ID. Each port is given one command per round until none
+   // are waiting or the budget is used.
+   while (isCommandProcessed && (numCommandsProcessed < (uint16_t)SERIAL_MAX_COMMANDS_PER_UPDATE) &&
+          ((Timebase_GetCycleCount() - startCycles) < (uint32_t)SERIAL_UPDATE_BUDGET_CYCLES))
+   {
+      isCommandProcessed = false;
 
-      // Look for a valid command in the circular RX buffer
-      if (FindNextCommand((UART_Drv_Channel_t)channel, asciiCommand))
+      for (uint16_t i = 0U; (i < (uint16_t)UART_DRV_CHANNEL_COUNT) &&
+                            (numCommandsProcessed < (uint16_t)SERIAL_MAX_COMMANDS_PER_UPDATE); i++)
       {
-         // A complete command was received, now we need to populate the standard
-         // message structure with the data in this command.
-
-         // Store the message object for easy access
-         MessageRouter_Message_t *const message = &(status.portData[channel].currentMessage);
+         const uint16_t channel = (status.firstChannel + i) % (uint16_t)UART_DRV_CHANNEL_COUNT;
 
-         // Make sure the length of the command is at least long enough to
-         // contain a complete HASCII command header.  The data in the Next Command
-         // buffer is HASCII, so compare it to the HASCII length of the command header.
-         if (asciiCommand->dataBufferLen >=
-                ((uint16_t)COMMAND_HEADER_SIZE_HASCII + (uint16_t)COMMAND_FOOTER_SIZE_HASCII))
+         if (ProcessNextCommand((UART_Drv_Channel_t)channel))
          {
-            // Init the message to no error
-            status.portData[channel].currentMessage.responseCode = POWER_MESSAGEROUTER_RESPONSE_CODE_None;
-
-            //-----------------------------------------------
-            // Parse Header
-            //-----------------------------------------------
-
-            // Populate the command header.  This tells the Message Router
-            // how to route the command to the destination module.
-
-            // We start at the first byte
-            uint16_t tmpIndex = (uint16_t)0U;
-            // 2 hex character per byte
-            uint16_t tmpCharacterCount = (uint16_t)HEX_CHARS_PER_BYTE;
-
-#if (NUM_ADDRESS_BYTES > 0)
-            // Extract the Destination Address
-            // Note size has been verified above to be at least Address +  Message Header + Data Length
-            uint16_t destinationAddress = (uint16_t)AsciiToHex(&(asciiCommand->data[tmpIndex]), tmpCharacterCount);
-
-            // Move to the next byte
-            tmpIndex += tmpCharacterCount;
-#else
-
-            // Addressing is not used, just set address to the broadcast address (0xFF)
-            uint16_t destinationAddress = (uint16_t)BROADCAST_ADDRESS;
-#endif
-
-            // Verify this message is intended for us
-            // If addressing is not used, our address will be the broadcast address and the message is accepted
-            if ((destinationAddress == BROADCAST_ADDRESS) ||
-                (destinationAddress == status.portData[channel].deviceAddress))
-            {
-               // Extract everything and verify the CRC
-#if (NUM_CRC_BYTES > 0)
-               // Init CRC to seed value
-               uint16_t calculatedCRC = CRC_SEED;
-#endif
-
-               // This message is for us, continue and extract the Module ID
-               message->header.moduleID =
-                                          (uint16_t)Serial_ConvertAsciiHexStringToNumeric(&(asciiCommand->data[tmpIndex]), tmpCharacterCount);
-
-               // Move to the next byte for CMD ID
-               tmpIndex += tmpCharacterCount;
-               message->header.commandID =
-                                           (uint16_t)Serial_ConvertAsciiHexStringToNumeric(&(asciiCommand->data[tmpIndex]), tmpCharacterCount);
-
-               // Move to the next byte for MSG ID
-               tmpIndex += tmpCharacterCount;
-               message->header.messageID =
-                                           (uint16_t)Serial_ConvertAsciiHexStringToNumeric(&(asciiCommand->data[tmpIndex]), tmpCharacterCount);
-
-               //-----------------------------------------------
-               // Initialize Command Buffer
-               //-----------------------------------------------
-
-               // Move to the next byte for DATA LENGTH
-               tmpIndex += tmpCharacterCount;
-               // Assign the command buffer
-               message->commandParams.data = status.portData[channel].commandBuffer;
-               // Set the max size to prevent other modules from overwriting the bounds of the data buffer.
-               message->commandParams.maxLength = (uint16_t)COMMAND_DATA_MAX_SIZE;
-               // Get the length byte
-               message->commandParams.length =
-                                               (uint16_t)Serial_ConvertAsciiHexStringToNumeric(&(asciiCommand->data[tmpIndex]), tmpCharacterCount);
-
-               //-----------------------------------------------
-               // Initialize Response Buffer
-               //-----------------------------------------------
-
-               // Setup the buffer for the response
-               message->responseParams.data = status.portData[channel].responseBuffer;
-               message->responseParams.maxLength = (uint16_t)RESPONSE_DATA_MAX_SIZE;
-               message->responseParams.length = 0U;
-
-#if (NUM_CRC_BYTES > 0)
-               // Extract the CRC - Skip data characters
-               tmpIndex += (HEX_CHARS_PER_BYTE * message->commandParams.length);
-               //&(asciiCommand->data[(uint16_t)tmpIndex + HEX_CHARS_PER_BYTE * message->commandParams.length]),
-               // TODO -- Compiler intrinsic - Conversion routine does not handle byte order?
-               uint16_t messageCRC = 0;
-               for (unsigned int i = 0; i < NUM_CRC_BYTES; i++)
-               {
-                   // Move to next byte
-                   tmpIndex += tmpCharacterCount;
-                   // Use instrinsic to store byte
-                   __byte((unsigned int*)&messageCRC, i) = (uint16_t)Serial_ConvertAsciiHexStringToNumeric(
-                                                                  &(asciiCommand->data[(uint16_t)tmpIndex]),
-                                                                  tmpCharacterCount);
-               }
-
-               // Calculate the CRC
-               calculatedCRC = CRCLib_Calculate(calculatedCRC, &message->header.moduleID, 1);
-               calculatedCRC = CRCLib_Calculate(calculatedCRC, &message->header.commandID, 1);
-               calculatedCRC = CRCLib_Calculate(calculatedCRC, &message->header.messageID, 1);
-               calculatedCRC = CRCLib_Calculate(calculatedCRC, &message->commandParams.length, 1);
-               calculatedCRC = CRCLib_Calculate(calculatedCRC, message->commandParams.data, message->commandParams.length);
-#else
-               // If not using the CRC, just set to seed value for comparison
-               uint16_t messageCRC = CRC_SEED;
-#endif
-
-                //-----------------------------------------------
-                // Verify computed CRC
-                //-----------------------------------------------
-                //TODO - if (messageCRC == calculatedCRC)
-               if (true)
-                {
-
-                   //-----------------------------------------------
-                   // Process Command
-                   //-----------------------------------------------
-
-                   // Increment the number of messages received since this command will at least generate some sort of
-                   // response message
-                   status.portData[channel].statistics.numMessagesReceived++;
-
-                   // Verify the length
-                   // The length in the command buffer is what was specified in the command
-                   // and represents the number of hex bytes are in the data field after converting
-                   // from HASCII.  The sNextCommand buffer is still in HASCII, so we need to
-                   // convert the length in the command buffer to HASCII by multiplying by 2.
-                   if (asciiCommand->dataBufferLen ==
-                          (COMMAND_HEADER_SIZE_HASCII + (HEX_CHARS_PER_BYTE * message->commandParams.length) +
-                           COMMAND_FOOTER_SIZE_HASCII))
-                   {
-                      // Length is correct.
-                      // Now ensure the length is within the bounds of the data buffer
-                      // before we convert the HASCII bytes to binary and copy them to the
-                      // buffer.  This will prevent buffer overflow.
-                      if (message->commandParams.length <= message->commandParams.maxLength)
-                      {
-                         // Convert each byte in the data field from HASCII to hex.
-                         for (uint16_t i = 0U; i < message->commandParams.length; i++)
-                         {
-                            // Convert the next data byte from HASCII to hex and store in
-                            // the command data buffer.
-                             // See if we are on system using 16-bit chars
-                             if (16 == CHAR_BIT)
-                             {
-                                 // Use compiler intrinsic to write to data buffer
-                                 __byte((unsigned int*)status.portData[channel].commandBuffer, i) = Serial_ConvertAsciiHexStringToNumeric(&(asciiCommand->data[(uint16_t)COMMAND_HEADER_SIZE_HASCII + HEX_CHARS_PER_BYTE * i]), HEX_CHARS_PER_BYTE);
-                             }
-                             else
-                             {
-                                status.portData[channel].commandBuffer[i] = (uint16_t)Serial_ConvertAsciiHexStringToNumeric(
-                                                                            &(asciiCommand->data[(uint16_t)COMMAND_HEADER_SIZE_HASCII + HEX_CHARS_PER_BYTE * i]),
-                                                                            HEX_CHARS_PER_BYTE);
-                             }
-                         }
-
-                         // Process message
-                         MessageRouter_ProcessMessage(message);
-                         // Increment the number of messages sent
-                         // Send the response out the serial port.
-                         SendResponseAsciiHex((UART_Drv_Channel_t)channel, message);
-                      }
-                      else
-                      {
-                         // The specified length is longer than our available command buffer size.
-                         // Do not process this command, just send a response with the same
-                         // header, with a length of 0 and no data.
-                         SendResponseAsciiHex((UART_Drv_Channel_t)channel, message);
-                      }
-                   }
-                   else
-                   {
-                       // The specified length is incorrect.
-                       // Do not process this message, just send a response with the same
-                       // header, with a length of 0 and no data.
-                       SendResponseAsciiHex((UART_Drv_Channel_t)channel, message);
-                   }
-                }
-                else
-                {
-                    // CRC Mismatch
-                    // Do not process this message, just send a response with the same
-                    // header, with a length of 0 and no data.
-                    SendResponseAsciiHex((UART_Drv_Channel_t)channel, message);
-                }
-            } // Dst Address
-
-             // Command has been processed, remove it.
-             asciiCommand->dataBufferLen = 0U;
+            isCommandProcessed = true;
+            numCommandsProcessed++;
          }
       }
    }
+
+   // Serve the next port first on the next update
+   status.firstChannel = (status.firstChannel + 1U) % (uint16_t)UART_DRV_CHANNEL_COUNT;
 }
 
 
@@ -839,6 +1259,57 @@ void Serial_ResetStats(const UART_Drv_Channel_t channel)
 }
 
 
+// Select the encoding for the given port
+void Serial_SetEncoding(const UART_Drv_Channel_t channel, const Serial_Encoding_t encoding)
+{
+   // Verify the port is valid
+   if (channel < UART_DRV_CHANNEL_COUNT)
+   {
+      status.portData[channel].encoding = encoding;
+   }
+}
+
+
+// Get the encoding negotiated for the given port
+Serial_Encoding_t Serial_GetEncoding(const UART_Drv_Channel_t channel)
+{
+   return((channel < UART_DRV_CHANNEL_COUNT) ? status.portData[channel].encoding : SERIAL_ENCODING_ASCII_CODED_HEX);
+}
+
+
+// Send a message that was not requested by a command
+bool Serial_SendMessage(const UART_Drv_Channel_t channel, MessageRouter_Message_t *const message)
+{
+   bool wasSent = false;
+
+   // Verify the port and message are valid
+   if ((channel < UART_DRV_CHANNEL_COUNT) && (message != 0) && (message->responseParams.data != 0) &&
+       (message->responseParams.length <= (uint16_t)RESPONSE_DATA_MAX_SIZE))
+   {
+      const Serial_Encoding_t encoding = status.portData[channel].encoding;
+
+      // A command waiting for room goes first, and the response of the next
+      // one must still fit afterwards
+      if ((!status.portData[channel].command.isComplete) &&
+          (UART_Drv_GetTxBufferSpace(channel) >=
+           (GetResponseFrameSize(encoding, message->responseParams.length) + GetResponseReserve(channel))))
+      {
+         if (encoding == SERIAL_ENCODING_BINARY)
+         {
+            SendResponseBinary(channel, message);
+         }
+         else
+         {
+            SendResponseAsciiHex(channel, message);
+         }
+         wasSent = true;
+      }
+   }
+
+   return(wasSent);
+}
+
+
 // Send encoded data to the given port
 void Serial_Send(const UART_Drv_Channel_t channel, uint16_t *const data, const uint16_t dataLength,
                        const Serial_Encoding_t outputEncoding)
@@ -846,50 +1317,34 @@ void Serial_Send(const UART_Drv_Channel_t channel, uint16_t *const data, const u
    // Verify the channel index is valid
    if (channel < UART_DRV_CHANNEL_COUNT)
    {
-      // Make sure the length of the data we want to send will fit in the TX buffer -- max 255 bytes
-      if ((data != 0) && (dataLength < (uint16_t)TX_BUFFER_SIZE))
+      // The number of characters the data takes once encoded
+      const uint32_t encodedLength = (SERIAL_ENCODING_ASCII_CODED_HEX == outputEncoding) ?
+                                     ((uint32_t)HEX_CHARS_PER_BYTE * dataLength) : dataLength;
+
+      // Make sure all of the encoded data fits in the free space of the TX
+      // buffer of the channel, so none of it is dropped
+      if ((data != 0) && (encodedLength <= UART_Drv_GetTxBufferSpace(channel)))
       {
          // Output buffer for converting each byte to hex -- only used for Hex encoding
-         uint16_t tmpOutputBuffer[HEX_MULTIPLE * HEX_CHARS_PER_BYTE];
+         uint16_t tmpOutputBuffer[HEX_CHARS_PER_BYTE * SEND_CHUNK_SIZE];
 
          // If this message is a response message, convert the TxBuffer data into
          // ASCII encoded hex or HASCII (i.e. 0x0F = "0F").
          switch (outputEncoding)
          {
             case SERIAL_ENCODING_ASCII_CODED_HEX:
-               // Convert each data byte to HASCII and put in TX Buffer
+               // Convert the data to HASCII a chunk at a time and put in TX Buffer
                // UART_Write implements a circular buffer so we do not have to wait
+               // The data is packed two bytes per word, low byte first, so a single
+               // byte is taken from the low 8 bits.
+               for (uint16_t i = 0U; i < dataLength; i += SEND_CHUNK_SIZE)
+               {
+                  const uint16_t chunkLength = ((dataLength - i) < SEND_CHUNK_SIZE) ? (dataLength - i) : SEND_CHUNK_SIZE;
 
-                // Handle single byte of data
-                if (dataLength == 1)
-                {
-                    // Be sure to mask data since we are sending only a single byte from data
-                    ConvertNumericToAsciiHexString(tmpOutputBuffer, HEX_MULTIPLE, 0x00FF & *(data));
-                    // Add the two characters to the tx buffer.
-                    UART_Drv_Write(channel, tmpOutputBuffer, HEX_MULTIPLE);
-                    // Increment the bytes sent by 2 bytes
-                    status.portData[channel].statistics.numBytesSent += HEX_MULTIPLE;
-                }
-                else if (dataLength > 0) // MAke sure we have data to send
-                {
-                    // Else, we are trying to send more than one byte
-                    // TODO: Should we support byte length that are not a multiple of HEX_MULTIPLE?
-                    //for (uint16_t i = 0U; i < dataLength/HEX_MULTIPLE; i++)
-                    for (uint16_t i = 0U; i < dataLength; i++)
-                    {
-                       ConvertNumericToAsciiHexString(tmpOutputBuffer, HEX_MULTIPLE, 0x00FF & (__byte((unsigned int*)data, i)));
-                       UART_Drv_Write(channel, tmpOutputBuffer, HEX_MULTIPLE);
-                       status.portData[channel].statistics.numBytesSent += HEX_MULTIPLE;
-                       /*
-                       // If data is more than 1 byte, send as 4 bytes on 16-bit system
-                       ConvertNumericToAsciiHexString(tmpOutputBuffer, sizeof(tmpOutputBuffer), *(data + i));
-
-                       // Add the two/four characters to the tx buffer.
-                       UART_Drv_Write(channel, tmpOutputBuffer, (sizeof(tmpOutputBuffer)));
-                       // Increment the bytes sent by 2 bytes
-                       status.portData[channel].statistics.numBytesSent += (sizeof(tmpOutputBuffer));
-                       */
-                   }
+                  // Chunks are a whole number of words
+                  HexLib_Encode(tmpOutputBuffer, &data[i / 2U], chunkLength);
+                  UART_Drv_Write(channel, tmpOutputBuffer, HEX_CHARS_PER_BYTE * chunkLength);
+                  status.portData[channel].statistics.numBytesSent += HEX_CHARS_PER_BYTE * chunkLength;
                }
 
                break;
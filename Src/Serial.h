@@ -17,6 +17,7 @@ extern "C"
 #include "MessageRouter.h"
 #include "UART_Drv.h"
 // Other Includes
+#include <stdbool.h>
 #include <stdint.h>
 
 /*******************************************************************************
@@ -30,30 +31,64 @@ extern "C"
 // Encoding type enumeration
 typedef enum
 {
-   // Protocol uses binary encoding for protocol data
+   // Protocol uses binary encoding for protocol data. Commands and responses
+   // are sent as COBS frames delimited by zero bytes.
    SERIAL_ENCODING_BINARY,
    // Protocol uses ASCII-coded hex encoding for protocol data
    SERIAL_ENCODING_ASCII_CODED_HEX
 } Serial_Encoding_t;
 
+// Describes a port served by the serial protocol
+typedef struct
+{
+   // The UART channel of the port
+   UART_Drv_Channel_t channel;
+   // The encoding used until a command is received, and for messages sent
+   // without a command
+   Serial_Encoding_t encoding;
+   // Set to accept commands in either encoding and answer each in its own.
+   // Otherwise frames in the other encoding are ignored, so a link to another
+   // device cannot be switched by line noise.
+   bool isEncodingNegotiated;
+   // Set to reject commands whose CRC does not match. Clear only for a port
+   // where commands are typed by hand. The CRC field must still be sent.
+   bool isCrcChecked;
+   // The address of this device on the port, used if addressing is enabled
+   uint16_t deviceAddress;
+} Serial_PortConfig_t;
+
+// Common configuration structure passed to the module initialization function
+// Data is generally defined in the board-specific configuration file
+typedef struct
+{
+   // The number of items in the portConfigArray - calculated by compiler
+   uint16_t numConfigItems;
+   // The ports served. UART channels that are not listed are not served.
+   const Serial_PortConfig_t *portConfigArray;
+} Serial_Config_t;
+
 /*******************************************************************************
 // Public Function Declarations
 *******************************************************************************/
 
 /** Description:
- *    This function initializes the serial module and calls the
- *    UART driver initialization function for each configure port.
+ *    This function initializes the serial module for each configured port.
+ *    The UART driver must already be initialized.
  * History:
  *    * Date: Function created (EJH)    
  *
  */
-bool Serial_Init(const uint32_t moduleId, const void *configData);
+bool Serial_Init(const uint32_t moduleId, const Serial_Config_t *configPtr);
 
 
 /** Description:
  *    This is the scheduled update function that will check the receive buffer
- *    for a complete command.  If found, the corresponding command will be
- *    executed via a call to the Message Router module.
+ *    for complete commands.  Each command found is executed via a call to the
+ *    Message Router module. Every waiting command is processed, taking turns
+ *    between ports, up to SERIAL_MAX_COMMANDS_PER_UPDATE commands or
+ *    SERIAL_UPDATE_BUDGET_CYCLES cycles. A command is left waiting while the
+ *    TX buffer has no room for its response, and the UART driver is asked to
+ *    call back once there is, which should schedule this function again.
  * History:
  *    * Date: Function created (EJH)    
  *
@@ -70,6 +105,46 @@ void Serial_Update(void);
  */
 void Serial_ResetStats(const UART_Drv_Channel_t channel);
 
+/** Description:
+ *    Selects the encoding of the data sent on the given port. Each port
+ *    starts with the encoding of its configuration. A port whose encoding is
+ *    negotiated accepts commands of either framing and follows the framing of
+ *    each valid command received, so this is only needed to choose the
+ *    encoding of data sent before a host has connected. A port whose encoding
+ *    is not negotiated ignores frames of the other encoding, and this does not
+ *    change which frames it accepts.
+ * Parameters:
+ *    channel - The configured UART port
+ *    encoding - The encoding to be used
+ */
+void Serial_SetEncoding(const UART_Drv_Channel_t channel, const Serial_Encoding_t encoding);
+
+/** Description:
+ *    Returns the encoding negotiated for the given port, for modules that
+ *    send data without a command.
+ * Parameters:
+ *    channel - The configured UART port
+ * Returns:
+ *    Serial_Encoding_t: The encoding in use, ASCII-coded hex for an invalid port
+ */
+Serial_Encoding_t Serial_GetEncoding(const UART_Drv_Channel_t channel);
+
+/** Description:
+ *    Sends a message that was not requested by a command, such as telemetry,
+ *    framed the same as a response with the encoding negotiated for the port.
+ *    The response parameters of the message are sent. Nothing is sent if the
+ *    whole frame does not fit in the transmit buffer, so a busy port never
+ *    receives a partial frame. Room is also kept for the largest response a
+ *    command on the port could need, and nothing is sent while a command is
+ *    waiting for room, so these messages cannot hold back commands.
+ * Parameters:
+ *    channel - The configured UART port
+ *    message - The message to be sent
+ * Returns:
+ *    bool - true if the frame was queued for transmit
+ */
+bool Serial_SendMessage(const UART_Drv_Channel_t channel, MessageRouter_Message_t *const message);
+
 /** Description:
  *    This function is called to transmit data to the given UART. The data that
  *    is passed into this function will be placed in the circular transmit
@@ -77,8 +152,8 @@ void Serial_ResetStats(const UART_Drv_Channel_t channel);
  *    by writing the first byte. After the first byte, each byte from the
  *    circular buffer is sent via the transmit interrupt until the buffer
  *    is empty.
- *    NOTE:  Never send data with more than TX_BUFFER_SIZE values, or the data will
- *           wrap around the circular TX buffer.
+ *    NOTE:  Nothing is sent if the encoded data does not fit in the free
+ *           space of the TX buffer of the channel.
  * Parameters:
  *    channel - The configured UART pin that is to be written
  *    data - A pointer to the data that is to be sent.
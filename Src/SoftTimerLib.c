@@ -75,7 +75,7 @@ void SoftTimerLib_StartTimer(SoftTimerLib_Timer_t *const timer, const uint32_t d
          timer->startTimestamp = Timebase_GetCurrentTickCount();
 
          // Store the duration
-         timer->durationTicks = durationMilliseconds * (uint32_t)TIMEBASE_NUM_TICKS_PER_MILLISECOND;
+         timer->durationTicks = Timebase_MillisecondsToTicks(durationMilliseconds);
       }
    }
 }
@@ -207,7 +207,7 @@ uint32_t SoftTimerLib_GetRemainingTimeMilliseconds(SoftTimerLib_Timer_t *const t
    if (NULL != timer)
    {
       // Timer is valid, query thge remaining time and convert to milliseconds
-      remainingMilliseconds = SoftTimerLib_GetRemainingTimeTicks(timer) / (uint32_t)TIMEBASE_NUM_TICKS_PER_MILLISECOND;
+      remainingMilliseconds = Timebase_TicksToMilliseconds(SoftTimerLib_GetRemainingTimeTicks(timer));
    }
 
    // Finally, return the result
@@ -31,7 +31,8 @@ extern "C"
 *******************************************************************************/
 
 // The maximum duration for a timer. We allow for 1 day to hold prevent 
-// overflow in time conversion routines
+// overflow in time conversion routines. Faster tick rates may reduce this
+// further (see POWER_SOFTTIMERLIB_MAX_DURATION_MILLISECONDS).
 #define POWER_SOFTTIMERLIB_MAX_DURATION_DAYS       (1)
 // 1 millisecond converted to microseconds
 #define POWER_SOFTTIMERLIB_MICROSECONDS_PER_MILLISECOND (1000U)
@@ -45,12 +46,20 @@ extern "C"
 #define POWER_SOFTTIMERLIB_MILLISECONDS_PER_HOUR   ((uint32_t)POWER_SOFTTIMERLIB_MILLISECONDS_PER_MINUTE * (uint32_t)60U)
 // 1 day converted to milliseconds
 #define POWER_SOFTTIMERLIB_MILLISECONDS_PER_DAY    ((uint32_t)POWER_SOFTTIMERLIB_MILLISECONDS_PER_HOUR * (uint32_t)24U)
+// Longest duration in ticks. A quarter of the tick range keeps the sum of two
+// durations (such as a scheduler interval and phase offset) within the range in
+// which wrapped ticks can still be compared.
+#define POWER_SOFTTIMERLIB_MAX_TICK_RANGE (UINT32_C(0x3FFFFFFF))
 // Maximum timer duration converted to milliseconds.  Max uint32_t of 0xFFFFFFFF is reserved
-#define POWER_SOFTTIMERLIB_MAX_DURATION_MILLISECONDS (POWER_SOFTTIMERLIB_MAX_DURATION_DAYS * POWER_SOFTTIMERLIB_MILLISECONDS_PER_DAY)
+// This is limited to POWER_SOFTTIMERLIB_MAX_TICK_RANGE at fast tick rates.
+#define POWER_SOFTTIMERLIB_MAX_DURATION_MILLISECONDS \
+   (((POWER_SOFTTIMERLIB_MAX_DURATION_DAYS * POWER_SOFTTIMERLIB_MILLISECONDS_PER_DAY) <= (POWER_SOFTTIMERLIB_MAX_TICK_RANGE / TIMEBASE_NUM_TICKS_PER_MILLISECOND)) ? \
+    (POWER_SOFTTIMERLIB_MAX_DURATION_DAYS * POWER_SOFTTIMERLIB_MILLISECONDS_PER_DAY) : \
+    (POWER_SOFTTIMERLIB_MAX_TICK_RANGE / TIMEBASE_NUM_TICKS_PER_MILLISECOND))
 // Maximum timer duration converted to seconds
 #define POWER_SOFTTIMERLIB_MAX_DURATION_SECONDS (POWER_SOFTTIMERLIB_MAX_DURATION_MILLISECONDS / POWER_SOFTTIMERLIB_MILLISECONDS_PER_SECOND)
 // Maximum timer duration converted to Timebase ticks
-#define POWER_SOFTTIMERLIB_MAX_DURATION_TICKS (POWER_SOFTTIMERLIB_MAX_DURATION_MILLISECONDS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND)
+#define POWER_SOFTTIMERLIB_MAX_DURATION_TICKS (POWER_SOFTTIMERLIB_MAX_DURATION_MILLISECONDS * TIMEBASE_NUM_TICKS_PER_MILLISECOND)
 
 
 /*******************************************************************************
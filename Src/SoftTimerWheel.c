@@ -0,0 +1,356 @@
+/*******************************************************************************
+// Software Timer Wheel Implementation
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "SoftTimerWheel.h" // Module header
+// Platform Includes
+#include "SoftTimerLib.h" // Maximum timer duration
+#include "Timebase.h" // Define System Ticks
+// Other Includes
+#include <stddef.h> // Defines NULL
+#include <stdint.h> // C99 Integer Types
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// Mask that selects the slot index from a shifted expiry tick
+#define SLOT_INDEX_MASK (SOFTTIMERWHEEL_NUM_SLOTS - 1U)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+ *    Set a list head to an empty list.
+ * Parameters:
+ *    head - The list head to be cleared
+ */
+static inline void InitList(SoftTimerWheel_Link_t *const head);
+
+/** Description:
+ *    Remove a timer from the list it is in.
+ * Parameters:
+ *    timer - The timer to be removed. It must be in a list.
+ */
+static inline void Unlink(SoftTimerWheel_Timer_t *const timer);
+
+/** Description:
+ *    Move all timers from one list to the end of another, leaving the source
+ *    list empty.
+ * Parameters:
+ *    destination - The list that receives the timers
+ *    source - The list whose timers are moved
+ */
+static inline void MoveList(SoftTimerWheel_Link_t *const destination, SoftTimerWheel_Link_t *const source);
+
+/** Description:
+ *    Add a timer to the slot that matches its expiry tick. Timers due within
+ *    SOFTTIMERWHEEL_NUM_SLOTS ticks go in level 0, and each further level is
+ *    used for timers due within SOFTTIMERWHEEL_NUM_SLOTS times the range of
+ *    the level below.
+ * Parameters:
+ *    wheel - The wheel that receives the timer
+ *    timer - The timer to be added. It must not be in a list.
+ */
+static void InsertTimer(SoftTimerWheel_t *const wheel, SoftTimerWheel_Timer_t *const timer);
+
+/** Description:
+ *    Move the timers in the current slot of each higher level down to the
+ *    levels below. Called when the level 0 slot index returns to 0. A level
+ *    is only moved down when all levels below it have also returned to 0.
+ * Parameters:
+ *    wheel - The wheel being serviced
+ */
+static void CascadeTimers(SoftTimerWheel_t *const wheel);
+
+/** Description:
+ *    Call the timers in the level 0 slot of the current tick. The slot is
+ *    detached first so callbacks may safely start and stop any timer.
+ * Parameters:
+ *    wheel - The wheel being serviced
+ * Returns:
+ *    uint16_t - The number of callbacks called
+ */
+static uint16_t ExpireTimers(SoftTimerWheel_t *const wheel);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Clear a list
+static inline void InitList(SoftTimerWheel_Link_t *const head)
+{
+   head->next = head;
+   head->prev = head;
+}
+
+// Remove a timer from its list
+static inline void Unlink(SoftTimerWheel_Timer_t *const timer)
+{
+   timer->link.prev->next = timer->link.next;
+   timer->link.next->prev = timer->link.prev;
+
+   // A timer that is not in a list is stopped
+   timer->link.next = NULL;
+   timer->link.prev = NULL;
+}
+
+// Move all timers between lists
+static inline void MoveList(SoftTimerWheel_Link_t *const destination, SoftTimerWheel_Link_t *const source)
+{
+   if (source->next != source)
+   {
+      source->next->prev = destination->prev;
+      source->prev->next = destination;
+      destination->prev->next = source->next;
+      destination->prev = source->prev;
+
+      InitList(source);
+   }
+}
+
+// Add a timer to the wheel
+static void InsertTimer(SoftTimerWheel_t *const wheel, SoftTimerWheel_Timer_t *const timer)
+{
+   const Timebase_Tick_t ticksUntilExpiry = timer->expiryTick - wheel->currentTick;
+   uint16_t level = 0U;
+   SoftTimerWheel_Link_t *slot;
+
+   // Find the lowest level whose range includes the expiry
+   while ((level < (SOFTTIMERWHEEL_NUM_LEVELS - 1U)) &&
+          (ticksUntilExpiry >= ((Timebase_Tick_t)1U << (SOFTTIMERWHEEL_SLOT_BITS * (level + 1U)))))
+   {
+      level++;
+   }
+
+   // Add to the end of the slot so timers due on the same tick keep their order
+   slot = &wheel->slots[level][(timer->expiryTick >> (SOFTTIMERWHEEL_SLOT_BITS * level)) & SLOT_INDEX_MASK];
+   timer->link.next = slot;
+   timer->link.prev = slot->prev;
+   slot->prev->next = &timer->link;
+   slot->prev = &timer->link;
+}
+
+// Move timers down to the lower levels
+static void CascadeTimers(SoftTimerWheel_t *const wheel)
+{
+   uint16_t level = 1U;
+   uint16_t slotIndex;
+
+   do
+   {
+      SoftTimerWheel_Link_t cascading;
+
+      slotIndex = (uint16_t)((wheel->currentTick >> (SOFTTIMERWHEEL_SLOT_BITS * level)) & SLOT_INDEX_MASK);
+
+      // Detach the slot, then re-insert each timer relative to the current tick
+      InitList(&cascading);
+      MoveList(&cascading, &wheel->slots[level][slotIndex]);
+
+      while (cascading.next != &cascading)
+      {
+         SoftTimerWheel_Timer_t *const timer = (SoftTimerWheel_Timer_t *)cascading.next;
+
+         Unlink(timer);
+         InsertTimer(wheel, timer);
+      }
+
+      level++;
+   } while ((0U == slotIndex) && (level < SOFTTIMERWHEEL_NUM_LEVELS));
+}
+
+// Call the timers due on the current tick
+static uint16_t ExpireTimers(SoftTimerWheel_t *const wheel)
+{
+   SoftTimerWheel_Link_t expiring;
+   uint16_t numExpired = 0U;
+
+   InitList(&expiring);
+   MoveList(&expiring, &wheel->slots[0][wheel->currentTick & SLOT_INDEX_MASK]);
+
+   // A callback may stop a timer still in this list, which removes it from the
+   // list, so the next timer is only read once the previous one is done
+   while (expiring.next != &expiring)
+   {
+      SoftTimerWheel_Timer_t *const timer = (SoftTimerWheel_Timer_t *)expiring.next;
+
+      Unlink(timer);
+      wheel->numRunningTimers--;
+
+      // Restart a periodic timer at a fixed rate before the callback so the
+      // callback may stop or restart it
+      if (0U != timer->periodTicks)
+      {
+         timer->expiryTick += timer->periodTicks;
+         InsertTimer(wheel, timer);
+         wheel->numRunningTimers++;
+      }
+
+      if (NULL != timer->callback)
+      {
+         timer->callback(timer, timer->context);
+      }
+
+      numExpired++;
+   }
+
+   return(numExpired);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Init the given wheel
+void SoftTimerWheel_Init(SoftTimerWheel_t *const wheel, const Timebase_Tick_t currentTick)
+{
+   // Validate the given parameter
+   if (NULL != wheel)
+   {
+      for (uint16_t level = 0U; level < SOFTTIMERWHEEL_NUM_LEVELS; level++)
+      {
+         for (uint16_t slotIndex = 0U; slotIndex < SOFTTIMERWHEEL_NUM_SLOTS; slotIndex++)
+         {
+            InitList(&wheel->slots[level][slotIndex]);
+         }
+      }
+
+      wheel->currentTick = currentTick;
+      wheel->numRunningTimers = 0U;
+   }
+}
+
+// Init the given timer
+void SoftTimerWheel_InitTimer(SoftTimerWheel_Timer_t *const timer, const SoftTimerWheel_Callback_t callback,
+                              void *const context)
+{
+   // Validate the given parameter
+   if (NULL != timer)
+   {
+      timer->link.next = NULL;
+      timer->link.prev = NULL;
+      timer->expiryTick = 0U;
+      timer->durationTicks = 0U;
+      timer->periodTicks = 0U;
+      timer->callback = callback;
+      timer->context = context;
+   }
+}
+
+// Start or restart a timer
+void SoftTimerWheel_StartTimerTicks(SoftTimerWheel_t *const wheel, SoftTimerWheel_Timer_t *const timer,
+                                    const Timebase_Tick_t durationTicks, const Timebase_Tick_t periodTicks)
+{
+   // Validate the given parameters
+   if ((NULL != wheel) && (NULL != timer))
+   {
+      if (SoftTimerWheel_IsTimerRunning(timer))
+      {
+         Unlink(timer);
+         wheel->numRunningTimers--;
+      }
+
+      // Keep the durations within the range of the wheel. A duration of 0 is
+      // treated as 1 so the timer is never placed in the slot being serviced.
+      timer->durationTicks = (durationTicks > SOFTTIMERWHEEL_MAX_DURATION_TICKS) ? SOFTTIMERWHEEL_MAX_DURATION_TICKS : durationTicks;
+      timer->periodTicks = (periodTicks > SOFTTIMERWHEEL_MAX_DURATION_TICKS) ? SOFTTIMERWHEEL_MAX_DURATION_TICKS : periodTicks;
+      timer->expiryTick = wheel->currentTick + ((0U == timer->durationTicks) ? 1U : timer->durationTicks);
+
+      InsertTimer(wheel, timer);
+      wheel->numRunningTimers++;
+   }
+}
+
+// Start or restart a timer in milliseconds
+void SoftTimerWheel_StartTimer(SoftTimerWheel_t *const wheel, SoftTimerWheel_Timer_t *const timer,
+                               const uint32_t durationMilliseconds, const uint32_t periodMilliseconds)
+{
+   // Limit the times so the conversion cannot overflow
+   const uint32_t duration = (durationMilliseconds > POWER_SOFTTIMERLIB_MAX_DURATION_MILLISECONDS) ?
+                             POWER_SOFTTIMERLIB_MAX_DURATION_MILLISECONDS : durationMilliseconds;
+   const uint32_t period = (periodMilliseconds > POWER_SOFTTIMERLIB_MAX_DURATION_MILLISECONDS) ?
+                           POWER_SOFTTIMERLIB_MAX_DURATION_MILLISECONDS : periodMilliseconds;
+
+   SoftTimerWheel_StartTimerTicks(wheel, timer, Timebase_MillisecondsToTicks(duration), Timebase_MillisecondsToTicks(period));
+}
+
+// Start a timer again with its last duration
+void SoftTimerWheel_RestartTimer(SoftTimerWheel_t *const wheel, SoftTimerWheel_Timer_t *const timer)
+{
+   // Validate the given parameter
+   if (NULL != timer)
+   {
+      SoftTimerWheel_StartTimerTicks(wheel, timer, timer->durationTicks, timer->periodTicks);
+   }
+}
+
+// Stop a timer
+void SoftTimerWheel_StopTimer(SoftTimerWheel_t *const wheel, SoftTimerWheel_Timer_t *const timer)
+{
+   // Validate the given parameters
+   if ((NULL != wheel) && SoftTimerWheel_IsTimerRunning(timer))
+   {
+      Unlink(timer);
+      wheel->numRunningTimers--;
+   }
+}
+
+// See if the timer is running
+bool SoftTimerWheel_IsTimerRunning(const SoftTimerWheel_Timer_t *const timer)
+{
+   // Timer is running if it is linked into a wheel
+   return((NULL != timer) && (NULL != timer->link.next));
+}
+
+// Advance the wheel and call expired timers
+uint16_t SoftTimerWheel_Service(SoftTimerWheel_t *const wheel, const Timebase_Tick_t currentTick)
+{
+   uint16_t numExpired = 0U;
+
+   // Validate the given parameter
+   if (NULL != wheel)
+   {
+      // Step one tick at a time. A tick that is behind the wheel is ignored.
+      while ((int32_t)(currentTick - wheel->currentTick) > 0)
+      {
+         // Nothing can expire in an empty wheel, so jump straight to the tick
+         if (0U == wheel->numRunningTimers)
+         {
+            wheel->currentTick = currentTick;
+         }
+         else
+         {
+            wheel->currentTick++;
+
+            // Bring the next group of timers down when level 0 wraps
+            if (0U == (wheel->currentTick & SLOT_INDEX_MASK))
+            {
+               CascadeTimers(wheel);
+            }
+
+            numExpired += ExpireTimers(wheel);
+         }
+      }
+   }
+
+   return(numExpired);
+}
@@ -0,0 +1,208 @@
+/*******************************************************************************
+// Software Timer Wheel Interface
+// Services many software timers from a single call. Running timers are kept in
+// a hierarchical timing wheel so starting, stopping and restarting a timer
+// takes constant time, and each service call only visits the timers that are
+// due. Expired timers call their registered callback.
+*******************************************************************************/
+// Prevent multiple inclusion of header file
+#pragma once
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+// Platform Includes
+#include "SoftTimerLib.h" // Maximum timer duration
+#include "Timebase.h" // Defines ticks
+// Other Includes
+#include <stdbool.h>  // Defines C99 boolean type
+#include <stdint.h>  // Defines C99 integer types
+
+
+/*******************************************************************************
+// Start C Binding Section for C++ Compilers
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// Each level of the wheel decodes this many bits of the expiry tick
+#define SOFTTIMERWHEEL_SLOT_BITS (6U)
+// The number of slots in each level of the wheel
+#define SOFTTIMERWHEEL_NUM_SLOTS (1U << SOFTTIMERWHEEL_SLOT_BITS)
+// The number of levels in the wheel. Five levels of 64 slots cover 2^30 ticks,
+// which holds the longest duration allowed by SoftTimerLib.
+#define SOFTTIMERWHEEL_NUM_LEVELS (5U)
+// The longest timer duration in ticks. Longer durations are shortened to this.
+#define SOFTTIMERWHEEL_MAX_DURATION_TICKS (POWER_SOFTTIMERLIB_MAX_TICK_RANGE)
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+// Links a timer into one slot of the wheel. Each slot holds a circular list
+// with the slot itself as the list head.
+typedef struct SoftTimerWheel_Link
+{
+   struct SoftTimerWheel_Link *next;
+   struct SoftTimerWheel_Link *prev;
+} SoftTimerWheel_Link_t;
+
+// Forward declaration used by the callback type
+struct SoftTimerWheel_Timer;
+
+// Function called when a timer expires
+typedef void (*SoftTimerWheel_Callback_t)(struct SoftTimerWheel_Timer *const timer, void *const context);
+
+// Structure that represents a timer object serviced by a wheel
+typedef struct SoftTimerWheel_Timer
+{
+   // Links the timer into a wheel slot. Must be the first member.
+   SoftTimerWheel_Link_t link;
+   // The tick at which the timer expires
+   Timebase_Tick_t expiryTick;
+   // The duration used by the last start, reused by SoftTimerWheel_RestartTimer()
+   Timebase_Tick_t durationTicks;
+   // The ticks between expiries of a periodic timer, 0 for a one-shot timer
+   Timebase_Tick_t periodTicks;
+   // The function called when the timer expires
+   SoftTimerWheel_Callback_t callback;
+   // The value passed to the callback
+   void *context;
+} SoftTimerWheel_Timer_t;
+
+// Structure that holds the running timers of one wheel. Since this is a
+// library, all state is held here and each wheel is self-contained.
+typedef struct
+{
+   // Lists of running timers. Level 0 holds timers due within the next
+   // SOFTTIMERWHEEL_NUM_SLOTS ticks, one slot per tick. Each higher level
+   // covers SOFTTIMERWHEEL_NUM_SLOTS times the range of the level below and
+   // is moved down a level as the wheel turns.
+   SoftTimerWheel_Link_t slots[SOFTTIMERWHEEL_NUM_LEVELS][SOFTTIMERWHEEL_NUM_SLOTS];
+   // The last tick that has been serviced
+   Timebase_Tick_t currentTick;
+   // The number of timers currently in the wheel
+   uint16_t numRunningTimers;
+} SoftTimerWheel_t;
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/*******************************************************************************
+// Description:
+//    Initializes a wheel with no running timers. The wheel does not read the
+//    Timebase itself, so any tick source (including a simulated clock) may be
+//    used as long as the same source is passed to SoftTimerWheel_Service().
+// Parameters:
+//    wheel - A pointer to the wheel to be initialized
+//    currentTick - The current tick of the clock that drives the wheel
+*******************************************************************************/
+void SoftTimerWheel_Init(SoftTimerWheel_t *const wheel, const Timebase_Tick_t currentTick);
+
+/*******************************************************************************
+// Description:
+//    Initializes a timer as stopped and registers the function to be called
+//    when it expires.
+// Parameters:
+//    timer - A pointer to the timer to be initialized
+//    callback - The function called when the timer expires
+//    context - A value passed to the callback, may be NULL
+*******************************************************************************/
+void SoftTimerWheel_InitTimer(SoftTimerWheel_Timer_t *const timer, const SoftTimerWheel_Callback_t callback,
+                              void *const context);
+
+/*******************************************************************************
+// Description:
+//    Starts a timer, or restarts it if it is already running. The duration is
+//    counted from the last serviced tick and a duration of 0 expires on the
+//    next tick. A periodic timer is restarted by the wheel before its callback
+//    is called, so the callback may stop it.
+// Parameters:
+//    wheel - A pointer to the wheel that services the timer
+//    timer - A pointer to the timer to be started
+//    durationTicks - The ticks until the first expiry
+//    periodTicks - The ticks between later expiries, or 0 for a one-shot timer
+*******************************************************************************/
+void SoftTimerWheel_StartTimerTicks(SoftTimerWheel_t *const wheel, SoftTimerWheel_Timer_t *const timer,
+                                    const Timebase_Tick_t durationTicks, const Timebase_Tick_t periodTicks);
+
+/*******************************************************************************
+// Description:
+//    Same as SoftTimerWheel_StartTimerTicks() with the times given in
+//    milliseconds.
+// Parameters:
+//    wheel - A pointer to the wheel that services the timer
+//    timer - A pointer to the timer to be started
+//    durationMilliseconds - The time until the first expiry
+//    periodMilliseconds - The time between later expiries, or 0 for a one-shot timer
+*******************************************************************************/
+void SoftTimerWheel_StartTimer(SoftTimerWheel_t *const wheel, SoftTimerWheel_Timer_t *const timer,
+                               const uint32_t durationMilliseconds, const uint32_t periodMilliseconds);
+
+/*******************************************************************************
+// Description:
+//    Starts a timer again with the duration and period of its last start.
+//    Typically used for watchdog and debounce timeouts that are pushed back
+//    each time activity is seen.
+// Parameters:
+//    wheel - A pointer to the wheel that services the timer
+//    timer - A pointer to the timer to be restarted
+*******************************************************************************/
+void SoftTimerWheel_RestartTimer(SoftTimerWheel_t *const wheel, SoftTimerWheel_Timer_t *const timer);
+
+/*******************************************************************************
+// Description:
+//    Stops a timer so its callback will not be called. Stopping a timer that
+//    is not running has no effect.
+// Parameters:
+//    wheel - A pointer to the wheel that services the timer
+//    timer - A pointer to the timer to be stopped
+*******************************************************************************/
+void SoftTimerWheel_StopTimer(SoftTimerWheel_t *const wheel, SoftTimerWheel_Timer_t *const timer);
+
+/*******************************************************************************
+// Description:
+//    Checks to see if a given timer is running. A one-shot timer stops when
+//    it expires.
+// Parameters:
+//    timer - A pointer to the timer to be checked
+// Returns:
+//    bool - true if the timer is in a wheel
+*******************************************************************************/
+bool SoftTimerWheel_IsTimerRunning(const SoftTimerWheel_Timer_t *const timer);
+
+/*******************************************************************************
+// Description:
+//    Advances the wheel to the given tick and calls the callback of each
+//    timer that expires on the way, in order of expiry. Timers due on the
+//    same tick are called in the order they were started. Callbacks may
+//    start, stop and restart any timer in the same wheel.
+//    The wheel is not protected against interrupts, so timers must only be
+//    started and stopped from the context that services the wheel.
+// Parameters:
+//    wheel - A pointer to the wheel to be serviced
+//    currentTick - The current tick of the clock that drives the wheel
+// Returns:
+//    uint16_t - The number of callbacks called
+*******************************************************************************/
+uint16_t SoftTimerWheel_Service(SoftTimerWheel_t *const wheel, const Timebase_Tick_t currentTick);
+
+
+/*******************************************************************************
+// End of C Binding Section
+*******************************************************************************/
+#ifdef __cplusplus
+}
+#endif
+
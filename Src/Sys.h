@@ -13,6 +13,7 @@
 // Platform Includes
 #include "MessageRouter.h"
 // Other Includes
+#include <stdbool.h> // Defines C99 boolean type
 #include <stdint.h> // Defines C99 integer types
 
 
@@ -138,6 +139,62 @@ uint32_t Sys_GetClockFrequencyHz(void);
     
 uint32_t Sys_LowSpeedClockFrequencyHz(void);
 
+/*******************************************************************************
+// Description:
+//    Place the CPU in its low power idle mode. Execution resumes after the
+//    next enabled interrupt has been serviced.
+// Parameters:
+//    none
+// Returns:
+//    none
+*******************************************************************************/
+void Sys_Idle(void);
+
+/*******************************************************************************
+// Description:
+//    Install the handler for the given peripheral interrupt in the vector table.
+// Parameters:
+//    interruptNumber - The device interrupt number (Ex. INT_EPWM2)
+//    handler - The interrupt service routine to be called
+// Returns:
+//    none
+*******************************************************************************/
+void Sys_RegisterInterrupt(const uint32_t interruptNumber, void (*handler)(void));
+
+/*******************************************************************************
+// Description:
+//    Enable or disable the given peripheral interrupt at the interrupt
+//    controller.
+// Parameters:
+//    interruptNumber - The device interrupt number (Ex. INT_EPWM2)
+//    enableState - true: Enable, false: Disable
+// Returns:
+//    none
+*******************************************************************************/
+void Sys_SetInterruptEnableState(const uint32_t interruptNumber, const bool enableState);
+
+/*******************************************************************************
+// Description:
+//    Disable all maskable interrupts to protect a short critical section.
+//    Critical sections may be nested as long as each call is paired with a
+//    call to Sys_ExitCritical() in reverse order.
+// Parameters:
+//    none
+// Returns:
+//    uint16_t - The previous interrupt state to be passed to Sys_ExitCritical()
+*******************************************************************************/
+uint16_t Sys_EnterCritical(void);
+
+/*******************************************************************************
+// Description:
+//    Restore the interrupt state saved by Sys_EnterCritical().
+// Parameters:
+//    interruptState - The value returned by the matching Sys_EnterCritical()
+// Returns:
+//    none
+*******************************************************************************/
+void Sys_ExitCritical(const uint16_t interruptState);
+
 void Sys_MessageRouter_GetApplicationVersion(MessageRouter_Message_t *const message);
 void Sys_MessageRouter_GetProductID(MessageRouter_Message_t *const message);
 void Sys_MessageRouter_GetProductName(MessageRouter_Message_t *const message);
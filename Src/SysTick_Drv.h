@@ -33,7 +33,6 @@ extern "C"
 // Public Type Declarations
 *******************************************************************************/
 
-// SysTick_Drv_Tick_t type defined in configuration file
 
 // Defines the type passed during initialization that specified the SysTick configuration
 typedef struct
@@ -87,15 +86,30 @@ void SysTick_Drv_SetEnableState(bool enableState);
 
 /*******************************************************************************
 // Description:
-//    Fetches the current value of the SysTick counter.
-// Parameters: 
-//    none 
-// Returns: 
-//    SysTick_Drv_Tick_t - The current value 32-bit SysTick variable
+//    Fetches the current value of the free-running cycle counter. The counter
+//    increments once per SYSCLK cycle and wraps at 32 bits. Note that a
+//    channel must be configured as SYSTICK_DRV_CHANNEL_MODE_CYCLE_COUNTER.
+// Parameters:
+//    none
+// Returns:
+//    SysTick_Drv_CycleCount_t - The current value of the cycle counter
+*******************************************************************************/
+SysTick_Drv_CycleCount_t SysTick_Drv_GetCycleCount(void);
+
+/*******************************************************************************
+// Description:
+//    Start the one-shot wakeup timer. Its interrupt fires once after the given
+//    number of SYSCLK cycles, which brings the CPU out of idle. Starting the
+//    timer again replaces any wakeup that has not yet fired. Note that a
+//    channel must be configured as SYSTICK_DRV_CHANNEL_MODE_WAKEUP.
+// Parameters:
+//    delayCycles - Number of cycles until the interrupt
+// Returns:
+//    none
 *******************************************************************************/
-SysTick_Drv_Tick_t SysTick_Drv_GetCurrentTickCount(void);
+void SysTick_Drv_StartWakeupTimer(const SysTick_Drv_CycleCount_t delayCycles);
 
-// IRQ for CPU Timer 2 - Used for System Tick
+// IRQ for CPU Timer 2 - Used for waking the CPU
 //TODO - INTERRUPT_FUNC void SysTick_Handler(void);
 __interrupt void SysTick_Handler(void);
 
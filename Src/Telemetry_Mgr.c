@@ -0,0 +1,738 @@
+/*******************************************************************************
+// Telemetry Manager
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "Telemetry_Mgr.h"
+#include "Telemetry_Mgr_Config.h"
+// Platform Includes
+#include "MessageRouter.h"
+#include "Serial.h"
+#include "Timebase.h"
+// Other Includes
+#include <stdbool.h> // Defines C99 boolean type
+#include <stddef.h> // NULL
+#include <stdint.h> // Defines C99 integer types
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The number of bytes in the whole telemetry packet
+#define PACKET_MAX_SIZE (TELEMETRY_MGR_PACKET_HEADER_SIZE + TELEMETRY_MGR_MAX_SAMPLE_SIZE)
+
+// The number of 16-bit words in the largest sample
+#define SAMPLE_MAX_NUM_WORDS (TELEMETRY_MGR_MAX_SAMPLE_SIZE / 2U)
+
+// The bytes Serial adds around a packet in a binary frame: the response
+// header, the CRC, the COBS overhead and the delimiters
+#define PACKET_FRAMING_SIZE (9U)
+
+// The number of milliseconds in a second
+#define MS_PER_SECOND (1000UL)
+
+// The number of bits held by each byte of a varint
+#define VARINT_BITS_PER_BYTE (7U)
+
+// Set in each byte of a varint that is followed by another
+#define VARINT_CONTINUATION_BIT (0x80U)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// The state of one subscription
+typedef struct
+{
+    // The subscription as given, with the command data copied below
+    Telemetry_Mgr_Subscription_t subscription;
+
+    // The command data sent for each sample of a command source
+    uint16_t commandData[TELEMETRY_MGR_MAX_COMMAND_WORDS];
+
+    // The number of updates between samples
+    uint16_t rateDivider;
+
+    // The number of updates until the next sample
+    uint16_t updatesUntilSample;
+
+    // The message ID of the next packet
+    uint16_t sequence;
+
+    // Set if a packet was dropped since the last packet sent
+    bool hasDropped;
+
+    // Set if the host holds the last sample sent, so the next may be delta packed
+    bool isReferenceValid;
+
+    // The number of bytes in the last sample sent
+    uint16_t referenceLength;
+
+    // The last sample sent, packed low byte first
+    uint16_t reference[SAMPLE_MAX_NUM_WORDS];
+
+    // Statistics reported to the host
+    Telemetry_Mgr_Statistics_t statistics;
+} Telemetry_Mgr_SubscriptionStatus_t;
+
+// This structure defines the internal variables used by the module
+typedef struct
+{
+    // Module Id given to this module at Initialization
+    uint16_t moduleId;
+
+    // Configuration Table passed at Initialization
+    const Telemetry_Mgr_Config_t *telemetryConfig;
+
+    // Initialization state for the module
+    bool isInitialized;
+
+    // The state of each subscription
+    Telemetry_Mgr_SubscriptionStatus_t subscriptions[TELEMETRY_MGR_MAX_SUBSCRIPTIONS];
+} Telemetry_Mgr_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The variable used for holding all internal data for this module.
+static Telemetry_Mgr_Status_t status;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    Takes a sample of a subscription and sends it. Counts the packet as
+  *    published, dropped or as an error.
+*/
+static void Publish(Telemetry_Mgr_SubscriptionStatus_t *const subscriptionStatus, const uint16_t subscriptionId);
+
+/** Description:
+  *    Returns the bytes per second a subscription sends if every packet is
+  *    sent raw at the largest sample of its source.
+*/
+static uint32_t GetBytesPerSecond(const Telemetry_Mgr_Subscription_t *const subscription, const uint16_t rateDivider);
+
+/** Description:
+  *    Takes a sample of a subscription.
+  * Parameters:
+  *    sample - The buffer for the sample, packed low byte first. It must hold
+  *       SAMPLE_MAX_NUM_WORDS words.
+  *    sampleLength - Set to the number of bytes in the sample
+  * Returns:
+  *    bool - false if the command of a command source failed
+*/
+static bool TakeSample(const Telemetry_Mgr_SubscriptionStatus_t *const subscriptionStatus,
+                       uint16_t *const sample, uint16_t *const sampleLength);
+
+/** Description:
+  *    Writes the differences between each word of a sample and the reference
+  *    as zigzag encoded varints.
+  * Parameters:
+  *    packet - The packet the varints are added to, packed low byte first
+  *    packetLength - The number of bytes already in the packet. Updated.
+  *    maxPacketLength - The packet length that must not be reached for the
+  *       packed sample to be used
+  * Returns:
+  *    bool - false if the packed sample would not be shorter than the raw one
+*/
+static bool PackDelta(const Telemetry_Mgr_SubscriptionStatus_t *const subscriptionStatus,
+                      const uint16_t *const sample, const uint16_t sampleLength,
+                      uint16_t *const packet, uint16_t *const packetLength, const uint16_t maxPacketLength);
+
+/** Description:
+  *    Adds a byte to a packet packed low byte first.
+*/
+static void PutByte(uint16_t *const packet, uint16_t *const packetLength, const uint16_t byte);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+static void Publish(Telemetry_Mgr_SubscriptionStatus_t *const subscriptionStatus, const uint16_t subscriptionId)
+{
+   uint16_t sample[SAMPLE_MAX_NUM_WORDS];
+   uint16_t sampleLength = 0U;
+
+   if (!TakeSample(subscriptionStatus, sample, &sampleLength))
+   {
+      subscriptionStatus->statistics.numErrors++;
+      // The host does not know what was missed, so the next sample is sent raw
+      subscriptionStatus->isReferenceValid = false;
+   }
+   else
+   {
+      const uint32_t timestampMs = Timebase_TicksToMilliseconds(Timebase_GetCurrentTickCount());
+      uint16_t packet[(PACKET_MAX_SIZE + 1U) / 2U];
+      uint16_t packetLength = 0U;
+      uint16_t flags = subscriptionStatus->hasDropped ? TELEMETRY_MGR_PACKET_FLAG_DROPPED : 0U;
+      bool isDelta = false;
+
+      // The flags are written once the packing is known
+      PutByte(packet, &packetLength, subscriptionId);
+      PutByte(packet, &packetLength, 0U);
+      PutByte(packet, &packetLength, (uint16_t)(timestampMs & 0xFFU));
+      PutByte(packet, &packetLength, (uint16_t)((timestampMs >> 8U) & 0xFFU));
+      PutByte(packet, &packetLength, (uint16_t)((timestampMs >> 16U) & 0xFFU));
+      PutByte(packet, &packetLength, (uint16_t)((timestampMs >> 24U) & 0xFFU));
+
+      // A delta only has meaning against a reference of the same length
+      if ((TELEMETRY_MGR_PACKING_DELTA == subscriptionStatus->subscription.packing) &&
+          subscriptionStatus->isReferenceValid && (sampleLength == subscriptionStatus->referenceLength))
+      {
+         isDelta = PackDelta(subscriptionStatus, sample, sampleLength, packet, &packetLength,
+                             (uint16_t)(TELEMETRY_MGR_PACKET_HEADER_SIZE + sampleLength));
+      }
+
+      if (isDelta)
+      {
+         flags |= TELEMETRY_MGR_PACKET_FLAG_DELTA;
+      }
+      else
+      {
+         // Start again after the header in case a delta was abandoned
+         packetLength = TELEMETRY_MGR_PACKET_HEADER_SIZE;
+         for (uint16_t i = 0U; i < sampleLength; i++)
+         {
+            PutByte(packet, &packetLength, (uint16_t)((sample[i >> 1U] >> ((i & 1U) * 8U)) & 0xFFU));
+         }
+      }
+
+      // Byte 1 of the packet
+      packet[0] = (packet[0] & 0x00FFU) | (flags << 8U);
+
+      MessageRouter_Message_t message;
+      message.header.moduleID = status.moduleId;
+      message.header.commandID = TELEMETRY_MGR_PACKET_COMMAND_ID;
+      message.header.messageID = subscriptionStatus->sequence;
+      message.commandParams.maxLength = 0U;
+      message.commandParams.length = 0U;
+      message.commandParams.data = NULL;
+      message.responseParams.maxLength = (uint16_t)PACKET_MAX_SIZE;
+      message.responseParams.length = packetLength;
+      message.responseParams.data = packet;
+      message.responseCode = POWER_MESSAGEROUTER_RESPONSE_CODE_None;
+
+      if (Serial_SendMessage(status.telemetryConfig->channel, &message))
+      {
+         subscriptionStatus->statistics.numPublished++;
+         subscriptionStatus->sequence++;
+         subscriptionStatus->hasDropped = false;
+
+         // The host now holds this sample
+         for (uint16_t i = 0U; i < ((sampleLength + 1U) / 2U); i++)
+         {
+            subscriptionStatus->reference[i] = sample[i];
+         }
+         subscriptionStatus->referenceLength = sampleLength;
+         subscriptionStatus->isReferenceValid = true;
+      }
+      else
+      {
+         // The host missed this sample, so the next is sent raw. The sequence
+         // is kept so the host sees a continuous count of the packets it gets.
+         subscriptionStatus->statistics.numDropped++;
+         subscriptionStatus->hasDropped = true;
+         subscriptionStatus->isReferenceValid = false;
+      }
+   }
+}
+
+static uint32_t GetBytesPerSecond(const Telemetry_Mgr_Subscription_t *const subscription, const uint16_t rateDivider)
+{
+   // The response of a command may be any length, so it is counted at the largest
+   const uint32_t sampleSize = (TELEMETRY_MGR_SOURCE_MEMORY == subscription->source) ?
+                               (2UL * subscription->numWords) : (uint32_t)TELEMETRY_MGR_MAX_SAMPLE_SIZE;
+   const uint32_t frameSize = PACKET_FRAMING_SIZE + TELEMETRY_MGR_PACKET_HEADER_SIZE + sampleSize;
+   const uint32_t periodMs = (uint32_t)rateDivider * status.telemetryConfig->updatePeriodMs;
+
+   // Rounded up so a rate just over the limit is not let through
+   return(((frameSize * MS_PER_SECOND) + periodMs - 1UL) / periodMs);
+}
+
+static bool TakeSample(const Telemetry_Mgr_SubscriptionStatus_t *const subscriptionStatus,
+                       uint16_t *const sample, uint16_t *const sampleLength)
+{
+   const Telemetry_Mgr_Subscription_t *const subscription = &subscriptionStatus->subscription;
+   bool isSuccessful = true;
+
+   if (TELEMETRY_MGR_SOURCE_COMMAND == subscription->source)
+   {
+      // The command data is given a copy so the handler cannot change it
+      uint16_t commandData[TELEMETRY_MGR_MAX_COMMAND_WORDS];
+      MessageRouter_Message_t message;
+
+      for (uint16_t i = 0U; i < TELEMETRY_MGR_MAX_COMMAND_WORDS; i++)
+      {
+         commandData[i] = subscriptionStatus->commandData[i];
+      }
+
+      message.header.moduleID = subscription->moduleID;
+      message.header.commandID = subscription->commandID;
+      message.header.messageID = 0U;
+      message.commandParams.maxLength = (uint16_t)(2U * TELEMETRY_MGR_MAX_COMMAND_WORDS);
+      message.commandParams.length = subscription->commandLength;
+      message.commandParams.data = commandData;
+      message.responseParams.maxLength = (uint16_t)TELEMETRY_MGR_MAX_SAMPLE_SIZE;
+      message.responseParams.length = 0U;
+      message.responseParams.data = sample;
+      message.responseCode = POWER_MESSAGEROUTER_RESPONSE_CODE_None;
+
+      MessageRouter_ProcessMessage(&message);
+
+      isSuccessful = (POWER_MESSAGEROUTER_RESPONSE_CODE_None == message.responseCode) &&
+                     (message.responseParams.length <= (uint16_t)TELEMETRY_MGR_MAX_SAMPLE_SIZE);
+      *sampleLength = message.responseParams.length;
+
+      // Clear the unused high byte so an odd length sample packs consistently
+      if (isSuccessful && (0U != (*sampleLength & 1U)))
+      {
+         sample[*sampleLength >> 1U] &= 0x00FFU;
+      }
+   }
+   else
+   {
+      const volatile uint16_t *const memory = (const volatile uint16_t *)(uintptr_t)subscription->address;
+
+      for (uint16_t i = 0U; i < subscription->numWords; i++)
+      {
+         sample[i] = memory[i];
+      }
+      *sampleLength = (uint16_t)(2U * subscription->numWords);
+   }
+
+   return(isSuccessful);
+}
+
+static bool PackDelta(const Telemetry_Mgr_SubscriptionStatus_t *const subscriptionStatus,
+                      const uint16_t *const sample, const uint16_t sampleLength,
+                      uint16_t *const packet, uint16_t *const packetLength, const uint16_t maxPacketLength)
+{
+   bool isShorter = true;
+
+   // An odd length sample has a final word with a cleared high byte
+   for (uint16_t i = 0U; (i < ((sampleLength + 1U) / 2U)) && isShorter; i++)
+   {
+      const int16_t delta = (int16_t)(sample[i] - subscriptionStatus->reference[i]);
+      // Small changes either way give small values: 0, -1, 1, -2 ... become 0, 1, 2, 3 ...
+      uint16_t zigzag = (uint16_t)((uint16_t)delta << 1U) ^ ((delta < 0) ? 0xFFFFU : 0x0000U);
+
+      while ((zigzag >= VARINT_CONTINUATION_BIT) && isShorter)
+      {
+         PutByte(packet, packetLength, (zigzag & (VARINT_CONTINUATION_BIT - 1U)) | VARINT_CONTINUATION_BIT);
+         zigzag >>= VARINT_BITS_PER_BYTE;
+         isShorter = (*packetLength < maxPacketLength);
+      }
+
+      if (isShorter)
+      {
+         PutByte(packet, packetLength, zigzag);
+         isShorter = (*packetLength < maxPacketLength);
+      }
+   }
+
+   return(isShorter);
+}
+
+static void PutByte(uint16_t *const packet, uint16_t *const packetLength, const uint16_t byte)
+{
+   const uint16_t index = *packetLength >> 1U;
+
+   if (0U == (*packetLength & 1U))
+   {
+      packet[index] = byte & 0xFFU;
+   }
+   else
+   {
+      packet[index] |= (byte & 0xFFU) << 8U;
+   }
+
+   (*packetLength)++;
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Module initialization
+bool Telemetry_Mgr_Init(const uint32_t moduleId, const Telemetry_Mgr_Config_t *configPtr)
+{
+   // Default module to uninitialized
+   status.isInitialized = false;
+   // Store the module Id, which is also the module ID of every packet
+   status.moduleId = (uint16_t)moduleId;
+
+   // First, validate the given parameter is valid
+   if ((NULL != configPtr) && (configPtr->updatePeriodMs > 0U))
+   {
+      // Store the given configuration table
+      status.telemetryConfig = configPtr;
+
+      //-----------------------------------------------
+      // Local Variable Initialization
+      //-----------------------------------------------
+      for (uint16_t i = 0U; i < TELEMETRY_MGR_MAX_SUBSCRIPTIONS; i++)
+      {
+         status.subscriptions[i].statistics.numPublished = 0UL;
+         status.subscriptions[i].statistics.numDropped = 0UL;
+         status.subscriptions[i].statistics.numErrors = 0U;
+         status.subscriptions[i].statistics.isActive = false;
+      }
+
+      // Set to initialized
+      status.isInitialized = true;
+   }
+
+   // Return initialization state
+   return(status.isInitialized);
+}
+
+// Scheduled function for sending the samples that are due
+void Telemetry_Mgr_Update(void)
+{
+   if (status.isInitialized)
+   {
+      for (uint16_t i = 0U; i < TELEMETRY_MGR_MAX_SUBSCRIPTIONS; i++)
+      {
+         Telemetry_Mgr_SubscriptionStatus_t *const subscriptionStatus = &status.subscriptions[i];
+
+         if (subscriptionStatus->statistics.isActive)
+         {
+            subscriptionStatus->updatesUntilSample--;
+            if (0U == subscriptionStatus->updatesUntilSample)
+            {
+               subscriptionStatus->updatesUntilSample = subscriptionStatus->rateDivider;
+               Publish(subscriptionStatus, i);
+            }
+         }
+      }
+   }
+}
+
+// Start a subscription
+bool Telemetry_Mgr_Subscribe(const uint16_t subscriptionId, const Telemetry_Mgr_Subscription_t *const subscription)
+{
+   bool isValid = status.isInitialized && (subscriptionId < TELEMETRY_MGR_MAX_SUBSCRIPTIONS) &&
+                  (NULL != subscription) && (subscription->packing < TELEMETRY_MGR_PACKING_COUNT) &&
+                  (subscription->periodMs > 0UL);
+
+   if (isValid)
+   {
+      if (TELEMETRY_MGR_SOURCE_COMMAND == subscription->source)
+      {
+         isValid = (subscription->commandLength <= (uint16_t)(2U * TELEMETRY_MGR_MAX_COMMAND_WORDS)) &&
+                   ((0U == subscription->commandLength) || (NULL != subscription->commandData));
+      }
+      else
+      {
+         isValid = (TELEMETRY_MGR_SOURCE_MEMORY == subscription->source) &&
+                   (subscription->numWords > 0U) && (subscription->numWords <= (uint16_t)SAMPLE_MAX_NUM_WORDS);
+      }
+   }
+
+   uint16_t rateDivider = 1U;
+
+   if (isValid)
+   {
+      const uint32_t numUpdates = subscription->periodMs / status.telemetryConfig->updatePeriodMs;
+      uint32_t bytesPerSecond = 0UL;
+
+      if (numUpdates > 0xFFFFUL)
+      {
+         rateDivider = 0xFFFFU;
+      }
+      else if (numUpdates > 0UL)
+      {
+         rateDivider = (uint16_t)numUpdates;
+      }
+
+      // Serial keeps room for a command response in the transmit buffer, but
+      // a port given more packets than its rate can carry still drops them
+      // and delays the responses. The subscription being replaced no longer
+      // counts.
+      for (uint16_t i = 0U; i < TELEMETRY_MGR_MAX_SUBSCRIPTIONS; i++)
+      {
+         const Telemetry_Mgr_SubscriptionStatus_t *const otherStatus = &status.subscriptions[i];
+
+         if ((i != subscriptionId) && otherStatus->statistics.isActive)
+         {
+            bytesPerSecond += GetBytesPerSecond(&otherStatus->subscription, otherStatus->rateDivider);
+         }
+      }
+      bytesPerSecond += GetBytesPerSecond(subscription, rateDivider);
+
+      isValid = (bytesPerSecond <= status.telemetryConfig->maxBytesPerSecond);
+   }
+
+   if (isValid)
+   {
+      Telemetry_Mgr_SubscriptionStatus_t *const subscriptionStatus = &status.subscriptions[subscriptionId];
+
+      // Stop the subscription while it is changed
+      subscriptionStatus->statistics.isActive = false;
+
+      subscriptionStatus->subscription = *subscription;
+      for (uint16_t i = 0U; i < TELEMETRY_MGR_MAX_COMMAND_WORDS; i++)
+      {
+         subscriptionStatus->commandData[i] =
+            (i < ((subscription->commandLength + 1U) / 2U)) ? subscription->commandData[i] : 0U;
+      }
+      subscriptionStatus->subscription.commandData = subscriptionStatus->commandData;
+      subscriptionStatus->rateDivider = rateDivider;
+      subscriptionStatus->updatesUntilSample = 1U;
+      subscriptionStatus->sequence = 0U;
+      subscriptionStatus->hasDropped = false;
+      subscriptionStatus->isReferenceValid = false;
+      subscriptionStatus->referenceLength = 0U;
+      subscriptionStatus->statistics.numPublished = 0UL;
+      subscriptionStatus->statistics.numDropped = 0UL;
+      subscriptionStatus->statistics.numErrors = 0U;
+      subscriptionStatus->statistics.isActive = true;
+   }
+
+   return(isValid);
+}
+
+// Stop a subscription
+bool Telemetry_Mgr_Unsubscribe(const uint16_t subscriptionId)
+{
+   bool isValid = false;
+
+   if (status.isInitialized)
+   {
+      for (uint16_t i = 0U; i < TELEMETRY_MGR_MAX_SUBSCRIPTIONS; i++)
+      {
+         if ((TELEMETRY_MGR_ALL_SUBSCRIPTIONS == subscriptionId) || (i == subscriptionId))
+         {
+            status.subscriptions[i].statistics.isActive = false;
+            isValid = true;
+         }
+      }
+   }
+
+   return(isValid);
+}
+
+// Return the statistics of a subscription
+bool Telemetry_Mgr_GetStatistics(const uint16_t subscriptionId, Telemetry_Mgr_Statistics_t *const statistics)
+{
+   bool isValid = false;
+
+   statistics->numPublished = 0UL;
+   statistics->numDropped = 0UL;
+   statistics->numErrors = 0U;
+   statistics->isActive = false;
+
+   if (status.isInitialized)
+   {
+      for (uint16_t i = 0U; i < TELEMETRY_MGR_MAX_SUBSCRIPTIONS; i++)
+      {
+         if ((TELEMETRY_MGR_ALL_SUBSCRIPTIONS == subscriptionId) || (i == subscriptionId))
+         {
+            const Telemetry_Mgr_Statistics_t *const subscriptionStatistics = &status.subscriptions[i].statistics;
+
+            statistics->numPublished += subscriptionStatistics->numPublished;
+            statistics->numDropped += subscriptionStatistics->numDropped;
+            statistics->numErrors += subscriptionStatistics->numErrors;
+            statistics->isActive = statistics->isActive || subscriptionStatistics->isActive;
+            isValid = true;
+         }
+      }
+   }
+
+   return(isValid);
+}
+
+
+/*******************************************************************************
+// Message Router Function Implementations
+*******************************************************************************/
+
+// Start a subscription
+void Telemetry_Mgr_MessageRouter_Subscribe(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+   // This structure defines the format of the command data.
+   typedef struct
+   {
+      // The interval between samples in milliseconds
+      uint32_t periodMs;
+      // The first word read for a memory source
+      uint32_t address;
+      // The subscription to be started
+      uint16_t subscriptionId;
+      // Telemetry_Mgr_Source_t
+      uint16_t source;
+      // Telemetry_Mgr_Packing_t
+      uint16_t packing;
+      // The number of words read for a memory source
+      uint16_t numWords;
+      // The command sent for a command source
+      uint16_t moduleID;
+      uint16_t commandID;
+      // The number of bytes of commandData used
+      uint16_t commandLength;
+      uint16_t commandData[TELEMETRY_MGR_MAX_COMMAND_WORDS];
+      // Keeps the size a whole number of 32-bit values
+      uint16_t dummy;
+   } Command_t;
+
+   // This structure defines the format of the response.
+   typedef struct
+   {
+      // 1 if the subscription was started
+      uint16_t isSuccessful;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      Telemetry_Mgr_Subscription_t subscription;
+
+      subscription.source = (Telemetry_Mgr_Source_t)command->source;
+      subscription.packing = (Telemetry_Mgr_Packing_t)command->packing;
+      subscription.periodMs = command->periodMs;
+      subscription.moduleID = command->moduleID;
+      subscription.commandID = command->commandID;
+      subscription.commandLength = command->commandLength;
+      subscription.commandData = command->commandData;
+      subscription.address = command->address;
+      subscription.numWords = command->numWords;
+
+      response->isSuccessful = Telemetry_Mgr_Subscribe(command->subscriptionId, &subscription) ? 1U : 0U;
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Stop a subscription
+void Telemetry_Mgr_MessageRouter_Unsubscribe(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+   // This structure defines the format of the command data.
+   typedef struct
+   {
+      // The subscription to be stopped, or 0xFFFF for all of them
+      uint16_t subscriptionId;
+   } Command_t;
+
+   // This structure defines the format of the response.
+   typedef struct
+   {
+      // 1 if the subscription ID is valid
+      uint16_t isSuccessful;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      response->isSuccessful = Telemetry_Mgr_Unsubscribe(command->subscriptionId) ? 1U : 0U;
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Get the statistics of a subscription
+void Telemetry_Mgr_MessageRouter_GetStatistics(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+   // This structure defines the format of the command data.
+   typedef struct
+   {
+      // The subscription to be queried, or 0xFFFF for the totals
+      uint16_t subscriptionId;
+   } Command_t;
+
+   // This structure defines the format of the response.
+   typedef struct
+   {
+      // The number of packets queued for transmit
+      uint32_t numPublished;
+      // The number of packets dropped because the port was busy
+      uint32_t numDropped;
+      // The number of samples whose command failed
+      uint16_t numErrors;
+      // 1 if the subscription is active
+      uint16_t isActive;
+      // 1 if the subscription ID is valid
+      uint16_t isSuccessful;
+      // Keeps the size a whole number of 32-bit values
+      uint16_t dummy;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      Telemetry_Mgr_Statistics_t statistics;
+
+      response->isSuccessful = Telemetry_Mgr_GetStatistics(command->subscriptionId, &statistics) ? 1U : 0U;
+      response->numPublished = statistics.numPublished;
+      response->numDropped = statistics.numDropped;
+      response->numErrors = statistics.numErrors;
+      response->isActive = statistics.isActive ? 1U : 0U;
+      response->dummy = 0U;
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
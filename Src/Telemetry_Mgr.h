@@ -0,0 +1,202 @@
+/*******************************************************************************
+// Telemetry Manager
+// Streams timestamped samples to the host without a command for each one. The
+// host subscribes to a Message Router read command or a block of memory at a
+// rate, and each sample is sent through Serial as a telemetry packet.
+//
+// A telemetry packet is framed the same as a response, with the module ID of
+// this module and TELEMETRY_MGR_PACKET_COMMAND_ID. The message ID counts the
+// packets of the subscription. The data holds:
+//    Byte 0: Subscription ID
+//    Byte 1: Flags (TELEMETRY_MGR_PACKET_FLAG_*)
+//    Bytes 2-5: Timestamp in milliseconds, low byte first
+//    Bytes 6+: The sample, raw or delta packed
+// A delta packed sample holds one varint per 16-bit word of the sample: the
+// difference from the same word of the previous packet, zigzag encoded, seven
+// bits per byte with the high bit set on all but the last byte. A raw sample
+// is sent first, after any dropped packet and whenever packing would not make
+// the sample smaller, so the host always has the reference for the next delta.
+*******************************************************************************/
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Telemetry_Mgr_Config.h" // Defines the number of subscriptions
+// Platform Includes
+#include "MessageRouter.h"
+#include "UART_Drv.h"
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The command ID used in the header of every telemetry packet
+#define TELEMETRY_MGR_PACKET_COMMAND_ID (0x80U)
+
+// The number of bytes in a telemetry packet before the sample
+#define TELEMETRY_MGR_PACKET_HEADER_SIZE (6U)
+
+// The largest sample in bytes, so a packet fits in one Serial response
+#define TELEMETRY_MGR_MAX_SAMPLE_SIZE (48U - TELEMETRY_MGR_PACKET_HEADER_SIZE)
+
+// Set in the flags of a packet holding a delta packed sample
+#define TELEMETRY_MGR_PACKET_FLAG_DELTA (0x01U)
+
+// Set in the flags of the first packet after one or more were dropped
+#define TELEMETRY_MGR_PACKET_FLAG_DROPPED (0x02U)
+
+// Passed as the subscription ID to act on every subscription
+#define TELEMETRY_MGR_ALL_SUBSCRIPTIONS (0xFFFFU)
+
+
+/*******************************************************************************
+// Public Types
+*******************************************************************************/
+
+// Common configuration structure passed to the module initialization function
+// Data is generally defined in the board-specific configuration file
+typedef struct
+{
+    // The port the packets are sent on
+    UART_Drv_Channel_t channel;
+    // The interval at which Telemetry_Mgr_Update() is scheduled
+    uint16_t updatePeriodMs;
+    // The most bytes per second the active subscriptions may send together,
+    // counting each packet at its largest binary frame. It must leave enough
+    // of the port rate for the command responses.
+    uint32_t maxBytesPerSecond;
+} Telemetry_Mgr_Config_t;
+
+// Where the samples of a subscription come from
+typedef enum
+{
+    // The response of a Message Router command
+    TELEMETRY_MGR_SOURCE_COMMAND,
+    // A block of memory
+    TELEMETRY_MGR_SOURCE_MEMORY,
+    TELEMETRY_MGR_SOURCE_COUNT
+} Telemetry_Mgr_Source_t;
+
+// How the samples of a subscription are sent
+typedef enum
+{
+    // Every sample is sent as it is
+    TELEMETRY_MGR_PACKING_RAW,
+    // Samples are sent as varint differences from the previous sample
+    TELEMETRY_MGR_PACKING_DELTA,
+    TELEMETRY_MGR_PACKING_COUNT
+} Telemetry_Mgr_Packing_t;
+
+// Describes a subscription
+typedef struct
+{
+    // Where the samples come from
+    Telemetry_Mgr_Source_t source;
+    // How the samples are sent
+    Telemetry_Mgr_Packing_t packing;
+    // The interval between samples, rounded down to a whole number of
+    // update periods with a minimum of one
+    uint32_t periodMs;
+    // The command sent for each sample of a command source
+    uint16_t moduleID;
+    uint16_t commandID;
+    // The number of bytes of command data (Max 2 * TELEMETRY_MGR_MAX_COMMAND_WORDS)
+    uint16_t commandLength;
+    const uint16_t *commandData;
+    // The first word read for each sample of a memory source
+    uint32_t address;
+    // The number of words read for each sample of a memory source
+    uint16_t numWords;
+} Telemetry_Mgr_Subscription_t;
+
+// The statistics of a subscription
+typedef struct
+{
+    // The number of packets queued for transmit
+    uint32_t numPublished;
+    // The number of packets dropped because the port could not take them
+    uint32_t numDropped;
+    // The number of samples that could not be taken because the command failed
+    uint16_t numErrors;
+    // Set while the subscription is active
+    bool isActive;
+} Telemetry_Mgr_Statistics_t;
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function defines the module initialization. No subscription is
+  *    active afterwards.
+*/
+bool Telemetry_Mgr_Init(const uint32_t moduleId, const Telemetry_Mgr_Config_t *configPtr);
+
+
+/** Description:
+  *    The periodic function called by the scheduler. Takes a sample of each
+  *    subscription that is due and sends it. A packet that does not fit in
+  *    the transmit buffer is dropped and counted, and the next packet of the
+  *    subscription is sent raw.
+*/
+void Telemetry_Mgr_Update(void);
+
+
+/** Description:
+  *    Starts a subscription, replacing any subscription with the same ID. The
+  *    first sample is taken on the next update. A subscription is refused if
+  *    its largest packets at its rate, added to those of the other active
+  *    subscriptions, would exceed maxBytesPerSecond.
+  * Parameters:
+  *    subscriptionId - The subscription (Max TELEMETRY_MGR_MAX_SUBSCRIPTIONS - 1)
+  *    subscription - Describes the samples
+  * Returns:
+  *    bool - false if the subscription is not valid and was not started
+*/
+bool Telemetry_Mgr_Subscribe(const uint16_t subscriptionId, const Telemetry_Mgr_Subscription_t *const subscription);
+
+
+/** Description:
+  *    Stops a subscription. Its statistics are kept until it is started again.
+  * Parameters:
+  *    subscriptionId - The subscription, or TELEMETRY_MGR_ALL_SUBSCRIPTIONS
+  * Returns:
+  *    bool - false if the subscription ID is not valid
+*/
+bool Telemetry_Mgr_Unsubscribe(const uint16_t subscriptionId);
+
+
+/** Description:
+  *    Returns the statistics of a subscription.
+  * Parameters:
+  *    subscriptionId - The subscription, or TELEMETRY_MGR_ALL_SUBSCRIPTIONS
+  *       for the totals of all subscriptions
+  *    statistics - Filled with the statistics
+  * Returns:
+  *    bool - false if the subscription ID is not valid
+*/
+bool Telemetry_Mgr_GetStatistics(const uint16_t subscriptionId, Telemetry_Mgr_Statistics_t *const statistics);
+
+void Telemetry_Mgr_MessageRouter_Subscribe(MessageRouter_Message_t *const message);
+void Telemetry_Mgr_MessageRouter_Unsubscribe(MessageRouter_Message_t *const message);
+void Telemetry_Mgr_MessageRouter_GetStatistics(MessageRouter_Message_t *const message);
+
+
+#ifdef __cplusplus
+}
+#endif
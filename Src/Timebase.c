@@ -8,27 +8,41 @@
 // Module Includes
 #include "Timebase.h" // Module header
 // Platform Includes
-#include "SysTick_Drv.h" // SysTick counter value
+#include "SysTick_Drv.h" // Free-running cycle counter and wakeup timer
+#include "Sys.h" // Critical sections
 // Other Includes
+#include <stdint.h> // Defines C99 integer types
 
 
 /*******************************************************************************
 // Private Constant Definitions
 *******************************************************************************/
 
-extern uint32_t Timer_Freq;
-
-#define TIMER_TICK2MS( _x )		((_x) / (Timer_Freq/1000000uL))
-#define TIMER_TICK2NS( _x )     (((_x)*1000) / (Timer_Freq/1000000uL))
-#define TIMER_MS2TICK( _x )     ((uint32_t)(((uint32_t)Timer_Freq * (_x) )/UINT32_C(1000)))
-#define TIMER_S2MS( _x )        ((_x) * 1000UL)
+// Only tick rates that are a whole number of ticks per millisecond and a whole
+// number of microseconds per tick are supported
+#if (TIMEBASE_NUM_TICKS_PER_SECOND != 1000) && (TIMEBASE_NUM_TICKS_PER_SECOND != 10000) && (TIMEBASE_NUM_TICKS_PER_SECOND != 100000)
+#error "TIMEBASE_NUM_TICKS_PER_SECOND must be 1000, 10000 or 100000"
+#endif
 
 // Define conversion factor for calculating period
 #define MICROSECONDS_PER_SECOND (UINT32_C(1000000))
 
-// Configure system to use 1000 ticks per second (each tick = 1ms)
-#define SYSTICK_DRV_NUM_TICKS_PER_SECOND (UINT32_C(1000))
-#define TIMEBASE_NUM_TICKS_PER_MILLISECOND (SYSTICK_DRV_NUM_TICKS_PER_SECOND/UINT32_C(1000))
+// The cycle counter runs at the system clock frequency
+#define NUM_CYCLES_PER_MICROSECOND ((uint32_t)SYS_SYSCLK_FREQ/MICROSECONDS_PER_SECOND)
+
+// Reciprocal of a constant divisor scaled by 2^32, evaluated by the compiler.
+// See DivideByConstant().
+#define RECIPROCAL(divisor) ((uint32_t)(UINT64_C(0x100000000) / (uint64_t)(divisor)))
+
+// Number of calls timed for each conversion by the benchmark command
+#define BENCHMARK_ITERATIONS (64U)
+
+// Step between the inputs given to each conversion by the benchmark command
+#define BENCHMARK_INPUT_STEP (UINT32_C(0x01000193))
+
+// Longest wakeup delay. This is half of the 32-bit cycle counter period so the
+// CPU always wakes in time to extend the counter before it wraps twice.
+#define MAX_WAKEUP_CYCLES (UINT32_C(0x80000000))
 
 // 200MHz SYSCLK frequency computed based on the above SYS_SETCLOCK_CFG
 //#define SYS_SYSCLK_FREQ          ((SYS_OSCSRC_FREQ * PLL_INTEGER_MULTIPLIER * PLL_FRACTIONAL_MULTIPLIER) / PLL_SYSCLK_DIVIDER)
@@ -41,23 +55,203 @@ typedef uint32_t TimerTick;
 // Private Type Declarations
 *******************************************************************************/
 
+// This structure defines the internal variables used by the module
+typedef struct
+{
+   // The 32-bit cycle count at the previous update
+   Timebase_CycleCount_t lastCycleCount;
+
+   // The upper 32 bits of the 64-bit timestamp, incremented each time the
+   // hardware counter wraps
+   uint32_t cycleCountWraps;
+
+   // The current tick count
+   Timebase_Tick_t tickCount;
+
+   // The 32-bit cycle count at which the current tick started
+   Timebase_CycleCount_t tickStartCycles;
+
+   // The number of whole microseconds since initialization
+   uint64_t microsecondCount;
+
+   // The 32-bit cycle count at which the current microsecond started
+   Timebase_CycleCount_t microsecondStartCycles;
+} Timebase_Status_t;
+
 
 /*******************************************************************************
 // Private Variable Definitions
 *******************************************************************************/
 
-// Note: The system tick variable is defined in the SysTick driver
+// The variable used for holding all internal data for this module.
+static Timebase_Status_t status;
+
+// Results of the benchmark conversions are stored here so they are not
+// optimized away
+static volatile uint32_t benchmarkResult;
+
+// Divisor read at runtime so the benchmark can time a library division
+static volatile uint32_t benchmarkDivisor = NUM_CYCLES_PER_MICROSECOND;
 
 
 /*******************************************************************************
 // Private Function Declarations
 *******************************************************************************/
 
+/*******************************************************************************
+// Description:
+//    Read the hardware cycle counter and bring the 64-bit timestamp and the
+//    tick count up to date. Note that this must be called at least once per
+//    period of the 32-bit cycle counter (about 21 seconds at 200MHz) for the
+//    wraps to be counted. The scheduler loop and the wakeup limit ensure this.
+// Parameters:
+//    none
+// Returns:
+//    Timebase_Timestamp_t - The current 64-bit cycle count
+*******************************************************************************/
+static Timebase_Timestamp_t UpdateTimestamp(void);
+
+/*******************************************************************************
+// Description:
+//    Divide by a constant without a runtime division. The dividend is
+//    multiplied by the scaled reciprocal, which gives a quotient that is
+//    either exact or one too small, and a single compare corrects it.
+//    The divisor and reciprocal are expected to be compile-time constants so
+//    the special case for a divisor of 1 is removed by the compiler.
+// Parameters:
+//    dividend - The value to be divided
+//    divisor - The constant divisor
+//    reciprocal - RECIPROCAL(divisor)
+// Returns:
+//    uint32_t - dividend / divisor, rounded down
+*******************************************************************************/
+static inline uint32_t DivideByConstant(const uint32_t dividend, const uint32_t divisor, const uint32_t reciprocal);
+
+/*******************************************************************************
+// Description:
+//    Time a single conversion call with interrupts disabled. The fastest of
+//    BENCHMARK_ITERATIONS calls with different inputs is kept.
+// Parameters:
+//    conversion - The conversion to be timed
+// Returns:
+//    uint32_t - The fewest cycles taken by one call, including the call and
+//    measurement overhead
+*******************************************************************************/
+static uint32_t MeasureConversionCycles(uint32_t (*const conversion)(const uint32_t));
+
+// Conversions timed by the benchmark command that are not public functions
+static uint32_t BenchmarkIdentity(const uint32_t value);
+static uint32_t BenchmarkRuntimeDivision(const uint32_t value);
+static uint32_t BenchmarkTimestampUs(const uint32_t value);
+
 
 /*******************************************************************************
 // Private Function Implementations
 *******************************************************************************/
 
+// Extend the hardware counter to 64 bits and advance the tick count
+static Timebase_Timestamp_t UpdateTimestamp(void)
+{
+   // The timestamp may be read from interrupts, so the update must not be interrupted
+   const uint16_t interruptState = Sys_EnterCritical();
+   const Timebase_CycleCount_t cycleCount = (Timebase_CycleCount_t)SysTick_Drv_GetCycleCount();
+   const Timebase_CycleCount_t cyclesSinceTickStart = cycleCount - status.tickStartCycles;
+   Timebase_Timestamp_t timestamp;
+
+   // The counter only counts up, so a smaller value means it has wrapped
+   if (cycleCount < status.lastCycleCount)
+   {
+      status.cycleCountWraps++;
+   }
+   status.lastCycleCount = cycleCount;
+
+   // Advance by the whole ticks and microseconds that have passed. The
+   // remaining cycles are carried into the next update.
+   if (cyclesSinceTickStart >= (uint32_t)TIMEBASE_NUM_CYCLES_PER_TICK)
+   {
+      const uint32_t elapsedTicks = DivideByConstant(cyclesSinceTickStart, TIMEBASE_NUM_CYCLES_PER_TICK,
+                                                     RECIPROCAL(TIMEBASE_NUM_CYCLES_PER_TICK));
+
+      status.tickCount += elapsedTicks;
+      status.tickStartCycles += elapsedTicks * (uint32_t)TIMEBASE_NUM_CYCLES_PER_TICK;
+   }
+   {
+      const uint32_t elapsedMicroseconds = DivideByConstant(cycleCount - status.microsecondStartCycles, NUM_CYCLES_PER_MICROSECOND,
+                                                            RECIPROCAL(NUM_CYCLES_PER_MICROSECOND));
+
+      status.microsecondCount += elapsedMicroseconds;
+      status.microsecondStartCycles += elapsedMicroseconds * NUM_CYCLES_PER_MICROSECOND;
+   }
+
+   timestamp = ((Timebase_Timestamp_t)status.cycleCountWraps << 32U) | cycleCount;
+   Sys_ExitCritical(interruptState);
+
+   return(timestamp);
+}
+
+// Divide using a multiply by the reciprocal
+static inline uint32_t DivideByConstant(const uint32_t dividend, const uint32_t divisor, const uint32_t reciprocal)
+{
+   uint32_t quotient = dividend;
+
+   if (1U != divisor)
+   {
+      quotient = (uint32_t)(((uint64_t)dividend * reciprocal) >> 32U);
+
+      // The estimate is never more than one too small
+      if ((dividend - (quotient * divisor)) >= divisor)
+      {
+         quotient++;
+      }
+   }
+
+   return(quotient);
+}
+
+// Find the fastest call of a conversion
+static uint32_t MeasureConversionCycles(uint32_t (*const conversion)(const uint32_t))
+{
+   uint32_t minCycles = UINT32_MAX;
+
+   for (uint32_t iteration = 0U; iteration < BENCHMARK_ITERATIONS; iteration++)
+   {
+      const uint16_t interruptState = Sys_EnterCritical();
+      const Timebase_CycleCount_t startCycles = Timebase_GetCycleCount();
+      uint32_t cycles;
+
+      benchmarkResult = conversion(iteration * BENCHMARK_INPUT_STEP);
+      cycles = Timebase_GetCycleCount() - startCycles;
+      Sys_ExitCritical(interruptState);
+
+      if (cycles < minCycles)
+      {
+         minCycles = cycles;
+      }
+   }
+
+   return(minCycles);
+}
+
+// Measures only the call overhead
+static uint32_t BenchmarkIdentity(const uint32_t value)
+{
+   return(value);
+}
+
+// Division by a value only known at runtime
+static uint32_t BenchmarkRuntimeDivision(const uint32_t value)
+{
+   return(value / benchmarkDivisor);
+}
+
+// Read the microsecond timestamp
+static uint32_t BenchmarkTimestampUs(const uint32_t value)
+{
+   (void)value;
+
+   return((uint32_t)Timebase_GetTimestampUs());
+}
+
 
 /*******************************************************************************
 // Public Function Implementations
@@ -66,7 +260,14 @@ typedef uint32_t TimerTick;
 // Module intialization
 bool Timebase_Init(const uint32_t moduleID, const void *configData)
 {
-    // Nothing to do since we just wrap the System Tick Driver
+    // Time starts from the current value of the free-running counter
+    status.lastCycleCount = (Timebase_CycleCount_t)SysTick_Drv_GetCycleCount();
+    status.cycleCountWraps = 0U;
+    status.tickCount = 0U;
+    status.tickStartCycles = status.lastCycleCount;
+    status.microsecondCount = 0U;
+    status.microsecondStartCycles = status.lastCycleCount;
+
     // Return success
     return (true);
 }
@@ -74,16 +275,78 @@ bool Timebase_Init(const uint32_t moduleID, const void *configData)
 // Returns current Timebase Tick value used for system timing
 Timebase_Tick_t Timebase_GetCurrentTickCount(void)
 {
-   // Simply return the current 32-bit SysTick value
-   // There isn't really a need to add an extra function call to SysTick_Drv_GetCurrentTickCount
-   return((Timebase_Tick_t)SysTick_Drv_sysTickCount);
+   // The tick count is derived from the cycle counter rather than counted by
+   // a periodic interrupt
+   (void)UpdateTimestamp();
+
+   return(status.tickCount);
+}
+
+// Returns the 64-bit number of cycles since initialization
+Timebase_Timestamp_t Timebase_GetTimestampCycles(void)
+{
+   return(UpdateTimestamp());
+}
+
+// Returns the 64-bit number of microseconds since initialization
+uint64_t Timebase_GetTimestampUs(void)
+{
+   // The microsecond count is kept up to date by the timestamp update, so no
+   // 64-bit division is needed
+   (void)UpdateTimestamp();
+
+   return(status.microsecondCount);
+}
+
+// Wake the CPU from idle at the start of the given tick
+void Timebase_RequestWakeup(const Timebase_Tick_t ticksFromNow)
+{
+   (void)UpdateTimestamp();
+
+   // Measure from the start of the current tick so the CPU wakes on the tick boundary
+   const uint32_t cyclesIntoTick = (uint32_t)SysTick_Drv_GetCycleCount() - status.tickStartCycles;
+   uint32_t wakeupCycles = MAX_WAKEUP_CYCLES;
+
+   if (ticksFromNow < (MAX_WAKEUP_CYCLES / (uint32_t)TIMEBASE_NUM_CYCLES_PER_TICK))
+   {
+      const uint32_t tickCycles = ticksFromNow * (uint32_t)TIMEBASE_NUM_CYCLES_PER_TICK;
+
+      // Wake immediately if the tick boundary has already passed
+      wakeupCycles = (tickCycles > cyclesIntoTick) ? (tickCycles - cyclesIntoTick) : 1U;
+   }
+
+   SysTick_Drv_StartWakeupTimer(wakeupCycles);
+}
+
+// Returns current value of the free-running cycle counter
+Timebase_CycleCount_t Timebase_GetCycleCount(void)
+{
+   return((Timebase_CycleCount_t)SysTick_Drv_GetCycleCount());
 }
 
 // Convert a tick count into milliseconds
 uint32_t Timebase_TicksToMilliseconds(Timebase_Tick_t const tickCount)
 {
    // Return the converted time -
-   return((uint32_t)tickCount / (uint32_t)TIMEBASE_NUM_TICKS_PER_MILLISECOND);
+   return(DivideByConstant(tickCount, TIMEBASE_NUM_TICKS_PER_MILLISECOND, RECIPROCAL(TIMEBASE_NUM_TICKS_PER_MILLISECOND)));
+}
+
+// Convert milliseconds into a tick count
+Timebase_Tick_t Timebase_MillisecondsToTicks(const uint32_t milliseconds)
+{
+   return(milliseconds * (uint32_t)TIMEBASE_NUM_TICKS_PER_MILLISECOND);
+}
+
+// Convert a tick count into microseconds
+uint32_t Timebase_TicksToMicroseconds(Timebase_Tick_t const tickCount)
+{
+   return(tickCount * (uint32_t)TIMEBASE_NUM_MICROSECONDS_PER_TICK);
+}
+
+// Convert microseconds into a tick count
+Timebase_Tick_t Timebase_MicrosecondsToTicks(const uint32_t microseconds)
+{
+   return(DivideByConstant(microseconds, TIMEBASE_NUM_MICROSECONDS_PER_TICK, RECIPROCAL(TIMEBASE_NUM_MICROSECONDS_PER_TICK)));
 }
 
 // Get the elapsed time for two tick timestamps (end - start)
@@ -111,4 +374,51 @@ Timebase_Tick_t Timebase_CalculateElapsedTimeTicks(const Timebase_Tick_t startTi
      return(elapsedTicks);
 }
 
+// Time the conversions
+void Timebase_MessageRouter_BenchmarkConversions(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // Cycles taken by an empty call, already removed from the results below
+      uint32_t overheadCycles;
+      // Cycles taken by Timebase_TicksToMilliseconds()
+      uint32_t ticksToMillisecondsCycles;
+      // Cycles taken by Timebase_MicrosecondsToTicks()
+      uint32_t microsecondsToTicksCycles;
+      // Cycles taken by Timebase_GetTimestampUs()
+      uint32_t timestampUsCycles;
+      // Cycles taken by a 32-bit division by a value only known at runtime, for comparison
+      uint32_t runtimeDivisionCycles;
+   } Response_t;
 
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      const uint32_t overheadCycles = MeasureConversionCycles(BenchmarkIdentity);
+
+      response->overheadCycles = overheadCycles;
+      response->ticksToMillisecondsCycles = MeasureConversionCycles(Timebase_TicksToMilliseconds) - overheadCycles;
+      response->microsecondsToTicksCycles = MeasureConversionCycles(Timebase_MicrosecondsToTicks) - overheadCycles;
+      response->timestampUsCycles = MeasureConversionCycles(BenchmarkTimestampUs) - overheadCycles;
+      response->runtimeDivisionCycles = MeasureConversionCycles(BenchmarkRuntimeDivision) - overheadCycles;
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
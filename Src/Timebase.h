@@ -12,8 +12,10 @@
 // Module Includes
 #include "Timebase_Config.h"
 // Platform Includes
+#include "MessageRouter.h"
 // Other Includes
 #include <stdbool.h> // Defines C99 boolean type
+#include <stdint.h> // Defines C99 integer types
 
 
 /*******************************************************************************
@@ -40,6 +42,14 @@ extern "C"
 // Defines type used to represent internal system tick in API functions
 typedef uint32_t Timebase_Tick_t;
 
+// Defines type used to represent the free-running cycle counter. This value
+// wraps at 32 bits, so it is only suitable for measuring short durations.
+typedef uint32_t Timebase_CycleCount_t;
+
+// Defines type used to represent a 64-bit timestamp. The hardware cycle
+// counter is extended in software so the timestamp does not wrap in practice.
+typedef uint64_t Timebase_Timestamp_t;
+
 
 /*******************************************************************************
 // Public Function Declarations
@@ -67,8 +77,9 @@ bool Timebase_Init(const uint32_t moduleID, const void *configData);
 
 /*******************************************************************************
 // Description:
-//    This function retrieves the current value of the Timebase.  In most
-//    implementations, this will just be the value of the SysTick timer.
+//    This function retrieves the current value of the Timebase. The tick
+//    count is derived from the free-running cycle counter, so no periodic
+//    interrupt is needed to keep it up to date.
 // Parameters:
 //    none
 // Returns:
@@ -76,9 +87,85 @@ bool Timebase_Init(const uint32_t moduleID, const void *configData);
 *******************************************************************************/
 Timebase_Tick_t Timebase_GetCurrentTickCount(void);
 
+/*******************************************************************************
+// Description:
+//    This function retrieves the number of CPU cycles since the Timebase was
+//    initialized. This function may be called from an interrupt.
+// Parameters:
+//    none
+// Returns:
+//    Timebase_Timestamp_t - The current 64-bit cycle count
+*******************************************************************************/
+Timebase_Timestamp_t Timebase_GetTimestampCycles(void);
+
+/*******************************************************************************
+// Description:
+//    This function retrieves the number of microseconds since the Timebase
+//    was initialized. This function may be called from an interrupt.
+// Parameters:
+//    none
+// Returns:
+//    uint64_t - The current 64-bit microsecond count
+*******************************************************************************/
+uint64_t Timebase_GetTimestampUs(void);
+
+/*******************************************************************************
+// Description:
+//    Arm the wakeup timer so that a CPU placed in idle resumes at the start of
+//    the given tick. Long delays are limited so the CPU wakes often enough to
+//    keep the 64-bit timestamp up to date.
+// Parameters:
+//    ticksFromNow - Number of tick boundaries after which the CPU is woken
+// Returns:
+//    none
+*******************************************************************************/
+void Timebase_RequestWakeup(const Timebase_Tick_t ticksFromNow);
+
+/*******************************************************************************
+// Description:
+//    This function retrieves the current value of the free-running cycle
+//    counter used for fine-grained execution time measurements. Elapsed
+//    cycles are calculated by unsigned subtraction of two readings.
+// Parameters:
+//    none
+// Returns:
+//    Timebase_CycleCount_t - The current 32-bit cycle count
+*******************************************************************************/
+Timebase_CycleCount_t Timebase_GetCycleCount(void);
+
+/*******************************************************************************
+// Description:
+//    Convert between ticks and milliseconds or microseconds. Conversions to
+//    ticks from a larger unit are multiplications and conversions from ticks
+//    to a larger unit use a compile-time reciprocal, so no runtime division is
+//    performed. Results are rounded down and multiplications wrap at 32 bits.
+// Parameters:
+//    tickCount - A number of ticks
+//    milliseconds - A number of milliseconds
+//    microseconds - A number of microseconds
+// Returns:
+//    The converted value
+*******************************************************************************/
 uint32_t Timebase_TicksToMilliseconds(Timebase_Tick_t const tickCount);
+Timebase_Tick_t Timebase_MillisecondsToTicks(const uint32_t milliseconds);
+uint32_t Timebase_TicksToMicroseconds(Timebase_Tick_t const tickCount);
+Timebase_Tick_t Timebase_MicrosecondsToTicks(const uint32_t microseconds);
+
 Timebase_Tick_t Timebase_CalculateElapsedTimeTicks(const Timebase_Tick_t startTickCount, const Timebase_Tick_t endTickCount);
 
+/*******************************************************************************
+// Description:
+//    This is the command handler used for measuring the cost in cycles of the
+//    time conversions, along with a runtime 32-bit division for comparison.
+//    Each conversion is timed with interrupts disabled and the fastest call
+//    is reported.
+// Parameters:
+//    message :  A pointer to a common Message Router message
+//               object. The response is expected to be placed in
+//               this object.
+*******************************************************************************/
+void Timebase_MessageRouter_BenchmarkConversions(MessageRouter_Message_t *const message);
+
 /*******************************************************************************
 // End of C Binding Section
 *******************************************************************************/
@@ -0,0 +1,941 @@
+/*******************************************************************************
+// Bulk Transfer Manager
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "Transfer_Mgr.h"
+#include "Transfer_Mgr_Config.h"
+// Platform Includes
+#include "CRCLib.h"
+#include "MessageRouter.h"
+#include "Serial.h"
+#include "Timebase.h"
+// Other Includes
+#include <stdbool.h> // Defines C99 boolean type
+#include <stddef.h> // NULL
+#include <stdint.h> // Defines C99 integer types
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The number of 16-bit words of data in a segment
+#define SEGMENT_NUM_WORDS (TRANSFER_MGR_SEGMENT_SIZE / 2U)
+
+// The number of bytes in a segment sent to the host, with its sequence number
+#define SEGMENT_PACKET_SIZE (2U + TRANSFER_MGR_SEGMENT_SIZE)
+
+// Selects the window slot of a sequence number
+#define WINDOW_INDEX_MASK (TRANSFER_MGR_WINDOW_SIZE - 1U)
+
+// The most segments in a transfer, so sequence numbers never wrap
+#define MAX_NUM_SEGMENTS (0xFFFFUL)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// One segment of the window
+typedef struct
+{
+    // The data of the segment, packed low byte first
+    uint16_t data[SEGMENT_NUM_WORDS];
+
+    // Set once the data is held: read from the endpoint, or received from the host
+    bool isValid;
+
+    // Reading: set once the host has acknowledged the segment
+    bool isAcknowledged;
+
+    // Reading: set if the segment is to be sent on the next update
+    bool isSendNeeded;
+
+    // Reading: set once the segment has been sent at least once
+    bool isSent;
+
+    // Reading: when the segment was last sent
+    Timebase_Tick_t sentTick;
+
+    // Reading: the send count when the segment was last sent, to tell which
+    // of two segments was sent later
+    uint16_t sendOrder;
+} Transfer_Mgr_Segment_t;
+
+// This structure defines the internal variables used by the module
+typedef struct
+{
+    // Module Id given to this module at Initialization
+    uint16_t moduleId;
+
+    // Configuration Table passed at Initialization
+    const Transfer_Mgr_Config_t *transferConfig;
+
+    // Initialization state for the module
+    bool isInitialized;
+
+    // The state of the transfer
+    Transfer_Mgr_State_t state;
+
+    // The endpoint of the open transfer
+    const Transfer_Mgr_EndpointConfig_t *endpoint;
+
+    // The address given when the transfer was opened
+    uint32_t address;
+
+    // The number of bytes in the transfer
+    uint32_t length;
+
+    // The number of segments in the transfer
+    uint16_t numSegments;
+
+    // The first segment not yet acknowledged (reading) or written (writing).
+    // The window holds this and the following segments.
+    uint16_t baseSequence;
+
+    // Reading: the next segment to be read from the endpoint
+    uint16_t nextSequence;
+
+    // Reading: the number of segments sent, used to order sends
+    uint16_t sendCount;
+
+    // The number of segments sent again (reading) or received again (writing)
+    uint16_t numRetransmits;
+
+    // Writing: the CRC32 given by the host
+    uint32_t expectedCrc;
+
+    // The CRC32 of the segments before baseSequence (writing) or nextSequence (reading)
+    CRCLib_ComputeContext_t crcContext;
+
+    // The retransmit timeout in ticks
+    Timebase_Tick_t retransmitTimeoutTicks;
+
+    // The window of segments, indexed by sequence number
+    Transfer_Mgr_Segment_t window[TRANSFER_MGR_WINDOW_SIZE];
+} Transfer_Mgr_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The variable used for holding all internal data for this module.
+static Transfer_Mgr_Status_t status;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    Opens a transfer, closing any transfer that is already open.
+  * Parameters:
+  *    state - TRANSFER_MGR_STATE_READING or TRANSFER_MGR_STATE_WRITING
+  * Returns:
+  *    bool - false if the endpoint does not support the direction or the
+  *       length is not valid. Nothing is changed.
+*/
+static bool Open(const Transfer_Mgr_State_t state, const uint16_t endpointId,
+                 const uint32_t address, const uint32_t length);
+
+/** Description:
+  *    Reads the segments the window has room for from the endpoint.
+*/
+static void LoadSegments(void);
+
+/** Description:
+  *    Sends the segments that are due, oldest first, until the transmit
+  *    buffer is full.
+*/
+static void SendSegments(void);
+
+/** Description:
+  *    Sends one segment to the host.
+  * Returns:
+  *    bool - false if the transmit buffer could not take the segment
+*/
+static bool SendSegment(const uint16_t sequence);
+
+/** Description:
+  *    Marks the segments the host holds as acknowledged and moves the window
+  *    on. A segment sent before one that was acknowledged was lost, so it is
+  *    sent again without waiting for the timeout.
+  * Parameters:
+  *    nextSequence - The first segment the host is missing
+  *    receivedMask - Bit i set if the host holds segment nextSequence + 1 + i
+*/
+static void AcknowledgeRead(const uint16_t nextSequence, const uint16_t receivedMask);
+
+/** Description:
+  *    Holds a segment from the host and writes every segment now in order to
+  *    the endpoint. Checks the CRC32 once the last segment is written. A
+  *    segment beyond the window is ignored, and sent again by the host once
+  *    the window moves on.
+*/
+static void ReceiveSegment(const uint16_t sequence, const uint16_t *const data);
+
+/** Description:
+  *    Returns a bitmap of the segments held after baseSequence, bit i for
+  *    segment baseSequence + 1 + i.
+*/
+static uint16_t GetReceivedMask(void);
+
+/** Description:
+  *    Returns the number of bytes in a segment. Only the last may be short.
+*/
+static uint16_t GetSegmentLength(const uint16_t sequence);
+
+/** Description:
+  *    Returns the window slot of a segment.
+*/
+static Transfer_Mgr_Segment_t *GetSegment(const uint16_t sequence);
+
+/** Description:
+  *    Adds the bytes of a segment, in order, to the CRC32 of the transfer.
+*/
+static void AddToCrc(const Transfer_Mgr_Segment_t *const segment, const uint16_t numBytes);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+static bool Open(const Transfer_Mgr_State_t state, const uint16_t endpointId,
+                 const uint32_t address, const uint32_t length)
+{
+   const Transfer_Mgr_EndpointConfig_t *endpoint = NULL;
+   bool isValid = status.isInitialized && (length > 0UL) &&
+                  (length <= (MAX_NUM_SEGMENTS * TRANSFER_MGR_SEGMENT_SIZE));
+
+   if (isValid)
+   {
+      for (uint16_t i = 0U; i < status.transferConfig->numConfigItems; i++)
+      {
+         if (status.transferConfig->endpointConfigArray[i].endpointId == endpointId)
+         {
+            endpoint = &status.transferConfig->endpointConfigArray[i];
+         }
+      }
+
+      isValid = (NULL != endpoint) &&
+                (((TRANSFER_MGR_STATE_READING == state) && (NULL != endpoint->readFunction)) ||
+                 ((TRANSFER_MGR_STATE_WRITING == state) && (NULL != endpoint->writeFunction))) &&
+                ((NULL == endpoint->checkFunction) ||
+                 endpoint->checkFunction(address, length, TRANSFER_MGR_STATE_WRITING == state));
+   }
+
+   if (isValid)
+   {
+      status.endpoint = endpoint;
+      status.address = address;
+      status.length = length;
+      status.numSegments = (uint16_t)((length + (TRANSFER_MGR_SEGMENT_SIZE - 1U)) / TRANSFER_MGR_SEGMENT_SIZE);
+      status.baseSequence = 0U;
+      status.nextSequence = 0U;
+      status.sendCount = 0U;
+      status.numRetransmits = 0U;
+      status.expectedCrc = 0UL;
+      CRCLib_ComputeBegin(&status.crcContext, &crcLibCrc32);
+
+      for (uint16_t i = 0U; i < TRANSFER_MGR_WINDOW_SIZE; i++)
+      {
+         status.window[i].isValid = false;
+         status.window[i].isAcknowledged = false;
+         status.window[i].isSendNeeded = false;
+         status.window[i].isSent = false;
+      }
+
+      status.state = state;
+   }
+
+   return(isValid);
+}
+
+static void LoadSegments(void)
+{
+   while ((TRANSFER_MGR_STATE_READING == status.state) && (status.nextSequence < status.numSegments) &&
+          ((uint16_t)(status.nextSequence - status.baseSequence) < TRANSFER_MGR_WINDOW_SIZE))
+   {
+      Transfer_Mgr_Segment_t *const segment = GetSegment(status.nextSequence);
+      const uint16_t segmentLength = GetSegmentLength(status.nextSequence);
+
+      if (status.endpoint->readFunction(status.address, (uint32_t)status.nextSequence * TRANSFER_MGR_SEGMENT_SIZE,
+                                        segment->data, segmentLength))
+      {
+         // Clear the unused high byte so an odd length segment is sent consistently
+         if (0U != (segmentLength & 1U))
+         {
+            segment->data[segmentLength >> 1U] &= 0x00FFU;
+         }
+
+         // The segments are read in order, so the CRC is that of the block
+         AddToCrc(segment, segmentLength);
+
+         segment->isValid = true;
+         segment->isAcknowledged = false;
+         segment->isSendNeeded = true;
+         segment->isSent = false;
+         status.nextSequence++;
+      }
+      else
+      {
+         status.state = TRANSFER_MGR_STATE_FAILED;
+      }
+   }
+}
+
+static void SendSegments(void)
+{
+   const Timebase_Tick_t currentTick = Timebase_GetCurrentTickCount();
+   bool isSpaceAvailable = true;
+
+   for (uint16_t sequence = status.baseSequence; (sequence != status.nextSequence) && isSpaceAvailable; sequence++)
+   {
+      Transfer_Mgr_Segment_t *const segment = GetSegment(sequence);
+
+      if (!segment->isAcknowledged &&
+          (segment->isSendNeeded ||
+           (Timebase_CalculateElapsedTimeTicks(segment->sentTick, currentTick) >= status.retransmitTimeoutTicks)))
+      {
+         // Later segments wait so the oldest are always sent first. Serial
+         // refuses a segment that would leave less room than the largest
+         // response, so the acknowledgements of the host are still answered.
+         isSpaceAvailable = SendSegment(sequence);
+
+         if (isSpaceAvailable)
+         {
+            if (segment->isSent)
+            {
+               status.numRetransmits++;
+            }
+
+            segment->isSent = true;
+            segment->isSendNeeded = false;
+            segment->sentTick = currentTick;
+            segment->sendOrder = status.sendCount;
+            status.sendCount++;
+         }
+      }
+   }
+}
+
+static bool SendSegment(const uint16_t sequence)
+{
+   const Transfer_Mgr_Segment_t *const segment = GetSegment(sequence);
+   const uint16_t segmentLength = GetSegmentLength(sequence);
+   uint16_t packet[SEGMENT_PACKET_SIZE / 2U];
+   MessageRouter_Message_t message;
+
+   packet[0] = sequence;
+   for (uint16_t i = 0U; i < ((segmentLength + 1U) / 2U); i++)
+   {
+      packet[1U + i] = segment->data[i];
+   }
+
+   message.header.moduleID = status.moduleId;
+   message.header.commandID = TRANSFER_MGR_SEGMENT_COMMAND_ID;
+   message.header.messageID = sequence & 0xFFU;
+   message.commandParams.maxLength = 0U;
+   message.commandParams.length = 0U;
+   message.commandParams.data = NULL;
+   message.responseParams.maxLength = (uint16_t)SEGMENT_PACKET_SIZE;
+   message.responseParams.length = (uint16_t)(2U + segmentLength);
+   message.responseParams.data = packet;
+   message.responseCode = POWER_MESSAGEROUTER_RESPONSE_CODE_None;
+
+   return(Serial_SendMessage(status.transferConfig->channel, &message));
+}
+
+static void AcknowledgeRead(const uint16_t nextSequence, const uint16_t receivedMask)
+{
+   // An acknowledgement may not move the window back or past what was sent
+   if ((TRANSFER_MGR_STATE_READING == status.state) &&
+       ((uint16_t)(nextSequence - status.baseSequence) <= (uint16_t)(status.nextSequence - status.baseSequence)))
+   {
+      bool isLaterAcknowledged = false;
+      uint16_t latestSendOrder = 0U;
+
+      while (status.baseSequence != nextSequence)
+      {
+         GetSegment(status.baseSequence)->isValid = false;
+         status.baseSequence++;
+      }
+
+      // Walk back from the newest segment, so each missing segment is compared
+      // with the latest send of any segment acknowledged after it
+      for (uint16_t i = TRANSFER_MGR_WINDOW_SIZE - 1U; i > 0U; i--)
+      {
+         const uint16_t sequence = status.baseSequence + i;
+
+         if ((uint16_t)(sequence - status.baseSequence) < (uint16_t)(status.nextSequence - status.baseSequence))
+         {
+            Transfer_Mgr_Segment_t *const segment = GetSegment(sequence);
+
+            if (0U != (receivedMask & (1U << (i - 1U))))
+            {
+               segment->isAcknowledged = true;
+            }
+
+            if (segment->isAcknowledged)
+            {
+               if (!isLaterAcknowledged || ((int16_t)(segment->sendOrder - latestSendOrder) > 0))
+               {
+                  latestSendOrder = segment->sendOrder;
+               }
+               isLaterAcknowledged = true;
+            }
+            else if (isLaterAcknowledged && segment->isSent &&
+                     ((int16_t)(segment->sendOrder - latestSendOrder) < 0))
+            {
+               segment->isSendNeeded = true;
+            }
+         }
+      }
+
+      // The first missing segment is lost if anything sent after it arrived
+      if (status.baseSequence != status.nextSequence)
+      {
+         Transfer_Mgr_Segment_t *const segment = GetSegment(status.baseSequence);
+
+         if (isLaterAcknowledged && segment->isSent && ((int16_t)(segment->sendOrder - latestSendOrder) < 0))
+         {
+            segment->isSendNeeded = true;
+         }
+      }
+      else if (status.baseSequence == status.numSegments)
+      {
+         status.state = TRANSFER_MGR_STATE_COMPLETE;
+      }
+   }
+}
+
+static void ReceiveSegment(const uint16_t sequence, const uint16_t *const data)
+{
+   if ((TRANSFER_MGR_STATE_WRITING == status.state) && (sequence < status.numSegments))
+   {
+      if (sequence < status.baseSequence)
+      {
+         // Already written, so the host missed the response
+         status.numRetransmits++;
+      }
+      else if ((sequence - status.baseSequence) < TRANSFER_MGR_WINDOW_SIZE)
+      {
+         Transfer_Mgr_Segment_t *const segment = GetSegment(sequence);
+
+         if (segment->isValid)
+         {
+            status.numRetransmits++;
+         }
+         else
+         {
+            for (uint16_t i = 0U; i < SEGMENT_NUM_WORDS; i++)
+            {
+               segment->data[i] = data[i];
+            }
+            segment->isValid = true;
+         }
+      }
+
+      // The endpoint is written strictly in order
+      while ((TRANSFER_MGR_STATE_WRITING == status.state) && (status.baseSequence < status.numSegments) &&
+             GetSegment(status.baseSequence)->isValid)
+      {
+         Transfer_Mgr_Segment_t *const segment = GetSegment(status.baseSequence);
+         const uint16_t segmentLength = GetSegmentLength(status.baseSequence);
+
+         if (status.endpoint->writeFunction(status.address,
+                                            (uint32_t)status.baseSequence * TRANSFER_MGR_SEGMENT_SIZE,
+                                            segment->data, segmentLength))
+         {
+            AddToCrc(segment, segmentLength);
+            segment->isValid = false;
+            status.baseSequence++;
+         }
+         else
+         {
+            status.state = TRANSFER_MGR_STATE_FAILED;
+         }
+      }
+
+      if ((TRANSFER_MGR_STATE_WRITING == status.state) && (status.baseSequence == status.numSegments))
+      {
+         status.state = (CRCLib_ComputeFinish(&status.crcContext) == status.expectedCrc) ?
+                        TRANSFER_MGR_STATE_COMPLETE : TRANSFER_MGR_STATE_FAILED;
+      }
+   }
+}
+
+static uint16_t GetReceivedMask(void)
+{
+   uint16_t receivedMask = 0U;
+
+   if (TRANSFER_MGR_STATE_WRITING == status.state)
+   {
+      for (uint16_t i = 1U; i < TRANSFER_MGR_WINDOW_SIZE; i++)
+      {
+         if (GetSegment(status.baseSequence + i)->isValid)
+         {
+            receivedMask |= (1U << (i - 1U));
+         }
+      }
+   }
+
+   return(receivedMask);
+}
+
+static uint16_t GetSegmentLength(const uint16_t sequence)
+{
+   const uint32_t offset = (uint32_t)sequence * TRANSFER_MGR_SEGMENT_SIZE;
+
+   return(((status.length - offset) < TRANSFER_MGR_SEGMENT_SIZE) ?
+          (uint16_t)(status.length - offset) : (uint16_t)TRANSFER_MGR_SEGMENT_SIZE);
+}
+
+static Transfer_Mgr_Segment_t *GetSegment(const uint16_t sequence)
+{
+   return(&status.window[sequence & WINDOW_INDEX_MASK]);
+}
+
+static void AddToCrc(const Transfer_Mgr_Segment_t *const segment, const uint16_t numBytes)
+{
+   // CRCLib takes words high byte first, so the bytes are given one at a time
+   for (uint16_t i = 0U; i < numBytes; i++)
+   {
+      CRCLib_ComputeUpdateByte(&status.crcContext, (segment->data[i >> 1U] >> ((i & 1U) * 8U)) & 0xFFU);
+   }
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Module initialization
+bool Transfer_Mgr_Init(const uint32_t moduleId, const Transfer_Mgr_Config_t *configPtr)
+{
+   // Default module to uninitialized
+   status.isInitialized = false;
+   // Store the module Id, which is also the module ID of every segment sent
+   status.moduleId = (uint16_t)moduleId;
+
+   // First, validate the given parameter is valid
+   if ((NULL != configPtr) && (configPtr->retransmitTimeoutMs > 0U) &&
+       (configPtr->writeWindowSize > 0U) && (configPtr->writeWindowSize <= TRANSFER_MGR_WINDOW_SIZE) &&
+       ((0U == configPtr->numConfigItems) || (NULL != configPtr->endpointConfigArray)) &&
+       ((0U == configPtr->numMemoryRanges) || (NULL != configPtr->memoryRangeArray)))
+   {
+      // Store the given configuration table
+      status.transferConfig = configPtr;
+
+      //-----------------------------------------------
+      // Local Variable Initialization
+      //-----------------------------------------------
+      status.state = TRANSFER_MGR_STATE_IDLE;
+      status.endpoint = NULL;
+      status.length = 0UL;
+      status.numSegments = 0U;
+      status.baseSequence = 0U;
+      status.nextSequence = 0U;
+      status.numRetransmits = 0U;
+      status.retransmitTimeoutTicks = Timebase_MillisecondsToTicks(configPtr->retransmitTimeoutMs);
+      CRCLib_ComputeBegin(&status.crcContext, &crcLibCrc32);
+
+      // Set to initialized
+      status.isInitialized = true;
+   }
+
+   // Return initialization state
+   return(status.isInitialized);
+}
+
+// Scheduled function for sending the segments of a read
+void Transfer_Mgr_Update(void)
+{
+   if (status.isInitialized && (TRANSFER_MGR_STATE_READING == status.state))
+   {
+      LoadSegments();
+
+      if (TRANSFER_MGR_STATE_READING == status.state)
+      {
+         SendSegments();
+      }
+   }
+}
+
+// Check a memory transfer against the allowed ranges
+bool Transfer_Mgr_CheckMemory(const uint32_t address, const uint32_t length, const bool isWrite)
+{
+   // An odd length still touches the last word
+   const uint32_t numWords = (length + 1UL) / 2UL;
+   bool isAllowed = false;
+
+   if (status.isInitialized)
+   {
+      for (uint16_t i = 0U; (i < status.transferConfig->numMemoryRanges) && !isAllowed; i++)
+      {
+         const Transfer_Mgr_MemoryRange_t *const range = &status.transferConfig->memoryRangeArray[i];
+         const uint32_t startAddress = (uint32_t)(uintptr_t)range->startAddress;
+         const uint32_t endAddress = (uint32_t)(uintptr_t)range->endAddress;
+
+         // Compared as lengths so a transfer that wraps past the top of
+         // memory is not let through
+         isAllowed = (address >= startAddress) && (address <= endAddress) &&
+                     (numWords <= (endAddress - address)) && (range->isWritable || !isWrite);
+      }
+   }
+
+   return(isAllowed);
+}
+
+// Read memory for a transfer
+bool Transfer_Mgr_ReadMemory(const uint32_t address, const uint32_t offset, uint16_t *const data,
+                             const uint16_t numBytes)
+{
+   const volatile uint16_t *const memory = (const volatile uint16_t *)(uintptr_t)address + (offset >> 1U);
+
+   for (uint16_t i = 0U; i < ((numBytes + 1U) / 2U); i++)
+   {
+      data[i] = memory[i];
+   }
+
+   return(true);
+}
+
+// Write memory for a transfer
+bool Transfer_Mgr_WriteMemory(const uint32_t address, const uint32_t offset, const uint16_t *const data,
+                              const uint16_t numBytes)
+{
+   volatile uint16_t *const memory = (volatile uint16_t *)(uintptr_t)address + (offset >> 1U);
+   const uint16_t numWords = numBytes >> 1U;
+
+   for (uint16_t i = 0U; i < numWords; i++)
+   {
+      memory[i] = data[i];
+   }
+
+   if (0U != (numBytes & 1U))
+   {
+      memory[numWords] = (memory[numWords] & 0xFF00U) | (data[numWords] & 0x00FFU);
+   }
+
+   return(true);
+}
+
+
+/*******************************************************************************
+// Message Router Function Implementations
+*******************************************************************************/
+
+// Open a transfer from an endpoint to the host
+void Transfer_Mgr_MessageRouter_OpenRead(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+   // This structure defines the format of the command data.
+   typedef struct
+   {
+      // Passed to the endpoint, the first word for the memory endpoint
+      uint32_t address;
+      // The number of bytes to be read
+      uint32_t length;
+      // Transfer_Mgr_EndpointId_t
+      uint16_t endpointId;
+      // Keeps the size a whole number of 32-bit values
+      uint16_t dummy;
+   } Command_t;
+
+   // This structure defines the format of the response.
+   typedef struct
+   {
+      // 1 if the transfer was opened
+      uint16_t isSuccessful;
+      // The number of bytes in every segment but the last
+      uint16_t segmentSize;
+      // The number of segments that may be in flight
+      uint16_t windowSize;
+      // The number of segments in the transfer
+      uint16_t numSegments;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      // The first segments are sent on the next update
+      const bool isSuccessful = Open(TRANSFER_MGR_STATE_READING, command->endpointId,
+                                     command->address, command->length);
+
+      response->isSuccessful = isSuccessful ? 1U : 0U;
+      response->segmentSize = TRANSFER_MGR_SEGMENT_SIZE;
+      response->windowSize = TRANSFER_MGR_WINDOW_SIZE;
+      response->numSegments = isSuccessful ? status.numSegments : 0U;
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Open a transfer from the host to an endpoint
+void Transfer_Mgr_MessageRouter_OpenWrite(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+   // This structure defines the format of the command data.
+   typedef struct
+   {
+      // Passed to the endpoint, the first word for the memory endpoint
+      uint32_t address;
+      // The number of bytes to be written
+      uint32_t length;
+      // The CRC32 of the bytes to be written
+      uint32_t crc;
+      // Transfer_Mgr_EndpointId_t
+      uint16_t endpointId;
+      // Keeps the size a whole number of 32-bit values
+      uint16_t dummy;
+   } Command_t;
+
+   // This structure defines the format of the response.
+   typedef struct
+   {
+      // 1 if the transfer was opened
+      uint16_t isSuccessful;
+      // The number of bytes in every segment but the last
+      uint16_t segmentSize;
+      // The number of segments that may be sent before a response
+      uint16_t windowSize;
+      // The number of segments in the transfer
+      uint16_t numSegments;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      const bool isSuccessful = Open(TRANSFER_MGR_STATE_WRITING, command->endpointId,
+                                     command->address, command->length);
+
+      if (isSuccessful)
+      {
+         status.expectedCrc = command->crc;
+      }
+
+      response->isSuccessful = isSuccessful ? 1U : 0U;
+      response->segmentSize = TRANSFER_MGR_SEGMENT_SIZE;
+      response->windowSize = status.transferConfig->writeWindowSize;
+      response->numSegments = isSuccessful ? status.numSegments : 0U;
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Receive a segment of a write
+void Transfer_Mgr_MessageRouter_WriteSegment(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+   // This structure defines the format of the command data.
+   typedef struct
+   {
+      // The sequence number of the segment
+      uint16_t sequence;
+      // The data of the segment, packed low byte first. The bytes past the end
+      // of the transfer in the last segment are ignored.
+      uint16_t data[SEGMENT_NUM_WORDS];
+   } Command_t;
+
+   // This structure defines the format of the response.
+   typedef struct
+   {
+      // Transfer_Mgr_State_t
+      uint16_t state;
+      // The first segment still missing
+      uint16_t nextSequence;
+      // Bit i set if segment nextSequence + 1 + i is held
+      uint16_t receivedMask;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      ReceiveSegment(command->sequence, command->data);
+
+      response->state = status.state;
+      response->nextSequence = status.baseSequence;
+      response->receivedMask = GetReceivedMask();
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Acknowledge the segments of a read held by the host
+void Transfer_Mgr_MessageRouter_AcknowledgeRead(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+   // This structure defines the format of the command data.
+   typedef struct
+   {
+      // The first segment the host is missing
+      uint16_t nextSequence;
+      // Bit i set if the host holds segment nextSequence + 1 + i
+      uint16_t receivedMask;
+   } Command_t;
+
+   // This structure defines the format of the response.
+   typedef struct
+   {
+      // Transfer_Mgr_State_t
+      uint16_t state;
+      // The first segment not yet acknowledged
+      uint16_t nextSequence;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      AcknowledgeRead(command->nextSequence, command->receivedMask);
+
+      response->state = status.state;
+      response->nextSequence = status.baseSequence;
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Get the progress of the transfer
+void Transfer_Mgr_MessageRouter_GetStatus(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+   // This structure defines the format of the response.
+   typedef struct
+   {
+      // The number of bytes in the transfer
+      uint32_t length;
+      // The CRC32 of the bytes read or written so far
+      uint32_t crc;
+      // Transfer_Mgr_State_t
+      uint16_t state;
+      // The first segment not yet acknowledged or written
+      uint16_t nextSequence;
+      // The number of segments in the transfer
+      uint16_t numSegments;
+      // The number of segments sent or received again
+      uint16_t numRetransmits;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      response->length = status.length;
+      response->crc = CRCLib_ComputeFinish(&status.crcContext);
+      response->state = status.state;
+      response->nextSequence = status.baseSequence;
+      response->numSegments = status.numSegments;
+      response->numRetransmits = status.numRetransmits;
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Close the transfer
+void Transfer_Mgr_MessageRouter_Abort(MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //   Note that the error response will be set, if necessary
+   if (MessageRouter_VerifyParameterSizes(message, 0, 0))
+   {
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      // Segments already queued for transmit are still sent
+      status.state = TRANSFER_MGR_STATE_IDLE;
+
+      // Set the response length
+      MessageRouter_SetResponseSize(message, 0);
+   }
+}
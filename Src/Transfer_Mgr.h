@@ -0,0 +1,236 @@
+/*******************************************************************************
+// Bulk Transfer Manager
+// Moves blocks of data far larger than one command, such as a capture buffer
+// or a firmware image, between the host and an endpoint. The data is split
+// into numbered segments and a window of them is kept in flight, so the link
+// is not idle while each segment is acknowledged. Missing segments are
+// reported by the receiver and sent again on their own. A CRC32 of the whole
+// block checks the transfer from end to end.
+//
+// Reading (device to host):
+//    The host opens the transfer, and the segments are then sent without a
+//    command for each, framed the same as a response with the module ID of
+//    this module and TRANSFER_MGR_SEGMENT_COMMAND_ID. The data holds the
+//    16-bit sequence number, low byte first, followed by up to
+//    TRANSFER_MGR_SEGMENT_SIZE bytes. The host acknowledges with the first
+//    sequence it is missing and a bitmap of the segments after that one it
+//    already holds. A segment is sent again once a segment sent after it is
+//    acknowledged, or once it has not been acknowledged for the retransmit
+//    timeout.
+// Writing (host to device):
+//    The host opens the transfer with the CRC32 of the block, then sends up
+//    to the window size given in the open response before waiting for a
+//    response. The window is writeWindowSize of the configuration, which is
+//    limited by the receive buffer of the port rather than by
+//    TRANSFER_MGR_WINDOW_SIZE: a binary segment frame is about 55 bytes, so
+//    the 256 byte receive buffer of the host port holds four. Bytes sent
+//    beyond that are dropped by the UART driver, and those segments are
+//    reported missing and sent again. Each response gives the first sequence
+//    still missing and a bitmap of the segments after it that are held, so
+//    the host only sends the missing segments again. The transfer fails if
+//    the CRC32 does not match.
+//
+// The CRC32 is that of zlib, over the bytes of the block in order. The data
+// of each endpoint is read or written strictly in order, so an endpoint may
+// be a stream rather than memory.
+*******************************************************************************/
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Transfer_Mgr_Config.h" // Defines endpoint identifiers
+// Platform Includes
+#include "MessageRouter.h"
+#include "UART_Drv.h"
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The command ID used in the header of every segment sent to the host
+#define TRANSFER_MGR_SEGMENT_COMMAND_ID (0x81U)
+
+// The number of bytes of data in every segment but the last. A segment and
+// its sequence number fill one Serial command.
+#define TRANSFER_MGR_SEGMENT_SIZE (44U)
+
+// The number of segments that may be in flight. The acknowledgement bitmap
+// covers the segments after the first missing one. Must be a power of two.
+#define TRANSFER_MGR_WINDOW_SIZE (16U)
+
+
+/*******************************************************************************
+// Public Types
+*******************************************************************************/
+
+/** Description:
+  *    Reads the next bytes of an endpoint.
+  * Parameters:
+  *    address - The address given when the transfer was opened
+  *    offset - The number of bytes already read. Always a multiple of
+  *       TRANSFER_MGR_SEGMENT_SIZE and one segment more than the last call.
+  *    data - The buffer for the bytes, packed two per word, low byte first
+  *    numBytes - The number of bytes to be read
+  * Returns:
+  *    bool - false if the bytes could not be read, which fails the transfer
+*/
+typedef bool (*Transfer_Mgr_ReadFunction_t)(const uint32_t address, const uint32_t offset, uint16_t *const data,
+                                            const uint16_t numBytes);
+
+/** Description:
+  *    Writes the next bytes of an endpoint.
+  * Parameters:
+  *    address - The address given when the transfer was opened
+  *    offset - The number of bytes already written. Always a multiple of
+  *       TRANSFER_MGR_SEGMENT_SIZE and one segment more than the last call.
+  *    data - The bytes, packed two per word, low byte first
+  *    numBytes - The number of bytes to be written
+  * Returns:
+  *    bool - false if the bytes could not be written, which fails the transfer
+*/
+typedef bool (*Transfer_Mgr_WriteFunction_t)(const uint32_t address, const uint32_t offset, const uint16_t *const data,
+                                             const uint16_t numBytes);
+
+/** Description:
+  *    Checks the address and length given by the host before a transfer of
+  *    an endpoint is opened.
+  * Parameters:
+  *    address - The address given to open the transfer
+  *    length - The number of bytes to be read or written
+  *    isWrite - true if the transfer writes the endpoint
+  * Returns:
+  *    bool - false if the transfer is not allowed and must not be opened
+*/
+typedef bool (*Transfer_Mgr_CheckFunction_t)(const uint32_t address, const uint32_t length, const bool isWrite);
+
+// Describes a source or destination of transfers
+typedef struct
+{
+    // Endpoint identifier
+    Transfer_Mgr_EndpointId_t endpointId;
+    // Reads the endpoint, NULL if it may not be read
+    Transfer_Mgr_ReadFunction_t readFunction;
+    // Writes the endpoint, NULL if it may not be written
+    Transfer_Mgr_WriteFunction_t writeFunction;
+    // Checks each transfer before it is opened, NULL if every address is allowed
+    Transfer_Mgr_CheckFunction_t checkFunction;
+} Transfer_Mgr_EndpointConfig_t;
+
+// A block of memory the memory endpoint may transfer
+typedef struct
+{
+    // The first word of the block
+    const uint16_t *startAddress;
+    // The word after the last word of the block
+    const uint16_t *endAddress;
+    // Set if the host may write the block as well as read it
+    bool isWritable;
+} Transfer_Mgr_MemoryRange_t;
+
+// Common configuration structure passed to the module initialization function
+// Data is generally defined in the board-specific configuration file
+typedef struct
+{
+    // The port the segments of a read are sent on
+    UART_Drv_Channel_t channel;
+    // The time after which a segment that has not been acknowledged is sent again
+    uint16_t retransmitTimeoutMs;
+    // The number of segments the host may send before waiting for a response.
+    // The receive buffer of the port must hold this many segment frames.
+    // (Max TRANSFER_MGR_WINDOW_SIZE)
+    uint16_t writeWindowSize;
+    // The number of items in the endpointConfigArray - calculated by compiler
+    uint16_t numConfigItems;
+    // Endpoint configuration data
+    const Transfer_Mgr_EndpointConfig_t *endpointConfigArray;
+    // The number of items in the memoryRangeArray - calculated by compiler
+    uint16_t numMemoryRanges;
+    // The only memory the memory endpoint may read or write
+    const Transfer_Mgr_MemoryRange_t *memoryRangeArray;
+} Transfer_Mgr_Config_t;
+
+// The state of the transfer
+typedef enum
+{
+    // No transfer is open
+    TRANSFER_MGR_STATE_IDLE,
+    // Segments are being sent to the host
+    TRANSFER_MGR_STATE_READING,
+    // Segments are being received from the host
+    TRANSFER_MGR_STATE_WRITING,
+    // Every segment was acknowledged, or written with a matching CRC
+    TRANSFER_MGR_STATE_COMPLETE,
+    // The endpoint failed or the CRC of a write did not match
+    TRANSFER_MGR_STATE_FAILED,
+    TRANSFER_MGR_STATE_COUNT
+} Transfer_Mgr_State_t;
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function defines the module initialization. No transfer is open
+  *    afterwards.
+*/
+bool Transfer_Mgr_Init(const uint32_t moduleId, const Transfer_Mgr_Config_t *configPtr);
+
+
+/** Description:
+  *    The periodic function called by the scheduler. While reading, sends the
+  *    segments that are due, oldest first, as far as the window and the
+  *    transmit buffer allow.
+*/
+void Transfer_Mgr_Update(void);
+
+
+/** Description:
+  *    The check function of the memory endpoint. A transfer is allowed only if
+  *    every word of it lies within one of the memory ranges of the
+  *    configuration, and for a write only if that range is writable.
+*/
+bool Transfer_Mgr_CheckMemory(const uint32_t address, const uint32_t length, const bool isWrite);
+
+
+/** Description:
+  *    An endpoint function that reads memory. The address is that of the
+  *    first 16-bit word.
+*/
+bool Transfer_Mgr_ReadMemory(const uint32_t address, const uint32_t offset, uint16_t *const data,
+                             const uint16_t numBytes);
+
+
+/** Description:
+  *    An endpoint function that writes memory. The address is that of the
+  *    first 16-bit word. The high byte of the last word is kept if the block
+  *    has an odd length.
+*/
+bool Transfer_Mgr_WriteMemory(const uint32_t address, const uint32_t offset, const uint16_t *const data,
+                              const uint16_t numBytes);
+
+void Transfer_Mgr_MessageRouter_OpenRead(MessageRouter_Message_t *const message);
+void Transfer_Mgr_MessageRouter_OpenWrite(MessageRouter_Message_t *const message);
+void Transfer_Mgr_MessageRouter_WriteSegment(MessageRouter_Message_t *const message);
+void Transfer_Mgr_MessageRouter_AcknowledgeRead(MessageRouter_Message_t *const message);
+void Transfer_Mgr_MessageRouter_GetStatus(MessageRouter_Message_t *const message);
+void Transfer_Mgr_MessageRouter_Abort(MessageRouter_Message_t *const message);
+
+
+#ifdef __cplusplus
+}
+#endif
@@ -111,6 +111,32 @@ uint16_t UART_Drv_GetNumCharsRX(const UART_Drv_Channel_t channelId);
 *******************************************************************************/
 uint16_t UART_Drv_GetNumCharsTX(const UART_Drv_Channel_t channelId);
 
+/*******************************************************************************
+// Description:
+//    Returns the number of characters that can be queued by UART_Drv_Write()
+//    without any being dropped. Used by senders that would rather skip a
+//    message than send part of one.
+// Parameters:
+//    channelId - The logical identifier of the channel to be written
+// Returns:
+//    uint16_t - The free space in the transmit buffer, 0 for an invalid channel
+*******************************************************************************/
+uint16_t UART_Drv_GetTxBufferSpace(const UART_Drv_Channel_t channelId);
+
+/*******************************************************************************
+// Description:
+//    Asks for the txSpaceCallback of the channel to be called from
+//    UART_Drv_Update() once the transmit buffer has the given free space. Used
+//    by a sender that is waiting for room, so it need not poll. Each channel
+//    holds one request, which is cleared when the callback is made.
+// Parameters:
+//    channelId - The logical identifier of the channel to be written
+//    numChars - The free space that is needed
+// Returns:
+//    none
+*******************************************************************************/
+void UART_Drv_RequestTxSpace(const UART_Drv_Channel_t channelId, const uint16_t numChars);
+
 /*******************************************************************************
 // Description:
 //    Reads a single character from the read buffer for a UART channel
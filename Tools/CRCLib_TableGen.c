@@ -0,0 +1,275 @@
+/*******************************************************************************
+// CRC Table Generator
+// Host tool that writes the lookup tables used by the CRCLib descriptors to
+// standard output. Each table is checked against the standard check value of
+// its CRC before any output is written.
+//
+// Usage (from the repository root):
+//    cc -o crclib_tablegen Tools/CRCLib_TableGen.c
+//    ./crclib_tablegen > Src/CRCLib_Tables.c
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+// Platform Includes
+// Other Includes
+#include <stdbool.h> // Defines C99 boolean type
+#include <stdint.h> // Defines C99 integer types
+#include <stdio.h>
+#include <stdlib.h> // C exit codes
+#include <string.h>
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The number of entries in each table
+#define NUM_TABLE_ENTRIES (256U)
+
+// The data used for the check value of every CRC
+#define CHECK_STRING "123456789"
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// Describes one generated table and the CRC used to check it
+typedef struct
+{
+   // Name of the table in the generated file
+   const char *tableName;
+   // Comment placed above the table
+   const char *description;
+   // Width of the CRC in bits: 8, 16 or 32
+   uint16_t width;
+   // Polynomial in normal form, most significant bit first
+   uint32_t polynomial;
+   // Set if bytes are processed least significant bit first
+   bool isReflected;
+   // Starting value and final XOR, only used for the check
+   uint32_t initialValue;
+   uint32_t finalXor;
+   // CRC of CHECK_STRING from the published catalogue
+   uint32_t checkValue;
+} TableDefinition_t;
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// CRC16-CCITT uses the tables already in CRCLib.c
+static const TableDefinition_t tableDefinitions[] =
+{
+   { "crcLibTableCrc8", "CRC-8/SMBUS: polynomial 0x07, not reflected",
+     8U, 0x07UL, false, 0x00UL, 0x00UL, 0xF4UL },
+   { "crcLibTableCrc16Modbus", "CRC-16/MODBUS: polynomial 0x8005, reflected",
+     16U, 0x8005UL, true, 0xFFFFUL, 0x0000UL, 0x4B37UL },
+   { "crcLibTableCrc32", "CRC-32: polynomial 0x04C11DB7, reflected",
+     32U, 0x04C11DB7UL, true, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xCBF43926UL },
+};
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Returns the value with its lowest numBits bits in reverse order
+static uint32_t Reflect(const uint32_t value, const uint16_t numBits)
+{
+   uint32_t reflected = 0UL;
+
+   for (uint16_t i = 0U; i < numBits; i++)
+   {
+      if (0UL != (value & (1UL << i)))
+      {
+         reflected |= 1UL << (numBits - 1U - i);
+      }
+   }
+
+   return(reflected);
+}
+
+// Fills the table one bit at a time, the same way the table is defined
+static void BuildTable(const TableDefinition_t *const definition, uint32_t *const table)
+{
+   const uint32_t topBit = 1UL << (definition->width - 1U);
+   const uint32_t mask = 0xFFFFFFFFUL >> (32U - definition->width);
+
+   for (uint32_t i = 0UL; i < NUM_TABLE_ENTRIES; i++)
+   {
+      uint32_t crc;
+
+      if (definition->isReflected)
+      {
+         const uint32_t polynomial = Reflect(definition->polynomial, definition->width);
+
+         crc = i;
+         for (uint16_t bit = 0U; bit < 8U; bit++)
+         {
+            crc = (0UL != (crc & 1UL)) ? ((crc >> 1U) ^ polynomial) : (crc >> 1U);
+         }
+      }
+      else
+      {
+         crc = i << (definition->width - 8U);
+         for (uint16_t bit = 0U; bit < 8U; bit++)
+         {
+            crc = (0UL != (crc & topBit)) ? ((crc << 1U) ^ definition->polynomial) : (crc << 1U);
+         }
+      }
+
+      table[i] = crc & mask;
+   }
+}
+
+// Calculates the CRC of a string a byte at a time with the table, the same
+// way CRCLib does
+static uint32_t CalculateWithTable(const TableDefinition_t *const definition, const uint32_t *const table,
+                                   const char *const data)
+{
+   const uint32_t mask = 0xFFFFFFFFUL >> (32U - definition->width);
+   uint32_t crc = definition->initialValue;
+
+   for (size_t i = 0U; i < strlen(data); i++)
+   {
+      const uint32_t byte = (uint32_t)(unsigned char)data[i];
+
+      if (definition->isReflected)
+      {
+         crc = (crc >> 8U) ^ table[(crc ^ byte) & 0xFFUL];
+      }
+      else
+      {
+         crc = ((crc << 8U) ^ table[((crc >> (definition->width - 8U)) ^ byte) & 0xFFUL]) & mask;
+      }
+   }
+
+   return((crc ^ definition->finalXor) & mask);
+}
+
+// Writes the entries of a table, 13 to a line for 16-bit entries as in CRCLib.c
+static void PrintEntries(const uint32_t *const table, const uint16_t numEntries, const uint16_t width)
+{
+   const uint16_t entriesPerLine = (32U == width) ? 8U : 13U;
+
+   for (uint16_t i = 0U; i < numEntries; i++)
+   {
+      if (0U == (i % entriesPerLine))
+      {
+         printf("   ");
+      }
+
+      if (32U == width)
+      {
+         printf("0x%08lXUL", (unsigned long)table[i]);
+      }
+      else
+      {
+         printf("0x%04lXU", (unsigned long)table[i]);
+      }
+
+      if (i == (numEntries - 1U))
+      {
+         printf("};\n");
+      }
+      else if ((entriesPerLine - 1U) == (i % entriesPerLine))
+      {
+         printf(",\n");
+      }
+      else
+      {
+         printf(", ");
+      }
+   }
+}
+
+// Writes one table. 8-bit tables are also written with two entries in each
+// 16-bit word, the even index in the low byte, for CRCLIB_PACK_8BIT_TABLES.
+static void PrintTable(const TableDefinition_t *const definition, const uint32_t *const table)
+{
+   printf("\n// %s\n", definition->description);
+
+   if (32U == definition->width)
+   {
+      printf("const uint32_t %s[CRCLIB_TABLE_LENGTH] = {\n", definition->tableName);
+      PrintEntries(table, NUM_TABLE_ENTRIES, 32U);
+   }
+   else if (16U == definition->width)
+   {
+      printf("const uint16_t %s[CRCLIB_TABLE_LENGTH] = {\n", definition->tableName);
+      PrintEntries(table, NUM_TABLE_ENTRIES, 16U);
+   }
+   else
+   {
+      uint32_t packedTable[NUM_TABLE_ENTRIES / 2U];
+
+      for (uint16_t i = 0U; i < (NUM_TABLE_ENTRIES / 2U); i++)
+      {
+         packedTable[i] = table[2U * i] | (table[(2U * i) + 1U] << 8U);
+      }
+
+      printf("#if CRCLIB_PACK_8BIT_TABLES\n");
+      printf("const uint16_t %s[CRCLIB_TABLE8_LENGTH] = {\n", definition->tableName);
+      PrintEntries(packedTable, NUM_TABLE_ENTRIES / 2U, 16U);
+      printf("#else\n");
+      printf("const uint16_t %s[CRCLIB_TABLE8_LENGTH] = {\n", definition->tableName);
+      PrintEntries(table, NUM_TABLE_ENTRIES, 16U);
+      printf("#endif\n");
+   }
+}
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Host entry point
+int main(void)
+{
+   const size_t numDefinitions = sizeof(tableDefinitions) / sizeof(TableDefinition_t);
+   uint32_t tables[sizeof(tableDefinitions) / sizeof(TableDefinition_t)][NUM_TABLE_ENTRIES];
+   int exitCode = EXIT_SUCCESS;
+
+   // Check every table before writing anything
+   for (size_t i = 0U; i < numDefinitions; i++)
+   {
+      const uint32_t calculatedCRC = (BuildTable(&tableDefinitions[i], tables[i]),
+                                      CalculateWithTable(&tableDefinitions[i], tables[i], CHECK_STRING));
+
+      if (calculatedCRC != tableDefinitions[i].checkValue)
+      {
+         fprintf(stderr, "%s: check value 0x%lX, expected 0x%lX\n", tableDefinitions[i].tableName,
+                 (unsigned long)calculatedCRC, (unsigned long)tableDefinitions[i].checkValue);
+         exitCode = EXIT_FAILURE;
+      }
+   }
+
+   if (EXIT_SUCCESS == exitCode)
+   {
+      printf("/*******************************************************************************\n");
+      printf("// CRC Library Tables\n");
+      printf("// Generated by Tools/CRCLib_TableGen.c. Do not edit.\n");
+      printf("*******************************************************************************/\n");
+      printf("\n");
+      printf("/*******************************************************************************\n");
+      printf("// Includes\n");
+      printf("*******************************************************************************/\n");
+      printf("\n");
+      printf("// Module Includes\n");
+      printf("#include \"CRCLib_Tables.h\"\n");
+      printf("// Platform Includes\n");
+      printf("// Other Includes\n");
+      printf("#include <stdint.h>\n");
+      printf("\n");
+      printf("/*******************************************************************************\n");
+      printf("// Public Variable Definitions\n");
+      printf("*******************************************************************************/\n");
+
+      for (size_t i = 0U; i < numDefinitions; i++)
+      {
+         PrintTable(&tableDefinitions[i], tables[i]);
+      }
+   }
+
+   return(exitCode);
+}
@@ -0,0 +1,342 @@
+/*******************************************************************************
+// CRC Library Test
+// Host test of Src/CRCLib.c. The word at a time CRC16-CCITT and its streaming
+// context are compared with a CRC calculated one bit at a time, for every
+// length, seed and way of splitting the data. Every descriptor is checked
+// against its published check value and the same bit at a time CRC, with the
+// 8-bit tables in both layouts.
+//
+// Usage (from the repository root):
+//    cc -std=c99 -I Tools/Host -I Src -I Src/Boards/F28388D_controlCARD \
+//       -o crclib_test Tools/CRCLib_Test.c Tools/Host/Timebase_Host.c \
+//       Src/CRCLib.c Src/CRCLib_Tables.c Src/MessageRouter.c
+//    ./crclib_test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "CRCLib.h"
+#include "CRCLib_Tables.h"
+// Platform Includes
+// Other Includes
+#include <stdbool.h> // Defines C99 boolean type
+#include <stdint.h> // Defines C99 integer types
+#include <stdio.h>
+#include <stdlib.h> // C exit codes
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The number of bytes of test data
+#define TEST_DATA_LENGTH (256U)
+
+// Step between the words of the test data
+#define TEST_DATA_STEP (0x9E37U)
+
+// The number of bytes in the check data
+#define CHECK_DATA_LENGTH (9U)
+
+// The CRC16-CCITT polynomial
+#define CRC16_POLYNOMIAL (0x1021U)
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// A described CRC and what it is checked against
+typedef struct
+{
+   // Name used in the failure messages
+   const char *name;
+   const CRCLib_Descriptor_t *descriptor;
+   // Polynomial in normal form, most significant bit first
+   uint32_t polynomial;
+   // CRC of "123456789" from the published catalogue
+   uint32_t checkValue;
+} DescriptorTestItem_t;
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// Test data, two bytes per word, high byte first
+static uint16_t testData[TEST_DATA_LENGTH / 2U];
+
+// "123456789", the data of the published check values
+static const uint16_t checkData[(CHECK_DATA_LENGTH + 1U) / 2U] = {
+   0x3132U, 0x3334U, 0x3536U, 0x3738U, 0x3900U};
+
+// Seeds used for every check
+static const uint16_t testSeeds[] = { 0x0000U, 0xFFFFU, 0x1D0FU };
+
+// CRC-8/SMBUS with the table in the layout CRCLIB_PACK_8BIT_TABLES does not
+// select, built from the table that is selected
+static uint16_t otherLayoutTableCrc8[CRCLIB_TABLE_LENGTH];
+static CRCLib_Descriptor_t otherLayoutCrc8;
+
+// Every descriptor in CRCLib.h, and CRC-8/SMBUS in the other table layout
+static const DescriptorTestItem_t descriptorTestItems[] = {
+   { "crcLibCrc8", &crcLibCrc8, 0x07UL, 0xF4UL },
+   { "crcLibCrc8 other layout", &otherLayoutCrc8, 0x07UL, 0xF4UL },
+   { "crcLibCrc16Ccitt", &crcLibCrc16Ccitt, 0x1021UL, 0x29B1UL },
+   { "crcLibCrc16Modbus", &crcLibCrc16Modbus, 0x8005UL, 0x4B37UL },
+   { "crcLibCrc32", &crcLibCrc32, 0x04C11DB7UL, 0xCBF43926UL }};
+
+// The number of checks made and the number that failed
+static uint32_t numChecks;
+static uint32_t numFailures;
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Records the result of one check, describing it if it failed
+static void Check(const bool isPassed, const char *const name, const uint32_t value, const uint32_t calculated,
+                  const uint32_t expected)
+{
+   numChecks++;
+
+   if (!isPassed)
+   {
+      numFailures++;
+      fprintf(stderr, "%s (%lu): 0x%lX, expected 0x%lX\n", name, (unsigned long)value, (unsigned long)calculated,
+              (unsigned long)expected);
+   }
+}
+
+// Returns a byte of packed data, high byte of each word first
+static uint16_t GetByte(const uint16_t *const data, const uint16_t index)
+{
+   return((0U == (index & 1U)) ? (uint16_t)(data[index / 2U] >> 8U) : (uint16_t)(data[index / 2U] & 0xFFU));
+}
+
+// Calculates CRC16-CCITT one bit at a time, from its definition
+static uint16_t CalculateReference16(const uint16_t crcSeed, const uint16_t *const data, const uint16_t dataLength)
+{
+   uint16_t crc = crcSeed;
+
+   for (uint16_t i = 0U; i < dataLength; i++)
+   {
+      crc ^= (uint16_t)(GetByte(data, i) << 8U);
+      for (uint16_t bit = 0U; bit < 8U; bit++)
+      {
+         crc = (0U != (crc & 0x8000U)) ? (uint16_t)((crc << 1U) ^ CRC16_POLYNOMIAL) : (uint16_t)(crc << 1U);
+      }
+   }
+
+   return(crc);
+}
+
+// Returns the value with its lowest numBits bits in reverse order
+static uint32_t Reflect(const uint32_t value, const uint16_t numBits)
+{
+   uint32_t reflected = 0UL;
+
+   for (uint16_t i = 0U; i < numBits; i++)
+   {
+      if (0UL != (value & (1UL << i)))
+      {
+         reflected |= 1UL << (numBits - 1U - i);
+      }
+   }
+
+   return(reflected);
+}
+
+// Calculates a described CRC one bit at a time, from its definition
+static uint32_t CalculateReference(const DescriptorTestItem_t *const item, const uint16_t *const data,
+                                   const uint16_t dataLength)
+{
+   const CRCLib_Descriptor_t *const descriptor = item->descriptor;
+   const uint32_t mask = 0xFFFFFFFFUL >> (32U - descriptor->width);
+   const uint32_t topBit = 1UL << (descriptor->width - 1U);
+   uint32_t crc = descriptor->initialValue;
+
+   for (uint16_t i = 0U; i < dataLength; i++)
+   {
+      const uint32_t byte = GetByte(data, i);
+
+      if (descriptor->isReflected)
+      {
+         const uint32_t polynomial = Reflect(item->polynomial, descriptor->width);
+
+         crc ^= byte;
+         for (uint16_t bit = 0U; bit < 8U; bit++)
+         {
+            crc = (0UL != (crc & 1UL)) ? ((crc >> 1U) ^ polynomial) : (crc >> 1U);
+         }
+      }
+      else
+      {
+         crc ^= byte << (descriptor->width - 8U);
+         for (uint16_t bit = 0U; bit < 8U; bit++)
+         {
+            crc = (0UL != (crc & topBit)) ? ((crc << 1U) ^ item->polynomial) : (crc << 1U);
+         }
+      }
+
+      crc &= mask;
+   }
+
+   return((crc ^ descriptor->finalXor) & mask);
+}
+
+// Builds the CRC-8/SMBUS descriptor with the table in the other layout
+static void BuildOtherLayout(void)
+{
+   otherLayoutCrc8 = crcLibCrc8;
+   otherLayoutCrc8.isTablePacked = !crcLibCrc8.isTablePacked;
+   otherLayoutCrc8.table = otherLayoutTableCrc8;
+
+   for (uint16_t i = 0U; i < CRCLIB_TABLE_LENGTH; i++)
+   {
+      // Packed tables hold the even index in the low byte
+      const uint16_t entry = crcLibCrc8.isTablePacked ?
+                                ((0U == (i & 1U)) ? (crcLibTableCrc8[i / 2U] & 0xFFU) : (crcLibTableCrc8[i / 2U] >> 8U)) :
+                                crcLibTableCrc8[i];
+
+      if (otherLayoutCrc8.isTablePacked)
+      {
+         otherLayoutTableCrc8[i / 2U] |= (uint16_t)(entry << (8U * (i & 1U)));
+      }
+      else
+      {
+         otherLayoutTableCrc8[i] = entry;
+      }
+   }
+}
+
+// CRCLib_Calculate() must match the reference for every length, including
+// the odd lengths that end with the high byte of a word
+static void TestCalculate(void)
+{
+   for (size_t seedIndex = 0U; seedIndex < (sizeof(testSeeds) / sizeof(testSeeds[0])); seedIndex++)
+   {
+      for (uint16_t length = 0U; length <= TEST_DATA_LENGTH; length++)
+      {
+         const uint16_t expectedCRC = CalculateReference16(testSeeds[seedIndex], testData, length);
+         const uint16_t calculatedCRC = CRCLib_Calculate(testSeeds[seedIndex], testData, length);
+
+         Check(calculatedCRC == expectedCRC, "CRCLib_Calculate length", length, calculatedCRC, expectedCRC);
+      }
+   }
+
+   Check(CRCLib_Calculate(0xFFFFU, checkData, CHECK_DATA_LENGTH) == 0x29B1U, "CRCLib_Calculate check value",
+         CHECK_DATA_LENGTH, CRCLib_Calculate(0xFFFFU, checkData, CHECK_DATA_LENGTH), 0x29B1U);
+}
+
+// The streaming context must give the same CRC however the data is split.
+// Only the last update may have an odd length.
+static void TestContext(void)
+{
+   for (size_t seedIndex = 0U; seedIndex < (sizeof(testSeeds) / sizeof(testSeeds[0])); seedIndex++)
+   {
+      const uint16_t seed = testSeeds[seedIndex];
+      const uint16_t expectedCRC = CalculateReference16(seed, testData, TEST_DATA_LENGTH - 1U);
+      CRCLib_Context_t context;
+
+      // Split in two at every word boundary
+      for (uint16_t split = 0U; split < TEST_DATA_LENGTH; split += 2U)
+      {
+         CRCLib_Begin(&context, seed);
+         CRCLib_Update(&context, testData, split);
+         CRCLib_Update(&context, &testData[split / 2U], (TEST_DATA_LENGTH - 1U) - split);
+
+         Check(CRCLib_Finish(&context) == expectedCRC, "CRCLib_Update split", split, CRCLib_Finish(&context),
+               expectedCRC);
+      }
+
+      // One word at a time, then the odd byte
+      CRCLib_Begin(&context, seed);
+      for (uint16_t i = 0U; i < ((TEST_DATA_LENGTH / 2U) - 1U); i++)
+      {
+         CRCLib_Update(&context, &testData[i], 2U);
+      }
+      CRCLib_Update(&context, &testData[(TEST_DATA_LENGTH / 2U) - 1U], 1U);
+      Check(CRCLib_Finish(&context) == expectedCRC, "CRCLib_Update words", seed, CRCLib_Finish(&context), expectedCRC);
+
+      // One byte at a time, checking the CRC after each
+      CRCLib_Begin(&context, seed);
+      for (uint16_t i = 0U; i < TEST_DATA_LENGTH; i++)
+      {
+         const uint16_t byteCRC = CalculateReference16(seed, testData, i + 1U);
+
+         CRCLib_UpdateByte(&context, GetByte(testData, i));
+         Check(CRCLib_Finish(&context) == byteCRC, "CRCLib_UpdateByte length", i + 1U, CRCLib_Finish(&context),
+               byteCRC);
+      }
+   }
+}
+
+// Every descriptor must give its check value and match the reference for
+// every length, whether the data is passed in one call, in two or a byte at
+// a time
+static void TestDescriptors(void)
+{
+   for (size_t itemIndex = 0U; itemIndex < (sizeof(descriptorTestItems) / sizeof(DescriptorTestItem_t)); itemIndex++)
+   {
+      const DescriptorTestItem_t *const item = &descriptorTestItems[itemIndex];
+      CRCLib_ComputeContext_t context;
+
+      Check(CRCLib_Compute(item->descriptor, checkData, CHECK_DATA_LENGTH) == item->checkValue, item->name,
+            CHECK_DATA_LENGTH, CRCLib_Compute(item->descriptor, checkData, CHECK_DATA_LENGTH), item->checkValue);
+      Check(CalculateReference(item, checkData, CHECK_DATA_LENGTH) == item->checkValue, "reference", itemIndex,
+            CalculateReference(item, checkData, CHECK_DATA_LENGTH), item->checkValue);
+
+      for (uint16_t length = 0U; length <= TEST_DATA_LENGTH; length++)
+      {
+         const uint32_t expectedCRC = CalculateReference(item, testData, length);
+         const uint16_t split = (length / 2U) & ~1U;
+
+         Check(CRCLib_Compute(item->descriptor, testData, length) == expectedCRC, item->name, length,
+               CRCLib_Compute(item->descriptor, testData, length), expectedCRC);
+
+         // Split at a word boundary, since only the last update may be odd
+         CRCLib_ComputeBegin(&context, item->descriptor);
+         CRCLib_ComputeUpdate(&context, testData, split);
+         CRCLib_ComputeUpdate(&context, &testData[split / 2U], length - split);
+         Check(CRCLib_ComputeFinish(&context) == expectedCRC, item->name, length, CRCLib_ComputeFinish(&context),
+               expectedCRC);
+
+         CRCLib_ComputeBegin(&context, item->descriptor);
+         for (uint16_t i = 0U; i < length; i++)
+         {
+            CRCLib_ComputeUpdateByte(&context, GetByte(testData, i));
+         }
+         Check(CRCLib_ComputeFinish(&context) == expectedCRC, item->name, length, CRCLib_ComputeFinish(&context),
+               expectedCRC);
+      }
+   }
+
+   // The fast CRC16-CCITT path must agree with its descriptor
+   Check(CRCLib_Calculate(0xFFFFU, testData, TEST_DATA_LENGTH) ==
+            CRCLib_Compute(&crcLibCrc16Ccitt, testData, TEST_DATA_LENGTH),
+         "CRCLib_Calculate and crcLibCrc16Ccitt", TEST_DATA_LENGTH, CRCLib_Calculate(0xFFFFU, testData, TEST_DATA_LENGTH),
+         CRCLib_Compute(&crcLibCrc16Ccitt, testData, TEST_DATA_LENGTH));
+}
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Host entry point
+int main(void)
+{
+   for (uint16_t i = 0U; i < (TEST_DATA_LENGTH / 2U); i++)
+   {
+      testData[i] = (uint16_t)(i * TEST_DATA_STEP);
+   }
+
+   BuildOtherLayout();
+
+   TestCalculate();
+   TestContext();
+   TestDescriptors();
+
+   printf("%lu checks, %lu failed\n", (unsigned long)numChecks, (unsigned long)numFailures);
+
+   return((0U == numFailures) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,182 @@
+/*******************************************************************************
+// Coroutine Library Test
+// Host test of the macros in Src/CoroutineLib.h against a simulated clock. A
+// coroutine steps through every kind of wait, and each call must return the
+// expected status and resume from the expected point.
+//
+// Usage (from the repository root):
+//    cc -std=c99 -I Tools/Host -I Src -I Src/Boards/F28388D_controlCARD \
+//       -o coroutinelib_test Tools/CoroutineLib_Test.c Tools/Host/SysTick_Drv_Host.c \
+//       Tools/Host/Sys_Host.c Src/SoftTimerLib.c Src/Timebase.c Src/MessageRouter.c
+//    ./coroutinelib_test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "CoroutineLib.h"
+// Platform Includes
+#include "SysTick_Drv_Host.h"
+#include "Timebase.h"
+// Other Includes
+#include <stdbool.h> // Defines C99 boolean type
+#include <stdint.h> // Defines C99 integer types
+#include <stdio.h>
+#include <stdlib.h> // C exit codes
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The delay and timeout used by the test coroutine
+#define DELAY_MILLISECONDS (5U)
+#define TIMEOUT_MILLISECONDS (10U)
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The last step reached by the test coroutine
+static uint16_t step;
+
+// Conditions the test coroutine waits for
+static bool isReady;
+static bool isExitRequested;
+
+// The number of checks made and the number that failed
+static uint32_t numChecks;
+static uint32_t numFailures;
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Records the result of one check, describing it if it failed
+static void Check(const bool isPassed, const char *const name, const uint32_t value)
+{
+   numChecks++;
+
+   if (!isPassed)
+   {
+      numFailures++;
+      fprintf(stderr, "%s (%lu) failed\n", name, (unsigned long)value);
+   }
+}
+
+// Lets whole milliseconds pass on the simulated clock
+static void AdvanceMilliseconds(const uint32_t milliseconds)
+{
+   SysTick_Drv_Host_AdvanceCycles(milliseconds * (uint32_t)TIMEBASE_NUM_CYCLES_PER_MILLISECOND);
+}
+
+// Steps through every kind of wait. Each step is recorded before the wait
+// that follows it, so the step shows where the coroutine resumes.
+static CoroutineLib_Status_t TestCoroutine(CoroutineLib_Context_t *const context)
+{
+   COROUTINELIB_BEGIN(context);
+
+   step = 1U;
+   COROUTINELIB_YIELD(context);
+
+   step = 2U;
+   COROUTINELIB_WAIT_UNTIL(context, isReady);
+
+   step = 3U;
+   COROUTINELIB_DELAY(context, DELAY_MILLISECONDS);
+
+   step = 4U;
+   COROUTINELIB_WAIT_UNTIL_TIMEOUT(context, !isReady, TIMEOUT_MILLISECONDS);
+   if (!COROUTINELIB_IS_TIMED_OUT(context))
+   {
+      step = 0xFFFFU;
+   }
+
+   step = 5U;
+   COROUTINELIB_WAIT_UNTIL_TIMEOUT(context, isExitRequested, TIMEOUT_MILLISECONDS);
+   if (COROUTINELIB_IS_TIMED_OUT(context))
+   {
+      step = 0xFFFFU;
+   }
+   else if (isReady)
+   {
+      step = 6U;
+      COROUTINELIB_EXIT(context);
+   }
+
+   step = 7U;
+   COROUTINELIB_END(context);
+}
+
+// Calls the coroutine and checks the status and the step it stopped at
+static void Call(CoroutineLib_Context_t *const context, const CoroutineLib_Status_t expectedStatus,
+                 const uint16_t expectedStep, const char *const name)
+{
+   const CoroutineLib_Status_t status = TestCoroutine(context);
+
+   Check((expectedStatus == status) && (expectedStep == step), name, step);
+}
+
+// Runs the coroutine from start to end, ending with an exit or the end of
+// the body
+static void TestSequence(const bool isExitTaken)
+{
+   CoroutineLib_Context_t context;
+
+   COROUTINELIB_INIT(&context);
+   step = 0U;
+   isReady = false;
+   isExitRequested = false;
+
+   Call(&context, COROUTINELIB_STATUS_YIELDED, 1U, "Yield");
+   Call(&context, COROUTINELIB_STATUS_WAITING, 2U, "Wait until not ready");
+   Call(&context, COROUTINELIB_STATUS_WAITING, 2U, "Wait until still not ready");
+   isReady = true;
+
+   // The delay starts on the call that reaches it and ends once it has elapsed
+   Call(&context, COROUTINELIB_STATUS_WAITING, 3U, "Delay start");
+   AdvanceMilliseconds(DELAY_MILLISECONDS - 1U);
+   Call(&context, COROUTINELIB_STATUS_WAITING, 3U, "Delay not elapsed");
+   AdvanceMilliseconds(1U);
+
+   // The condition stays false, so the wait ends on its timeout
+   Call(&context, COROUTINELIB_STATUS_WAITING, 4U, "Timeout start");
+   AdvanceMilliseconds(TIMEOUT_MILLISECONDS - 1U);
+   Call(&context, COROUTINELIB_STATUS_WAITING, 4U, "Timeout not elapsed");
+   AdvanceMilliseconds(1U);
+
+   // The condition comes true before the timeout
+   Call(&context, COROUTINELIB_STATUS_WAITING, 5U, "Timeout wait start");
+   AdvanceMilliseconds(TIMEOUT_MILLISECONDS - 1U);
+   isExitRequested = true;
+   isReady = isExitTaken;
+   if (isExitTaken)
+   {
+      Call(&context, COROUTINELIB_STATUS_EXITED, 6U, "Exit");
+   }
+   else
+   {
+      Call(&context, COROUTINELIB_STATUS_ENDED, 7U, "End");
+   }
+
+   // Either way the coroutine starts again from the beginning
+   Check(COROUTINELIB_RESUME_POINT_START == context.resumePoint, "Reset after finishing", context.resumePoint);
+   Call(&context, COROUTINELIB_STATUS_YIELDED, 1U, "Restart");
+}
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Host entry point
+int main(void)
+{
+   (void)Timebase_Init(0U, NULL);
+
+   TestSequence(false);
+   TestSequence(true);
+
+   printf("%lu checks, %lu failed\n", (unsigned long)numChecks, (unsigned long)numFailures);
+
+   return((0U == numFailures) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
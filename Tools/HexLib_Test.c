@@ -0,0 +1,209 @@
+/*******************************************************************************
+// Hex Codec Library Test
+// Host test of Src/HexLib.c. Every byte value is encoded and decoded, in upper
+// and lower case, for every length up to 256 bytes, and every character that
+// is not a hex digit must be reported wherever it appears.
+//
+// Usage (from the repository root):
+//    cc -std=c99 -I Tools/Host -I Src -I Src/Boards/F28388D_controlCARD \
+//       -o hexlib_test Tools/HexLib_Test.c Tools/Host/Timebase_Host.c \
+//       Src/HexLib.c Src/MessageRouter.c
+//    ./hexlib_test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "HexLib.h"
+// Platform Includes
+// Other Includes
+#include <stdbool.h> // Defines C99 boolean type
+#include <stdint.h> // Defines C99 integer types
+#include <stdio.h>
+#include <stdlib.h> // C exit codes
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The number of byte values, and of bytes in the test data
+#define NUM_BYTE_VALUES (256U)
+
+// The most characters checked for being a hex digit, which includes
+// characters wider than a byte
+#define NUM_CHAR_VALUES (0x200U)
+
+// Written after the end of every result to check nothing more is written
+#define GUARD_VALUE (0xA5A5U)
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// Every byte value in order, packed low byte first
+static uint16_t testData[NUM_BYTE_VALUES / 2U];
+
+// Characters for the test data, with room for a guard
+static uint16_t testChars[(HEXLIB_CHARS_PER_BYTE * NUM_BYTE_VALUES) + 1U];
+
+// Decoded bytes, with room for a guard
+static uint16_t testResult[(NUM_BYTE_VALUES / 2U) + 1U];
+
+// The number of checks made and the number that failed
+static uint32_t numChecks;
+static uint32_t numFailures;
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Records the result of one check, describing it if it failed
+static void Check(const bool isPassed, const char *const name, const uint32_t value)
+{
+   numChecks++;
+
+   if (!isPassed)
+   {
+      numFailures++;
+      fprintf(stderr, "%s (0x%lX) failed\n", name, (unsigned long)value);
+   }
+}
+
+// Returns the character for a nibble, in upper or lower case
+static uint16_t GetHexChar(const uint16_t nibble, const bool isLowerCase)
+{
+   const char *const digits = isLowerCase ? "0123456789abcdef" : "0123456789ABCDEF";
+
+   return((uint16_t)(unsigned char)digits[nibble & 0x0FU]);
+}
+
+// Returns true if the character is a hex digit in either case
+static bool IsHexChar(const uint16_t hexChar)
+{
+   return(((hexChar >= '0') && (hexChar <= '9')) || ((hexChar >= 'A') && (hexChar <= 'F')) ||
+          ((hexChar >= 'a') && (hexChar <= 'f')));
+}
+
+// Returns a byte of packed data, low byte of each word first
+static uint16_t GetByte(const uint16_t *const data, const uint16_t index)
+{
+   return((0U == (index & 1U)) ? (uint16_t)(data[index / 2U] & 0xFFU) : (uint16_t)(data[index / 2U] >> 8U));
+}
+
+// Writes the characters of the test data, high nibble of each byte first
+static void EncodeReference(uint16_t *const hexChars, const uint16_t numBytes, const bool isLowerCase)
+{
+   for (uint16_t i = 0U; i < numBytes; i++)
+   {
+      hexChars[HEXLIB_CHARS_PER_BYTE * i] = GetHexChar(GetByte(testData, i) >> 4U, isLowerCase);
+      hexChars[(HEXLIB_CHARS_PER_BYTE * i) + 1U] = GetHexChar(GetByte(testData, i), isLowerCase);
+   }
+}
+
+// Every length must encode to the reference characters and decode back to
+// the same bytes, without writing past the end. An odd length clears the
+// high byte of the last word.
+static void TestLengths(const bool isLowerCase)
+{
+   for (uint16_t length = 0U; length <= NUM_BYTE_VALUES; length++)
+   {
+      uint16_t expectedChars[HEXLIB_CHARS_PER_BYTE * NUM_BYTE_VALUES];
+      bool isMatch = true;
+
+      EncodeReference(expectedChars, length, isLowerCase);
+
+      if (!isLowerCase)
+      {
+         testChars[HEXLIB_CHARS_PER_BYTE * length] = GUARD_VALUE;
+         HexLib_Encode(testChars, testData, length);
+         for (uint16_t i = 0U; i < (HEXLIB_CHARS_PER_BYTE * length); i++)
+         {
+            isMatch = isMatch && (testChars[i] == expectedChars[i]);
+         }
+         Check(isMatch && (testChars[HEXLIB_CHARS_PER_BYTE * length] == GUARD_VALUE), "HexLib_Encode length", length);
+      }
+
+      for (uint16_t i = 0U; i < ((NUM_BYTE_VALUES / 2U) + 1U); i++)
+      {
+         testResult[i] = GUARD_VALUE;
+      }
+
+      isMatch = HexLib_Decode(testResult, expectedChars, length);
+      for (uint16_t i = 0U; i < (length / 2U); i++)
+      {
+         isMatch = isMatch && (testResult[i] == testData[i]);
+      }
+      if (0U != (length & 1U))
+      {
+         isMatch = isMatch && (testResult[length / 2U] == (testData[length / 2U] & 0x00FFU));
+      }
+      Check(isMatch && (testResult[(length + 1U) / 2U] == GUARD_VALUE),
+            isLowerCase ? "HexLib_Decode lower case length" : "HexLib_Decode length", length);
+   }
+}
+
+// A character that is not a hex digit must be reported in either half of a
+// byte and in either byte of a word, and every hex digit must be accepted
+static void TestMalformed(void)
+{
+   for (uint16_t hexChar = 0U; hexChar < NUM_CHAR_VALUES; hexChar++)
+   {
+      for (uint16_t position = 0U; position < 4U; position++)
+      {
+         uint16_t hexChars[4];
+
+         for (uint16_t i = 0U; i < 4U; i++)
+         {
+            hexChars[i] = (i == position) ? hexChar : (uint16_t)'0';
+         }
+
+         Check(HexLib_Decode(testResult, hexChars, 2U) == IsHexChar(hexChar), "HexLib_Decode character", hexChar);
+         Check(HexLib_Decode(testResult, &hexChars[position & 2U], 1U) == IsHexChar(hexChar),
+               "HexLib_Decode odd length character", hexChar);
+      }
+   }
+}
+
+// Header fields of up to 4 digits, most significant first
+static void TestDecodeValue(void)
+{
+   static const uint16_t valueChars[] = { '1', 'A', '2', 'b', '3' };
+   uint16_t value = 0U;
+
+   Check(HexLib_DecodeValue(&value, valueChars, 0U) && (0x0000U == value), "HexLib_DecodeValue length", 0U);
+   Check(HexLib_DecodeValue(&value, valueChars, 1U) && (0x0001U == value), "HexLib_DecodeValue length", 1U);
+   Check(HexLib_DecodeValue(&value, valueChars, 2U) && (0x001AU == value), "HexLib_DecodeValue length", 2U);
+   Check(HexLib_DecodeValue(&value, valueChars, 3U) && (0x01A2U == value), "HexLib_DecodeValue length", 3U);
+   Check(HexLib_DecodeValue(&value, valueChars, 4U) && (0x1A2BU == value), "HexLib_DecodeValue length", 4U);
+   Check(!HexLib_DecodeValue(&value, valueChars, 5U), "HexLib_DecodeValue length", 5U);
+
+   for (uint16_t hexChar = 0U; hexChar < NUM_CHAR_VALUES; hexChar++)
+   {
+      const uint16_t hexChars[4] = { '0', '0', hexChar, '0' };
+
+      Check(HexLib_DecodeValue(&value, hexChars, 4U) == IsHexChar(hexChar), "HexLib_DecodeValue character", hexChar);
+   }
+}
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Host entry point
+int main(void)
+{
+   for (uint16_t i = 0U; i < (NUM_BYTE_VALUES / 2U); i++)
+   {
+      testData[i] = (uint16_t)((((2U * i) + 1U) << 8U) | (2U * i));
+   }
+
+   TestLengths(false);
+   TestLengths(true);
+   TestMalformed();
+   TestDecodeValue();
+
+   printf("%lu checks, %lu failed\n", (unsigned long)numChecks, (unsigned long)numFailures);
+
+   return((0U == numFailures) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,17 @@
+/*******************************************************************************
+// Host Interrupt Driver Definitions
+// Stands in for the interrupt driver of the target when library modules are
+// built on a host by the tests in Tools.
+*******************************************************************************/
+// Prevent multiple inclusion of header file
+#pragma once
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// Interrupt handlers are ordinary functions on a host
+#define __interrupt
+
+// Marks an interrupt service routine on the target
+#define INTERRUPT_FUNC
@@ -0,0 +1,17 @@
+/*******************************************************************************
+// Host Platform Definitions
+// Stands in for the compiler and device headers of the target when library
+// modules are built on a host by the tests in Tools. Only what those modules
+// use is defined.
+*******************************************************************************/
+// Prevent multiple inclusion of header file
+#pragma once
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// Byte k of the memory at p, counting the low byte of each 16-bit word first
+// as the C28x intrinsic does. Hosts are little endian, so this is the same
+// byte of the host memory.
+#define __byte(p, k) (((unsigned char *)(p))[(k)])
@@ -0,0 +1,74 @@
+/*******************************************************************************
+// Host System Tick Driver
+// A simulated cycle counter for the tests in Tools. Link this instead of
+// Timebase_Host.c when the test also links Src/Timebase.c.
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "SysTick_Drv_Host.h"
+// Platform Includes
+// Other Includes
+#include <stdbool.h> // Defines C99 boolean type
+#include <stdint.h> // Defines C99 integer types
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The simulated free-running cycle counter
+static SysTick_Drv_CycleCount_t cycleCount;
+
+// The delay given to the last wakeup request
+static SysTick_Drv_CycleCount_t wakeupCycles;
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Nothing to configure on a host
+bool SysTick_Drv_Init(const uint32_t moduleID, const SysTick_Drv_Config_t *configData)
+{
+   (void)moduleID;
+   (void)configData;
+
+   return(true);
+}
+
+// The counter is always running on a host
+void SysTick_Drv_SetEnableState(bool enableState)
+{
+   (void)enableState;
+}
+
+// Returns the simulated cycle counter
+SysTick_Drv_CycleCount_t SysTick_Drv_GetCycleCount(void)
+{
+   return(cycleCount);
+}
+
+// Records the delay so a test can check it
+void SysTick_Drv_StartWakeupTimer(const SysTick_Drv_CycleCount_t delayCycles)
+{
+   wakeupCycles = delayCycles;
+}
+
+// Move the simulated cycle counter forward
+void SysTick_Drv_Host_AdvanceCycles(const SysTick_Drv_CycleCount_t numCycles)
+{
+   cycleCount += numCycles;
+}
+
+// Set the simulated cycle counter
+void SysTick_Drv_Host_SetCycleCount(const SysTick_Drv_CycleCount_t newCycleCount)
+{
+   cycleCount = newCycleCount;
+}
+
+// The delay given to the last wakeup request
+SysTick_Drv_CycleCount_t SysTick_Drv_Host_GetWakeupCycles(void)
+{
+   return(wakeupCycles);
+}
@@ -0,0 +1,30 @@
+/*******************************************************************************
+// Host System Tick Driver
+// Replaces the free-running cycle counter of the target with a simulated one
+// when modules that keep time are built on a host by the tests in Tools. The
+// counter only moves when a test advances it, so every run is repeatable.
+*******************************************************************************/
+// Prevent multiple inclusion of header file
+#pragma once
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "SysTick_Drv.h"
+// Platform Includes
+// Other Includes
+#include <stdint.h> // Defines C99 integer types
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+// Move the simulated cycle counter forward, wrapping as the hardware does
+void SysTick_Drv_Host_AdvanceCycles(const SysTick_Drv_CycleCount_t numCycles);
+
+// Set the simulated cycle counter, such as to just before it wraps
+void SysTick_Drv_Host_SetCycleCount(const SysTick_Drv_CycleCount_t cycleCount);
+
+// The delay given to the last SysTick_Drv_StartWakeupTimer() call
+SysTick_Drv_CycleCount_t SysTick_Drv_Host_GetWakeupCycles(void);
@@ -0,0 +1,46 @@
+/*******************************************************************************
+// Host System Services
+// Stands in for the interrupt and critical section services of the target
+// when modules are built on a host by the tests in Tools. A host test runs on
+// one thread without interrupts, so there is nothing to protect.
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "Sys.h"
+// Platform Includes
+// Other Includes
+#include <stdbool.h> // Defines C99 boolean type
+#include <stdint.h> // Defines C99 integer types
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Interrupts are never raised on a host
+void Sys_RegisterInterrupt(const uint32_t interruptNumber, void (*handler)(void))
+{
+   (void)interruptNumber;
+   (void)handler;
+}
+
+// Interrupts are never raised on a host
+void Sys_SetInterruptEnableState(const uint32_t interruptNumber, const bool enableState)
+{
+   (void)interruptNumber;
+   (void)enableState;
+}
+
+// Nothing can interrupt a host test
+uint16_t Sys_EnterCritical(void)
+{
+   return(0U);
+}
+
+// Nothing can interrupt a host test
+void Sys_ExitCritical(const uint16_t interruptState)
+{
+   (void)interruptState;
+}
@@ -0,0 +1,25 @@
+/*******************************************************************************
+// Host Timebase
+// Provides the cycle counter used by the benchmark commands when library
+// modules are built on a host by the tests in Tools.
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "Timebase.h"
+// Platform Includes
+// Other Includes
+#include <stdint.h> // Defines C99 integer types
+#include <time.h>
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// The processor time used so far, in the units of clock()
+Timebase_CycleCount_t Timebase_GetCycleCount(void)
+{
+   return((Timebase_CycleCount_t)clock());
+}
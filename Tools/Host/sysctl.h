@@ -0,0 +1,17 @@
+/*******************************************************************************
+// Host System Control Definitions
+// Stands in for the TI System Control Library when library modules are built
+// on a host by the tests in Tools. Only the standard headers it brings in are
+// needed there.
+*******************************************************************************/
+// Prevent multiple inclusion of header file
+#pragma once
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+// Platform Includes
+// Other Includes
+#include <stdbool.h> // Defines C99 boolean type
+#include <stdint.h> // Defines C99 integer types
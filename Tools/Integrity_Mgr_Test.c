@@ -0,0 +1,283 @@
+/*******************************************************************************
+// Integrity Manager Test
+// Host test of the chunked check in Src/Integrity_Mgr.c. On a host each chunk
+// is calculated in software, so the chunking is checked on its own: regions
+// whose lengths are not a whole number of 128 word blocks are checked with
+// several values of blocksPerPass, and the CRC of every complete check must
+// match a single calculation over the whole region. A wrong expected CRC and
+// regions that cannot be checked must raise ERROR_MGR_ERROR_INTEGRITY.
+//
+// Usage (from the repository root):
+//    cc -std=c99 -I Tools/Host -I Src -I Src/Boards/F28388D_controlCARD \
+//       -o integrity_mgr_test Tools/Integrity_Mgr_Test.c Src/Integrity_Mgr.c Src/MessageRouter.c
+//    ./integrity_mgr_test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "Integrity_Mgr.h"
+// Platform Includes
+#include "Error_Mgr.h"
+#include "MemoryCRC_Drv.h"
+// Other Includes
+#include <stdbool.h> // Defines C99 boolean type
+#include <stddef.h> // Defines NULL
+#include <stdint.h> // Defines C99 integer types
+#include <stdio.h>
+#include <stdlib.h> // C exit codes
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The module identifier given to the module under test
+#define TEST_MODULE_ID (7U)
+
+// The number of words of memory the regions are taken from
+#define MEMORY_NUM_WORDS (4096U)
+
+// The lengths of the three test regions, none a whole number of blocks
+#define FIRST_REGION_NUM_WORDS (1000U)
+#define SECOND_REGION_NUM_WORDS (129U)
+#define THIRD_REGION_NUM_WORDS (77U)
+
+// The number of complete checks of every region made by each test
+#define NUM_CYCLES (3U)
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The memory the regions are taken from
+static uint16_t memory[MEMORY_NUM_WORDS];
+
+// The expected CRCs of the regions, as stamped at build time
+static volatile uint32_t expectedCrcs[INTEGRITY_MGR_REGION_ID_COUNT];
+
+// The regions given to the module
+static Integrity_Mgr_RegionConfig_t regionConfigs[INTEGRITY_MGR_REGION_ID_COUNT];
+
+// The calls made to Error_Mgr_SetErrorState()
+static uint32_t numErrorCalls;
+static bool isErrorCallValid;
+
+// The number of checks made and the number that failed
+static uint32_t numChecks;
+static uint32_t numFailures;
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Records the result of one check, describing it if it failed
+static void Check(const bool isPassed, const char *const name, const uint32_t value)
+{
+   numChecks++;
+
+   if (!isPassed)
+   {
+      numFailures++;
+      fprintf(stderr, "%s (%lu) failed\n", name, (unsigned long)value);
+   }
+}
+
+// CRC32 with the polynomial 0x04C11DB7, a seed of 0, no reflection and no
+// final XOR, calculated a byte at a time
+static uint32_t CalculateReferenceByte(uint32_t crc, const uint16_t byte)
+{
+   crc ^= (uint32_t)byte << 24U;
+
+   for (uint16_t bitIndex = 0U; bitIndex < 8U; bitIndex++)
+   {
+      crc = (0UL != (crc & 0x80000000UL)) ? ((crc << 1U) ^ 0x04C11DB7UL) : (crc << 1U);
+   }
+
+   return(crc);
+}
+
+// The CRC of a whole region in one pass, low byte of each word first as the
+// CRC engine reads it
+static uint32_t CalculateReference(const uint16_t *const data, const uint32_t numWords)
+{
+   uint32_t crc = 0UL;
+
+   for (uint32_t i = 0UL; i < numWords; i++)
+   {
+      crc = CalculateReferenceByte(crc, data[i] & 0x00FFU);
+      crc = CalculateReferenceByte(crc, data[i] >> 8U);
+   }
+
+   return(crc);
+}
+
+// Sets up the three test regions with the given expected CRCs
+static Integrity_Mgr_Config_t ConfigureRegions(const uint16_t blocksPerPass)
+{
+   static const uint32_t offsets[INTEGRITY_MGR_REGION_ID_COUNT] = { 0U, 1024U, 2048U };
+   static const uint32_t lengths[INTEGRITY_MGR_REGION_ID_COUNT] =
+   {
+      FIRST_REGION_NUM_WORDS, SECOND_REGION_NUM_WORDS, THIRD_REGION_NUM_WORDS
+   };
+   const Integrity_Mgr_Config_t config = { INTEGRITY_MGR_REGION_ID_COUNT, regionConfigs, blocksPerPass };
+
+   for (uint16_t i = 0U; i < INTEGRITY_MGR_REGION_ID_COUNT; i++)
+   {
+      regionConfigs[i].regionId = (Integrity_Mgr_RegionId_t)i;
+      regionConfigs[i].startAddress = &memory[offsets[i]];
+      regionConfigs[i].endAddress = &memory[offsets[i] + lengths[i]];
+      regionConfigs[i].expectedCrc = &expectedCrcs[i];
+      expectedCrcs[i] = CalculateReference(&memory[offsets[i]], lengths[i]);
+   }
+
+   return(config);
+}
+
+// The number of calls of Integrity_Mgr_Update() that read a region
+static uint32_t GetNumChunks(const uint16_t regionIndex, const uint16_t blocksPerPass)
+{
+   const uint32_t chunkNumWords = (uint32_t)blocksPerPass * MEMORYCRC_DRV_BLOCK_NUM_WORDS;
+   const uint32_t numWords = (uint32_t)(regionConfigs[regionIndex].endAddress - regionConfigs[regionIndex].startAddress);
+
+   return((numWords + chunkNumWords - 1UL) / chunkNumWords);
+}
+
+// Checks every region a few times in chunks of the given size, with the
+// expected CRC of one region wrong if corruptIndex is a region
+static void TestChunking(const uint16_t blocksPerPass, const uint16_t corruptIndex)
+{
+   Integrity_Mgr_Config_t config = ConfigureRegions(blocksPerPass);
+   uint32_t numCycleUpdates = 0UL;
+   Integrity_Mgr_RegionStatus_t regionStatus;
+
+   for (uint16_t i = 0U; i < INTEGRITY_MGR_REGION_ID_COUNT; i++)
+   {
+      numCycleUpdates += GetNumChunks(i, blocksPerPass);
+   }
+
+   if (corruptIndex < INTEGRITY_MGR_REGION_ID_COUNT)
+   {
+      expectedCrcs[corruptIndex] ^= 0x00010000UL;
+   }
+
+   numErrorCalls = 0U;
+   Check(Integrity_Mgr_Init(TEST_MODULE_ID, &config) && (0U == numErrorCalls), "Init", blocksPerPass);
+
+   // The first call only starts a chunk, and each later call reads one
+   // chunk of at most blocksPerPass blocks. A region read in larger chunks
+   // would be checked more often than expected, and in smaller chunks less.
+   for (uint32_t i = 0UL; i < ((NUM_CYCLES * numCycleUpdates) + 1UL); i++)
+   {
+      Integrity_Mgr_Update();
+   }
+
+   for (uint16_t i = 0U; i < INTEGRITY_MGR_REGION_ID_COUNT; i++)
+   {
+      const bool isCorrupt = (i == corruptIndex);
+      const uint32_t numWords = (uint32_t)(regionConfigs[i].endAddress - regionConfigs[i].startAddress);
+      const uint32_t referenceCrc = CalculateReference(regionConfigs[i].startAddress, numWords);
+
+      Check(Integrity_Mgr_GetRegionStatus((Integrity_Mgr_RegionId_t)i, &regionStatus), "Region checked", i);
+      Check(NUM_CYCLES == regionStatus.numChecks, "Number of checks", regionStatus.numChecks);
+      Check(referenceCrc == regionStatus.calculatedCrc, "Chunked CRC", blocksPerPass);
+      Check(isCorrupt != regionStatus.isMatch, "Match", i);
+      Check((isCorrupt ? NUM_CYCLES : 0U) == regionStatus.numFailures, "Number of failures", regionStatus.numFailures);
+   }
+
+   // Each failed check raises the error again, and a good check never does
+   Check(((corruptIndex < INTEGRITY_MGR_REGION_ID_COUNT) ? NUM_CYCLES : 0U) == numErrorCalls,
+         "Mismatch raises error", numErrorCalls);
+   Check(isErrorCallValid, "Error arguments", numErrorCalls);
+}
+
+// Regions that cannot be checked are skipped and raise the error
+static void TestInvalidRegions(void)
+{
+   Integrity_Mgr_Config_t config = ConfigureRegions(1U);
+   Integrity_Mgr_RegionStatus_t regionStatus;
+
+   // A region with no words is skipped, and the others are still checked
+   regionConfigs[1].endAddress = regionConfigs[1].startAddress;
+   numErrorCalls = 0U;
+   isErrorCallValid = true;
+   Check(Integrity_Mgr_Init(TEST_MODULE_ID, &config) && (1U == numErrorCalls) && isErrorCallValid,
+         "Empty region raises error", numErrorCalls);
+
+   for (uint16_t i = 0U; i < 32U; i++)
+   {
+      Integrity_Mgr_Update();
+   }
+   (void)Integrity_Mgr_GetRegionStatus(INTEGRITY_MGR_REGION_ID_APP_IMAGE, &regionStatus);
+   Check((regionStatus.numChecks > 0U) && regionStatus.isMatch, "Valid region still checked", regionStatus.numChecks);
+   (void)Integrity_Mgr_GetRegionStatus((Integrity_Mgr_RegionId_t)1, &regionStatus);
+   Check(0U == regionStatus.numChecks, "Empty region skipped", regionStatus.numChecks);
+   Check(1U == numErrorCalls, "No further errors", numErrorCalls);
+
+   // A region with no expected CRC, or with an end before its start
+   regionConfigs[0].expectedCrc = NULL;
+   regionConfigs[2].endAddress = regionConfigs[2].startAddress - 1;
+   numErrorCalls = 0U;
+   Check(!Integrity_Mgr_Init(TEST_MODULE_ID, &config) && (INTEGRITY_MGR_REGION_ID_COUNT == numErrorCalls) &&
+         isErrorCallValid, "No valid region fails", numErrorCalls);
+
+   // An unknown region identifier
+   config = ConfigureRegions(1U);
+   regionConfigs[2].regionId = INTEGRITY_MGR_REGION_ID_COUNT;
+   numErrorCalls = 0U;
+   Check(Integrity_Mgr_Init(TEST_MODULE_ID, &config) && (1U == numErrorCalls) && isErrorCallValid,
+         "Unknown region raises error", numErrorCalls);
+
+   // The most blocks per pass is limited by the CRC engine
+   config = ConfigureRegions(MEMORYCRC_DRV_MAX_NUM_BLOCKS + 1U);
+   Check(!Integrity_Mgr_Init(TEST_MODULE_ID, &config), "Too many blocks per pass", config.blocksPerPass);
+   config.blocksPerPass = 0U;
+   Check(!Integrity_Mgr_Init(TEST_MODULE_ID, &config), "No blocks per pass", config.blocksPerPass);
+}
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Stands in for the error manager, recording that the integrity error was
+// raised by the module under test
+void Error_Mgr_SetErrorState(const uint32_t moduleID, const Error_Mgr_Error_t error, const bool newState)
+{
+   numErrorCalls++;
+   isErrorCallValid = isErrorCallValid && (TEST_MODULE_ID == moduleID) && (ERROR_MGR_ERROR_INTEGRITY == error) && newState;
+}
+
+// Host entry point
+int main(void)
+{
+   // The blocks per pass include one that reads each region in one chunk
+   static const uint16_t blocksPerPassValues[] = { 1U, 2U, 3U, 7U, 8U, MEMORYCRC_DRV_MAX_NUM_BLOCKS };
+   static const uint8_t checkData[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+   uint32_t crc = 0UL;
+
+   // The reference is CRC-32/CKSUM without its final XOR
+   for (uint16_t i = 0U; i < sizeof(checkData); i++)
+   {
+      crc = CalculateReferenceByte(crc, checkData[i]);
+   }
+   Check((UINT32_C(0x765E7680) ^ UINT32_C(0xFFFFFFFF)) == crc, "Reference check value", crc);
+
+   srand(1U);
+   for (uint32_t i = 0UL; i < MEMORY_NUM_WORDS; i++)
+   {
+      memory[i] = (uint16_t)rand();
+   }
+
+   isErrorCallValid = true;
+   for (uint16_t i = 0U; i < (sizeof(blocksPerPassValues) / sizeof(blocksPerPassValues[0])); i++)
+   {
+      TestChunking(blocksPerPassValues[i], INTEGRITY_MGR_REGION_ID_COUNT);
+      TestChunking(blocksPerPassValues[i], (uint16_t)(i % INTEGRITY_MGR_REGION_ID_COUNT));
+   }
+
+   TestInvalidRegions();
+
+   printf("%lu checks, %lu failed\n", (unsigned long)numChecks, (unsigned long)numFailures);
+
+   return((0U == numFailures) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,486 @@
+/*******************************************************************************
+// Ring Buffer Test
+// Host test of Src/RingBuffer.c. Block and span reads and writes are checked
+// where they split at the end of the data buffer and where the free-running
+// indices wrap, along with the OVERWRITE, REJECT and COUNT_DROPS policies.
+// A long run of random operations on each policy is compared with a simple
+// model of the FIFO.
+// Finally the same data is moved through a buffer one element at a time, as
+// blocks and in place through the spans, and the time taken by each is
+// printed for comparison.
+//
+// Usage (from the repository root):
+//    cc -std=c99 -O2 -I Tools/Host -I Src -o ringbuffer_test Tools/RingBuffer_Test.c Src/RingBuffer.c
+//    ./ringbuffer_test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "RingBuffer.h"
+// Platform Includes
+// Other Includes
+#include <stdbool.h> // Defines C99 boolean type
+#include <stdint.h> // Defines C99 integer types
+#include <stdio.h>
+#include <stdlib.h> // C exit codes
+#include <time.h> // Host processor time
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// Size of the ring buffer used by the tests
+#define BUFFER_SIZE (16U)
+
+// Size of the ring buffer used by the benchmark
+#define BENCHMARK_BUFFER_SIZE (64U)
+
+// Number of elements moved through the benchmark buffer at a time
+#define BENCHMARK_BLOCK_LENGTH (32U)
+
+// Number of blocks moved through the benchmark buffer by each method
+#define BENCHMARK_NUM_BLOCKS (1000000UL)
+
+// Number of random operations compared with the model for each policy
+#define NUM_RANDOM_OPERATIONS (200000UL)
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The ring buffer and data buffer used by every test
+static RingBuffer_t ringBuffer;
+static RingBuffer_Data_t ringBufferData[BENCHMARK_BUFFER_SIZE];
+
+// The number of checks made and the number that failed
+static uint32_t numChecks;
+static uint32_t numFailures;
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Records the result of one check, describing it if it failed
+static void Check(const bool isPassed, const char *const name, const uint32_t value)
+{
+   numChecks++;
+
+   if (!isPassed)
+   {
+      numFailures++;
+      fprintf(stderr, "%s (%lu) failed\n", name, (unsigned long)value);
+   }
+}
+
+// Starts an empty test buffer with both indices at the given value, so the
+// next element is stored at that position and the indices wrap after it
+static void Start(const RingBuffer_OverflowPolicy_t policy, const uint16_t index)
+{
+   (void)RingBuffer_Init(&ringBuffer, ringBufferData, BUFFER_SIZE, policy);
+   ringBuffer.readIndex = index;
+   ringBuffer.writeIndex = index;
+}
+
+// Fills a block with consecutive values from the given first value
+static void FillBlock(RingBuffer_Data_t *const block, const uint16_t length, const RingBuffer_Data_t first)
+{
+   for (uint16_t i = 0U; i < length; i++)
+   {
+      block[i] = first + i;
+   }
+}
+
+// Checks a block holds consecutive values from the given first value
+static bool IsBlockFilled(const RingBuffer_Data_t *const block, const uint16_t length, const RingBuffer_Data_t first)
+{
+   bool isFilled = true;
+
+   for (uint16_t i = 0U; i < length; i++)
+   {
+      isFilled = isFilled && (block[i] == (RingBuffer_Data_t)(first + i));
+   }
+
+   return(isFilled);
+}
+
+// Buffers that are not a power of two are refused
+static void TestInit(void)
+{
+   Check(!RingBuffer_Init(&ringBuffer, ringBufferData, 12U, RINGBUFFER_OVERFLOW_REJECT), "Size not a power of two", 12U);
+   Check(0U == RingBuffer_Write(&ringBuffer, ringBufferData, 1U), "Write after failed init", ringBuffer.bufferSize);
+   Check(!RingBuffer_Init(&ringBuffer, ringBufferData, 0U, RINGBUFFER_OVERFLOW_REJECT), "Size zero", 0U);
+   Check(!RingBuffer_Init(&ringBuffer, NULL, BUFFER_SIZE, RINGBUFFER_OVERFLOW_REJECT), "No data buffer", 0U);
+   Check(RingBuffer_Init(&ringBuffer, ringBufferData, BUFFER_SIZE, RINGBUFFER_OVERFLOW_REJECT), "Valid init", BUFFER_SIZE);
+}
+
+// Block reads and writes that split at the end of the data buffer, from a
+// position near the end and from indices about to wrap
+static void TestBlocks(void)
+{
+   static const uint16_t startIndices[] = { 12U, 0xFFFCU, 0xFFF0U };
+   RingBuffer_Data_t source[BUFFER_SIZE];
+   RingBuffer_Data_t destination[BUFFER_SIZE];
+
+   for (uint16_t i = 0U; i < (sizeof(startIndices) / sizeof(startIndices[0])); i++)
+   {
+      Start(RINGBUFFER_OVERFLOW_REJECT, startIndices[i]);
+      FillBlock(source, 10U, 100U);
+
+      Check(10U == RingBuffer_Write(&ringBuffer, source, 10U), "Block write across end", startIndices[i]);
+      Check(10U == RingBuffer_GetDataLength(&ringBuffer), "Block write length", startIndices[i]);
+      Check((ringBufferData[startIndices[i] & (BUFFER_SIZE - 1U)] == 100U) && (ringBufferData[(startIndices[i] + 9U) & (BUFFER_SIZE - 1U)] == 109U),
+            "Block write positions", startIndices[i]);
+
+      // A short read, then a read asking for more than is left
+      Check(3U == RingBuffer_Read(&ringBuffer, destination, 3U), "Block short read", startIndices[i]);
+      Check(IsBlockFilled(destination, 3U, 100U), "Block short read data", startIndices[i]);
+      Check(7U == RingBuffer_Read(&ringBuffer, destination, BUFFER_SIZE), "Block rest read", startIndices[i]);
+      Check(IsBlockFilled(destination, 7U, 103U), "Block rest read data", startIndices[i]);
+      Check(0U == RingBuffer_Read(&ringBuffer, destination, BUFFER_SIZE), "Block read empty", startIndices[i]);
+
+      // The whole buffer at once
+      FillBlock(source, BUFFER_SIZE, 200U);
+      Check(BUFFER_SIZE == RingBuffer_Write(&ringBuffer, source, BUFFER_SIZE), "Block fill", startIndices[i]);
+      Check(BUFFER_SIZE == RingBuffer_Read(&ringBuffer, destination, BUFFER_SIZE), "Block drain", startIndices[i]);
+      Check(IsBlockFilled(destination, BUFFER_SIZE, 200U), "Block drain data", startIndices[i]);
+   }
+}
+
+// Filling and draining in place through the spans, split at the end of the
+// data buffer and across the wrap of the indices
+static void TestSpans(void)
+{
+   static const uint16_t startIndices[] = { 0U, 12U, 0xFFFCU };
+   RingBuffer_Spans_t spans;
+
+   for (uint16_t i = 0U; i < (sizeof(startIndices) / sizeof(startIndices[0])); i++)
+   {
+      const uint16_t position = startIndices[i] & (BUFFER_SIZE - 1U);
+      uint16_t count = 0U;
+      uint16_t length;
+
+      Start(RINGBUFFER_OVERFLOW_REJECT, startIndices[i]);
+
+      // All of the free space, from the write position to the end and then
+      // from the start
+      length = RingBuffer_GetWriteSpans(&ringBuffer, &spans);
+      Check((BUFFER_SIZE == length) && (&ringBufferData[position] == spans.data[0]) &&
+            ((BUFFER_SIZE - position) == spans.length[0]) && (ringBufferData == spans.data[1]) && (position == spans.length[1]),
+            "Write spans", startIndices[i]);
+
+      // Nothing is added until it is committed
+      Check(0U == RingBuffer_GetDataLength(&ringBuffer), "Write spans not committed", startIndices[i]);
+
+      for (uint16_t span = 0U; span < 2U; span++)
+      {
+         for (uint16_t j = 0U; (j < spans.length[span]) && (count < 10U); j++)
+         {
+            spans.data[span][j] = 300U + count++;
+         }
+      }
+      RingBuffer_CommitWrite(&ringBuffer, count);
+      Check(10U == RingBuffer_GetDataLength(&ringBuffer), "Write spans committed", startIndices[i]);
+
+      // The data, from the read position to the end and then from the start
+      length = RingBuffer_GetReadSpans(&ringBuffer, &spans);
+      Check((10U == length) && (&ringBufferData[position] == spans.data[0]) && ((spans.length[0] + spans.length[1]) == 10U) &&
+            (spans.length[0] == (((BUFFER_SIZE - position) < 10U) ? (BUFFER_SIZE - position) : 10U)),
+            "Read spans", startIndices[i]);
+      Check(IsBlockFilled(spans.data[0], spans.length[0], 300U) && IsBlockFilled(spans.data[1], spans.length[1], 300U + spans.length[0]),
+            "Read spans data", startIndices[i]);
+
+      // Part of the data is used, and the rest is still there
+      RingBuffer_CommitRead(&ringBuffer, 4U);
+      Check(6U == RingBuffer_GetDataLength(&ringBuffer), "Read spans committed", startIndices[i]);
+      length = RingBuffer_GetReadSpans(&ringBuffer, &spans);
+      Check((6U == length) && (304U == spans.data[0][0]), "Read spans rest", startIndices[i]);
+      RingBuffer_CommitRead(&ringBuffer, length);
+      Check(0U == RingBuffer_GetReadSpans(&ringBuffer, &spans), "Read spans empty", startIndices[i]);
+   }
+}
+
+// Writes to a full buffer with each policy
+static void TestPolicies(void)
+{
+   RingBuffer_Data_t source[BUFFER_SIZE + 8U];
+   RingBuffer_Data_t destination[BUFFER_SIZE];
+   RingBuffer_Data_t value = 0U;
+   RingBuffer_Spans_t spans;
+
+   FillBlock(source, BUFFER_SIZE + 8U, 400U);
+
+   // Reject stores what fits and discards the rest without counting it
+   Start(RINGBUFFER_OVERFLOW_REJECT, 0xFFFAU);
+   Check(BUFFER_SIZE == RingBuffer_Write(&ringBuffer, source, BUFFER_SIZE + 8U), "Reject block", BUFFER_SIZE);
+   Check(!RingBuffer_WriteChar(&ringBuffer, 1U) && (0U == RingBuffer_GetDropCount(&ringBuffer)), "Reject char", 0U);
+   Check((BUFFER_SIZE == RingBuffer_Read(&ringBuffer, destination, BUFFER_SIZE)) && IsBlockFilled(destination, BUFFER_SIZE, 400U),
+         "Reject keeps oldest", destination[0]);
+
+   // Count drops does the same and counts what was discarded
+   Start(RINGBUFFER_OVERFLOW_COUNT_DROPS, 0xFFFAU);
+   Check(5U == RingBuffer_Write(&ringBuffer, source, 5U), "Count drops first block", 5U);
+   Check(11U == RingBuffer_Write(&ringBuffer, &source[5], 14U), "Count drops block", 11U);
+   Check(3U == RingBuffer_GetDropCount(&ringBuffer), "Count drops block count", RingBuffer_GetDropCount(&ringBuffer));
+   Check(!RingBuffer_WriteChar(&ringBuffer, 1U) && (4U == RingBuffer_GetDropCount(&ringBuffer)), "Count drops char",
+         RingBuffer_GetDropCount(&ringBuffer));
+   Check((BUFFER_SIZE == RingBuffer_Read(&ringBuffer, destination, BUFFER_SIZE)) && IsBlockFilled(destination, BUFFER_SIZE, 400U),
+         "Count drops keeps oldest", destination[0]);
+
+   // Overwrite accepts everything and the reader skips to the newest data
+   Start(RINGBUFFER_OVERFLOW_OVERWRITE, 0xFFFAU);
+   Check((BUFFER_SIZE + 8U) == RingBuffer_Write(&ringBuffer, source, BUFFER_SIZE + 8U), "Overwrite long block", BUFFER_SIZE + 8U);
+   Check(BUFFER_SIZE == RingBuffer_GetDataLength(&ringBuffer), "Overwrite long block length", RingBuffer_GetDataLength(&ringBuffer));
+   Check((BUFFER_SIZE == RingBuffer_Read(&ringBuffer, destination, BUFFER_SIZE)) && IsBlockFilled(destination, BUFFER_SIZE, 408U),
+         "Overwrite keeps newest", destination[0]);
+
+   Start(RINGBUFFER_OVERFLOW_OVERWRITE, 0xFFFAU);
+   (void)RingBuffer_Write(&ringBuffer, source, BUFFER_SIZE);
+   Check(RingBuffer_WriteChar(&ringBuffer, 500U) && (5U == RingBuffer_Write(&ringBuffer, source, 5U)), "Overwrite full", 0U);
+   Check(RingBuffer_ReadChar(&ringBuffer, &value) && (406U == value), "Overwrite char skips replaced", value);
+
+   // In overwrite mode the write spans only give the free space, and the
+   // read spans skip the replaced data
+   Check(1U == RingBuffer_GetWriteSpans(&ringBuffer, &spans), "Overwrite write spans", spans.length[0]);
+   (void)RingBuffer_Write(&ringBuffer, source, 8U);
+   Check((BUFFER_SIZE == RingBuffer_GetReadSpans(&ringBuffer, &spans)) && (414U == spans.data[0][0]), "Overwrite read spans",
+         spans.data[0][0]);
+   RingBuffer_CommitRead(&ringBuffer, BUFFER_SIZE);
+   Check(0U == RingBuffer_GetDataLength(&ringBuffer), "Overwrite drained", RingBuffer_GetDataLength(&ringBuffer));
+}
+
+// Random reads and writes of every kind compared with a model of the FIFO
+// that holds every value ever written
+static void TestRandom(const RingBuffer_OverflowPolicy_t policy)
+{
+   static RingBuffer_Data_t model[NUM_RANDOM_OPERATIONS * BUFFER_SIZE];
+   uint32_t modelRead = 0UL;
+   uint32_t modelWrite = 0UL;
+   uint32_t modelDrops = 0UL;
+   uint32_t numMismatches = 0UL;
+   RingBuffer_Data_t block[BUFFER_SIZE + 4U];
+   RingBuffer_Spans_t spans;
+
+   Start(policy, 0xFF00U);
+
+   for (uint32_t operation = 0UL; operation < NUM_RANDOM_OPERATIONS; operation++)
+   {
+      const uint16_t length = (uint16_t)(rand() % (BUFFER_SIZE + 4U));
+      const uint32_t numHeld = modelWrite - modelRead;
+      const uint16_t numFree = (numHeld >= BUFFER_SIZE) ? 0U : (uint16_t)(BUFFER_SIZE - numHeld);
+      uint16_t numDone = 0U;
+
+      switch (rand() % 6)
+      {
+         case 0:
+            // Write one element
+            if (RingBuffer_WriteChar(&ringBuffer, (RingBuffer_Data_t)modelWrite))
+            {
+               model[modelWrite] = (RingBuffer_Data_t)modelWrite;
+               modelWrite++;
+            }
+            else
+            {
+               modelDrops++;
+               numMismatches += (0U != numFree) ? 1UL : 0UL;
+            }
+            break;
+         case 1:
+            // Write a block
+            FillBlock(block, length, (RingBuffer_Data_t)modelWrite);
+            numDone = RingBuffer_Write(&ringBuffer, block, length);
+            if (RINGBUFFER_OVERFLOW_OVERWRITE == policy)
+            {
+               numMismatches += (numDone != length) ? 1UL : 0UL;
+               numDone = length;
+            }
+            else
+            {
+               numMismatches += (numDone != ((length < numFree) ? length : numFree)) ? 1UL : 0UL;
+               modelDrops += length - numDone;
+            }
+            for (uint16_t i = 0U; i < numDone; i++)
+            {
+               model[modelWrite] = block[i];
+               modelWrite++;
+            }
+            break;
+         case 2:
+            // Write in place through the spans
+            numDone = RingBuffer_GetWriteSpans(&ringBuffer, &spans);
+            numMismatches += (numDone != numFree) ? 1UL : 0UL;
+            numDone = (length < numDone) ? length : numDone;
+            for (uint16_t i = 0U; i < numDone; i++)
+            {
+               RingBuffer_Data_t *const element = (i < spans.length[0]) ? &spans.data[0][i] : &spans.data[1][i - spans.length[0]];
+
+               *element = (RingBuffer_Data_t)modelWrite;
+               model[modelWrite] = (RingBuffer_Data_t)modelWrite;
+               modelWrite++;
+            }
+            RingBuffer_CommitWrite(&ringBuffer, numDone);
+            break;
+         case 3:
+            // Read one element
+            if (numHeld > BUFFER_SIZE)
+            {
+               modelRead = modelWrite - BUFFER_SIZE;
+            }
+            if (RingBuffer_ReadChar(&ringBuffer, &block[0]))
+            {
+               numMismatches += ((modelRead == modelWrite) || (block[0] != model[modelRead])) ? 1UL : 0UL;
+               modelRead++;
+            }
+            else
+            {
+               numMismatches += (modelRead != modelWrite) ? 1UL : 0UL;
+            }
+            break;
+         case 4:
+            // Read a block
+            if (numHeld > BUFFER_SIZE)
+            {
+               modelRead = modelWrite - BUFFER_SIZE;
+            }
+            numDone = RingBuffer_Read(&ringBuffer, block, length);
+            numMismatches += (numDone != (((modelWrite - modelRead) < length) ? (modelWrite - modelRead) : length)) ? 1UL : 0UL;
+            for (uint16_t i = 0U; i < numDone; i++)
+            {
+               numMismatches += (block[i] != model[modelRead]) ? 1UL : 0UL;
+               modelRead++;
+            }
+            break;
+         default:
+            // Read in place through the spans
+            if (numHeld > BUFFER_SIZE)
+            {
+               modelRead = modelWrite - BUFFER_SIZE;
+            }
+            numDone = RingBuffer_GetReadSpans(&ringBuffer, &spans);
+            numMismatches += (numDone != (modelWrite - modelRead)) ? 1UL : 0UL;
+            numDone = (length < numDone) ? length : numDone;
+            for (uint16_t i = 0U; i < numDone; i++)
+            {
+               const RingBuffer_Data_t element = (i < spans.length[0]) ? spans.data[0][i] : spans.data[1][i - spans.length[0]];
+
+               numMismatches += (element != model[modelRead]) ? 1UL : 0UL;
+               modelRead++;
+            }
+            RingBuffer_CommitRead(&ringBuffer, numDone);
+            break;
+      }
+
+      numMismatches += (RingBuffer_GetDataLength(&ringBuffer) != (((modelWrite - modelRead) < BUFFER_SIZE) ? (modelWrite - modelRead) : BUFFER_SIZE)) ? 1UL : 0UL;
+   }
+
+   Check(0UL == numMismatches, "Random operations match model", policy);
+   Check((RINGBUFFER_OVERFLOW_COUNT_DROPS == policy) ? ((uint16_t)modelDrops == RingBuffer_GetDropCount(&ringBuffer)) :
+         (0U == RingBuffer_GetDropCount(&ringBuffer)), "Random drop count", RingBuffer_GetDropCount(&ringBuffer));
+   Check(modelWrite > 0xFFFFUL, "Random indices wrapped", modelWrite);
+}
+
+// Moves the same data through a buffer each way and prints the time taken
+static void Benchmark(void)
+{
+   RingBuffer_Data_t source[BENCHMARK_BLOCK_LENGTH];
+   RingBuffer_Data_t destination[BENCHMARK_BLOCK_LENGTH];
+   RingBuffer_Spans_t spans;
+   uint32_t sum = 0UL;
+   clock_t startTime;
+   clock_t charTime;
+   clock_t blockTime;
+   clock_t spanTime;
+
+   (void)RingBuffer_Init(&ringBuffer, ringBufferData, BENCHMARK_BUFFER_SIZE, RINGBUFFER_OVERFLOW_REJECT);
+   FillBlock(source, BENCHMARK_BLOCK_LENGTH, 0U);
+
+   // One element at a time
+   startTime = clock();
+   for (uint32_t block = 0UL; block < BENCHMARK_NUM_BLOCKS; block++)
+   {
+      for (uint16_t i = 0U; i < BENCHMARK_BLOCK_LENGTH; i++)
+      {
+         (void)RingBuffer_WriteChar(&ringBuffer, source[i]);
+      }
+      for (uint16_t i = 0U; i < BENCHMARK_BLOCK_LENGTH; i++)
+      {
+         (void)RingBuffer_ReadChar(&ringBuffer, &destination[i]);
+      }
+      sum += destination[block % BENCHMARK_BLOCK_LENGTH];
+   }
+   charTime = clock() - startTime;
+
+   // Block copies
+   startTime = clock();
+   for (uint32_t block = 0UL; block < BENCHMARK_NUM_BLOCKS; block++)
+   {
+      (void)RingBuffer_Write(&ringBuffer, source, BENCHMARK_BLOCK_LENGTH);
+      (void)RingBuffer_Read(&ringBuffer, destination, BENCHMARK_BLOCK_LENGTH);
+      sum += destination[block % BENCHMARK_BLOCK_LENGTH];
+   }
+   blockTime = clock() - startTime;
+
+   // In place through the spans
+   startTime = clock();
+   for (uint32_t block = 0UL; block < BENCHMARK_NUM_BLOCKS; block++)
+   {
+      uint16_t count = 0U;
+
+      (void)RingBuffer_GetWriteSpans(&ringBuffer, &spans);
+      for (uint16_t span = 0U; span < 2U; span++)
+      {
+         for (uint16_t i = 0U; (i < spans.length[span]) && (count < BENCHMARK_BLOCK_LENGTH); i++)
+         {
+            spans.data[span][i] = source[count++];
+         }
+      }
+      RingBuffer_CommitWrite(&ringBuffer, count);
+
+      count = 0U;
+      (void)RingBuffer_GetReadSpans(&ringBuffer, &spans);
+      for (uint16_t span = 0U; span < 2U; span++)
+      {
+         for (uint16_t i = 0U; (i < spans.length[span]) && (count < BENCHMARK_BLOCK_LENGTH); i++)
+         {
+            destination[count++] = spans.data[span][i];
+         }
+      }
+      RingBuffer_CommitRead(&ringBuffer, count);
+      sum += destination[block % BENCHMARK_BLOCK_LENGTH];
+   }
+   spanTime = clock() - startTime;
+
+   // Every method moves the same data, so each adds the same to the sum
+   Check((3UL * (BENCHMARK_NUM_BLOCKS / BENCHMARK_BLOCK_LENGTH) * ((BENCHMARK_BLOCK_LENGTH * (BENCHMARK_BLOCK_LENGTH - 1U)) / 2U)) == sum,
+         "Benchmark data", sum);
+
+   printf("%lu elements each way: char %.2f ns, block %.2f ns, span %.2f ns per element\n",
+          (unsigned long)(BENCHMARK_NUM_BLOCKS * BENCHMARK_BLOCK_LENGTH),
+          (1.0e9 * (double)charTime) / ((double)CLOCKS_PER_SEC * (double)(BENCHMARK_NUM_BLOCKS * BENCHMARK_BLOCK_LENGTH)),
+          (1.0e9 * (double)blockTime) / ((double)CLOCKS_PER_SEC * (double)(BENCHMARK_NUM_BLOCKS * BENCHMARK_BLOCK_LENGTH)),
+          (1.0e9 * (double)spanTime) / ((double)CLOCKS_PER_SEC * (double)(BENCHMARK_NUM_BLOCKS * BENCHMARK_BLOCK_LENGTH)));
+}
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Host entry point
+int main(void)
+{
+   srand(1U);
+
+   TestInit();
+   TestBlocks();
+   TestSpans();
+   TestPolicies();
+   TestRandom(RINGBUFFER_OVERFLOW_REJECT);
+   TestRandom(RINGBUFFER_OVERFLOW_COUNT_DROPS);
+   TestRandom(RINGBUFFER_OVERFLOW_OVERWRITE);
+   Benchmark();
+
+   printf("%lu checks, %lu failed\n", (unsigned long)numChecks, (unsigned long)numFailures);
+
+   return((0U == numFailures) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,319 @@
+/*******************************************************************************
+// Scheduler Test
+// Host test of the load shedding in Src/Scheduler.c against a simulated clock.
+// Each scheduled function moves the clock on by the time it would take, and
+// the idle function moves it to the next deadline. A coroutine started with
+// an interval of 0 is always due, so the loop never idles, and the frames
+// must still close so the sheddable functions keep being called.
+//
+// Usage (from the repository root):
+//    cc -std=c99 -I Tools/Host -I Src -I Src/Boards/F28388D_controlCARD \
+//       -o scheduler_test Tools/Scheduler_Test.c Tools/Host/SysTick_Drv_Host.c \
+//       Tools/Host/Sys_Host.c Src/Scheduler.c Src/SoftTimerLib.c \
+//       Src/Timebase.c Src/MessageRouter.c
+//    ./scheduler_test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "Scheduler.h"
+// Platform Includes
+#include "CoroutineLib.h"
+#include "MessageRouter.h"
+#include "SysTick_Drv_Host.h"
+#include "Timebase.h"
+// Other Includes
+#include <stdbool.h> // Defines C99 boolean type
+#include <stdint.h> // Defines C99 integer types
+#include <stdio.h>
+#include <stdlib.h> // C exit codes
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The length of each run
+#define RUN_MILLISECONDS (2000U)
+
+// The time of the last part of a run, in which every function must be called
+#define FINAL_MILLISECONDS (200U)
+
+// The cycles in a microsecond of the simulated clock
+#define NUM_CYCLES_PER_MICROSECOND (TIMEBASE_NUM_CYCLES_PER_MILLISECOND / 1000U)
+
+// The time each function takes
+#define FAST_WORK_CYCLES (20U * NUM_CYCLES_PER_MICROSECOND)
+#define SHEDDABLE_WORK_CYCLES (50U * NUM_CYCLES_PER_MICROSECOND)
+#define COROUTINE_WORK_CYCLES (10U * NUM_CYCLES_PER_MICROSECOND)
+
+// The slots of the functions in the schedule, which match testConfigData
+#define FAST_TASK_INDEX (0U)
+#define SHEDDABLE_TASK_INDEX (1U)
+#define SLOW_SHEDDABLE_TASK_INDEX (2U)
+
+// The number of calls expected of each sheddable function when the loop idles
+#define SHEDDABLE_NUM_CALLS ((RUN_MILLISECONDS - 3U) / 10U)
+#define SLOW_SHEDDABLE_NUM_CALLS (((RUN_MILLISECONDS - 50U) / 100U))
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// The response of Scheduler_MessageRouter_GetLoad()
+typedef struct
+{
+   uint16_t lastLoad;
+   uint16_t averageLoad;
+   uint16_t peakLoad;
+   uint16_t numWindows;
+   uint32_t windowMilliseconds;
+   uint32_t frameOverrunCount;
+   uint32_t shedCount;
+} LoadResponse_t;
+
+// The response of Scheduler_MessageRouter_GetTaskInfo()
+typedef struct
+{
+   uint16_t taskIndex;
+   uint16_t taskState;
+   uint32_t intervalMilliseconds;
+   uint16_t mode;
+   uint16_t dummy;
+   uint32_t phaseOffsetMilliseconds;
+   uint16_t priority;
+   uint16_t isSheddable;
+   uint32_t shedCount;
+   uint16_t eventMask;
+   uint16_t dummy2;
+} TaskInfoResponse_t;
+
+// The calls made to one function
+typedef struct
+{
+   uint32_t numCalls;
+   Timebase_Tick_t lastCallTick;
+} CallRecord_t;
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+static void FastFunction(void);
+static void SheddableFunction(void);
+static void SlowSheddableFunction(void);
+static void StopFunction(void);
+static void IdleFunction(const Timebase_Tick_t ticksUntilNextDeadline);
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// A fast function that must never be shed, two sheddable functions as the
+// board has, and one that ends the run
+static const Scheduler_ConfigItem_t testConfigData[] =
+{
+    // { ms, Pointer To Scheduled Function, Mode, Phase Offset ms, Priority, Sheddable, Events }
+       {   1, FastFunction, SCHEDULER_MODE_FIXED_RATE, 0, 0, false, 0U },
+       {  10, SheddableFunction, SCHEDULER_MODE_FIXED_RATE, 3, 2, true, 0U },
+       { 100, SlowSheddableFunction, SCHEDULER_MODE_FIXED_RATE, 50, 2, true, 0U },
+       { RUN_MILLISECONDS, StopFunction, SCHEDULER_MODE_FIXED_RATE, 0, 0, false, 0U },
+};
+
+static const Scheduler_Config_t testConfig =
+{
+   .numConfigItems = sizeof(testConfigData)/sizeof(Scheduler_ConfigItem_t),
+   .schedulerConfigArray = testConfigData,
+   .idleFunction = IdleFunction,
+   .fastTierConfig = NULL,
+   .frameBudgetCycles = TIMEBASE_NUM_CYCLES_PER_MILLISECOND,
+   .numOptionalItems = 0U,
+   .optionalConfigArray = NULL
+};
+
+// The calls made to each function in the current run
+static CallRecord_t fastCalls;
+static CallRecord_t sheddableCalls;
+static CallRecord_t slowSheddableCalls;
+static CallRecord_t coroutineCalls;
+
+// The number of checks made and the number that failed
+static uint32_t numChecks;
+static uint32_t numFailures;
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Records the result of one check, describing it if it failed
+static void Check(const bool isPassed, const char *const name, const uint32_t value)
+{
+   numChecks++;
+
+   if (!isPassed)
+   {
+      numFailures++;
+      fprintf(stderr, "%s (%lu) failed\n", name, (unsigned long)value);
+   }
+}
+
+// Counts a call and lets the time the function takes pass
+static void RecordCall(CallRecord_t *const callRecord, const uint32_t workCycles)
+{
+   callRecord->numCalls++;
+   callRecord->lastCallTick = Timebase_GetCurrentTickCount();
+   SysTick_Drv_Host_AdvanceCycles(workCycles);
+}
+
+static void FastFunction(void)
+{
+   RecordCall(&fastCalls, FAST_WORK_CYCLES);
+}
+
+static void SheddableFunction(void)
+{
+   RecordCall(&sheddableCalls, SHEDDABLE_WORK_CYCLES);
+}
+
+static void SlowSheddableFunction(void)
+{
+   RecordCall(&slowSheddableCalls, SHEDDABLE_WORK_CYCLES);
+}
+
+static void StopFunction(void)
+{
+   Scheduler_Stop();
+}
+
+// Sleeps until the next deadline
+static void IdleFunction(const Timebase_Tick_t ticksUntilNextDeadline)
+{
+   SysTick_Drv_Host_AdvanceCycles(((0U != ticksUntilNextDeadline) ? ticksUntilNextDeadline : 1U) *
+                                  (uint32_t)TIMEBASE_NUM_CYCLES_PER_TICK);
+}
+
+// Is always due, so the loop never idles while it runs
+static CoroutineLib_Status_t BusyCoroutine(CoroutineLib_Context_t *const context)
+{
+   COROUTINELIB_BEGIN(context);
+   while (true)
+   {
+      RecordCall(&coroutineCalls, COROUTINE_WORK_CYCLES);
+      COROUTINELIB_YIELD(context);
+   }
+   COROUTINELIB_END(context);
+}
+
+// Calls a command handler with no command data
+static void RequestResponse(MessageRouter_MessageHandler_t handler, uint16_t *const commandData,
+                            const uint16_t commandLength, void *const responseData, const uint16_t responseLength)
+{
+   MessageRouter_Message_t message;
+
+   message.commandParams.data = commandData;
+   message.commandParams.length = commandLength;
+   message.commandParams.maxLength = commandLength;
+   message.responseParams.data = (uint16_t *)responseData;
+   message.responseParams.length = 0U;
+   message.responseParams.maxLength = responseLength;
+   message.responseCode = POWER_MESSAGEROUTER_RESPONSE_CODE_None;
+
+   handler(&message);
+}
+
+// Returns the number of calls of a slot that were shed
+static uint32_t GetShedCount(const uint16_t taskIndex)
+{
+   uint16_t command = taskIndex;
+   TaskInfoResponse_t response = { 0 };
+
+   RequestResponse(Scheduler_MessageRouter_GetTaskInfo, &command, sizeof(command), &response, sizeof(response));
+
+   return(response.shedCount);
+}
+
+// Runs the schedule, with or without the busy coroutine, from a fresh start
+static void Run(const bool isCoroutineStarted)
+{
+   uint16_t coroutineIndex = SCHEDULER_INVALID_TASK_INDEX;
+
+   fastCalls = (CallRecord_t){ 0 };
+   sheddableCalls = (CallRecord_t){ 0 };
+   slowSheddableCalls = (CallRecord_t){ 0 };
+   coroutineCalls = (CallRecord_t){ 0 };
+
+   (void)Timebase_Init(0U, NULL);
+   Check(Scheduler_Init(0U, &testConfig), "Scheduler_Init", 0U);
+   if (isCoroutineStarted)
+   {
+      Check(Scheduler_StartCoroutine(BusyCoroutine, 0U, 0U, &coroutineIndex), "Scheduler_StartCoroutine", 0U);
+   }
+
+   Scheduler_Execute();
+
+   if (isCoroutineStarted)
+   {
+      Check(coroutineCalls.numCalls > 0U, "Coroutine called", coroutineCalls.numCalls);
+      Check(0U == GetShedCount(coroutineIndex), "Coroutine never shed", GetShedCount(coroutineIndex));
+   }
+}
+
+// Without the coroutine the loop idles between deadlines, every frame ends
+// well inside its budget and nothing is shed
+static void TestIdleFrames(void)
+{
+   LoadResponse_t load = { 0 };
+
+   Run(false);
+   RequestResponse(Scheduler_MessageRouter_GetLoad, NULL, 0U, &load, sizeof(load));
+
+   Check(RUN_MILLISECONDS == fastCalls.numCalls, "Idle fast function calls", fastCalls.numCalls);
+   Check(SHEDDABLE_NUM_CALLS == sheddableCalls.numCalls, "Idle sheddable function calls", sheddableCalls.numCalls);
+   Check(SLOW_SHEDDABLE_NUM_CALLS == slowSheddableCalls.numCalls, "Idle slow sheddable function calls",
+         slowSheddableCalls.numCalls);
+   Check(0U == load.frameOverrunCount, "Idle frame overruns", load.frameOverrunCount);
+   Check(0U == load.shedCount, "Idle shed calls", load.shedCount);
+}
+
+// With the coroutine always due the loop never idles. Frames must still
+// close, so overruns go on being counted one frame at a time, and the
+// sheddable functions are called up to the end of the run. No call is shed
+// twice in a row, so at least half of the calls are made.
+static void TestBusyFrames(void)
+{
+   const Timebase_Tick_t finalTick = Timebase_MillisecondsToTicks(RUN_MILLISECONDS - FINAL_MILLISECONDS);
+   LoadResponse_t load = { 0 };
+
+   Run(true);
+   RequestResponse(Scheduler_MessageRouter_GetLoad, NULL, 0U, &load, sizeof(load));
+
+   Check(RUN_MILLISECONDS == fastCalls.numCalls, "Busy fast function calls", fastCalls.numCalls);
+   Check(0U == GetShedCount(FAST_TASK_INDEX), "Busy fast function never shed", GetShedCount(FAST_TASK_INDEX));
+   Check(load.frameOverrunCount >= (RUN_MILLISECONDS / SCHEDULER_MAX_FRAME_MILLISECONDS) - 1U,
+         "Busy frame overruns", load.frameOverrunCount);
+   Check((sheddableCalls.numCalls >= (SHEDDABLE_NUM_CALLS / 2U)) && (sheddableCalls.lastCallTick >= finalTick),
+         "Busy sheddable function called to the end", sheddableCalls.lastCallTick);
+   Check((slowSheddableCalls.numCalls >= (SLOW_SHEDDABLE_NUM_CALLS / 2U)) &&
+         (slowSheddableCalls.lastCallTick >= finalTick),
+         "Busy slow sheddable function called to the end", slowSheddableCalls.lastCallTick);
+   Check((sheddableCalls.numCalls + GetShedCount(SHEDDABLE_TASK_INDEX)) == SHEDDABLE_NUM_CALLS,
+         "Busy sheddable function called or shed", sheddableCalls.numCalls);
+   Check((slowSheddableCalls.numCalls + GetShedCount(SLOW_SHEDDABLE_TASK_INDEX)) == SLOW_SHEDDABLE_NUM_CALLS,
+         "Busy slow sheddable function called or shed", slowSheddableCalls.numCalls);
+}
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Host entry point
+int main(void)
+{
+   TestIdleFrames();
+   TestBusyFrames();
+
+   printf("%lu checks, %lu failed\n", (unsigned long)numChecks, (unsigned long)numFailures);
+
+   return((0U == numFailures) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,427 @@
+/*******************************************************************************
+// Software Timer Wheel Test
+// Host test of Src/SoftTimerWheel.c. One-shot timers are started at many
+// ticks, including just before the tick count wraps, with durations on each
+// side of the cascade boundaries of the wheel, and must expire on exactly
+// the right tick. Periodic timers, callbacks that stop and restart timers,
+// and the limits on the duration are checked as well.
+// Finally the same set of periodic timers is run on the wheel and as polled
+// SoftTimerLib timers from one simulated clock. Both must expire the same
+// number of times, and the time taken by each is printed for comparison.
+//
+// Usage (from the repository root):
+//    cc -std=c99 -O2 -I Tools/Host -I Src -I Src/Boards/F28388D_controlCARD \
+//       -o softtimerwheel_test Tools/SoftTimerWheel_Test.c Tools/Host/SysTick_Drv_Host.c \
+//       Tools/Host/Sys_Host.c Src/SoftTimerWheel.c Src/SoftTimerLib.c Src/Timebase.c Src/MessageRouter.c
+//    ./softtimerwheel_test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "SoftTimerWheel.h"
+// Platform Includes
+#include "SoftTimerLib.h"
+#include "SysTick_Drv_Host.h"
+#include "Timebase.h"
+// Other Includes
+#include <stdbool.h> // Defines C99 boolean type
+#include <stddef.h> // Defines NULL
+#include <stdint.h> // Defines C99 integer types
+#include <stdio.h>
+#include <stdlib.h> // C exit codes
+#include <time.h> // Host processor time
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The number of timers run by the comparison with polled timers
+#define NUM_COMPARED_TIMERS (128U)
+
+// The compared timer periods are spread between 1 and this many ticks
+#define MAX_COMPARED_PERIOD_TICKS (1000U)
+
+// Step between the periods of consecutive compared timers
+#define COMPARED_PERIOD_STEP_TICKS (37U)
+
+// The number of ticks the comparison runs for
+#define NUM_COMPARED_TICKS (100000UL)
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// What a callback does to the wheel when it is called
+typedef enum
+{
+   ACTION_NONE,
+   // Stop the timer of the callback
+   ACTION_STOP_SELF,
+   // Stop the other timer of the record
+   ACTION_STOP_OTHER,
+   // Restart the timer of the callback with its last duration
+   ACTION_RESTART_SELF,
+   // Start the other timer of the record with a duration of 0
+   ACTION_START_OTHER
+} Action_t;
+
+// The calls made to one callback
+typedef struct
+{
+   // The number of calls
+   uint32_t numCalls;
+   // The serviced tick of the last call
+   Timebase_Tick_t lastTick;
+   // The value of callOrder at the last call, to show the order of calls
+   uint32_t lastOrder;
+   // What the callback does each call
+   Action_t action;
+   // The timer acted on by ACTION_STOP_OTHER and ACTION_START_OTHER
+   SoftTimerWheel_Timer_t *other;
+} Record_t;
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The wheel used by every test
+static SoftTimerWheel_t wheel;
+
+// Counts every callback, to show the order of calls
+static uint32_t callOrder;
+
+// Timers used by the comparison with polled timers, too large for the stack
+static SoftTimerWheel_Timer_t comparedWheelTimers[NUM_COMPARED_TIMERS];
+static SoftTimerLib_Timer_t comparedPolledTimers[NUM_COMPARED_TIMERS];
+
+// The number of checks made and the number that failed
+static uint32_t numChecks;
+static uint32_t numFailures;
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Records the result of one check, describing it if it failed
+static void Check(const bool isPassed, const char *const name, const uint32_t value)
+{
+   numChecks++;
+
+   if (!isPassed)
+   {
+      numFailures++;
+      fprintf(stderr, "%s (%lu) failed\n", name, (unsigned long)value);
+   }
+}
+
+// Records the call in the Record_t given as the context, then acts on the
+// wheel as the record asks
+static void RecordCall(SoftTimerWheel_Timer_t *const timer, void *const context)
+{
+   Record_t *const record = (Record_t *)context;
+
+   record->numCalls++;
+   record->lastTick = wheel.currentTick;
+   record->lastOrder = ++callOrder;
+
+   switch (record->action)
+   {
+      case ACTION_STOP_SELF:
+         SoftTimerWheel_StopTimer(&wheel, timer);
+         break;
+      case ACTION_STOP_OTHER:
+         SoftTimerWheel_StopTimer(&wheel, record->other);
+         break;
+      case ACTION_RESTART_SELF:
+         SoftTimerWheel_RestartTimer(&wheel, timer);
+         break;
+      case ACTION_START_OTHER:
+         SoftTimerWheel_StartTimerTicks(&wheel, record->other, 0U, 0U);
+         break;
+      case ACTION_NONE:
+      default:
+         break;
+   }
+}
+
+// Counts the calls of the compared wheel timers
+static void CountCall(SoftTimerWheel_Timer_t *const timer, void *const context)
+{
+   (void)timer;
+
+   (*(uint32_t *)context)++;
+}
+
+// Starts a one-shot timer on a new wheel at the given tick and checks it
+// expires on exactly the tick it is due, and not on the tick before
+static void TestOneShot(const Timebase_Tick_t startTick, const Timebase_Tick_t durationTicks)
+{
+   SoftTimerWheel_Timer_t timer;
+   Record_t record = { 0U, 0U, 0U, ACTION_NONE, NULL };
+   const Timebase_Tick_t expiryTick = startTick + durationTicks;
+
+   SoftTimerWheel_Init(&wheel, startTick);
+   SoftTimerWheel_InitTimer(&timer, RecordCall, &record);
+   SoftTimerWheel_StartTimerTicks(&wheel, &timer, durationTicks, 0U);
+
+   (void)SoftTimerWheel_Service(&wheel, expiryTick - 1U);
+   Check((0U == record.numCalls) && SoftTimerWheel_IsTimerRunning(&timer), "One-shot early", durationTicks);
+
+   (void)SoftTimerWheel_Service(&wheel, expiryTick);
+   Check((1U == record.numCalls) && (expiryTick == record.lastTick), "One-shot due", durationTicks);
+   Check(!SoftTimerWheel_IsTimerRunning(&timer) && (0U == wheel.numRunningTimers), "One-shot stopped", durationTicks);
+}
+
+// One-shot timers across the cascade boundaries of the wheel and the wrap of
+// the tick count
+static void TestCascadeBoundaries(void)
+{
+   // The first ticks of each level and the ticks either side of them
+   static const Timebase_Tick_t durations[] =
+   {
+      1U, 2U, 62U, 63U, 64U, 65U, 127U, 128U, 4095U, 4096U, 4097U, 262143UL, 262144UL, 262145UL
+   };
+   // Starts on and between slot boundaries, and just before the tick wraps
+   static const Timebase_Tick_t startTicks[] =
+   {
+      0U, 1U, 63U, 64U, 4095U, 4096U, 0x12345678UL, 0xFFFFFFC0UL, 0xFFFFF000UL, 0xFFFFFFFFUL
+   };
+
+   for (uint16_t i = 0U; i < (sizeof(startTicks) / sizeof(startTicks[0])); i++)
+   {
+      for (uint16_t j = 0U; j < (sizeof(durations) / sizeof(durations[0])); j++)
+      {
+         TestOneShot(startTicks[i], durations[j]);
+      }
+   }
+}
+
+// Periodic timers keep a fixed rate, including across cascades and the wrap
+// of the tick count
+static void TestPeriodic(void)
+{
+   SoftTimerWheel_Timer_t fastTimer;
+   SoftTimerWheel_Timer_t slowTimer;
+   Record_t fastRecord = { 0U, 0U, 0U, ACTION_NONE, NULL };
+   Record_t slowRecord = { 0U, 0U, 0U, ACTION_NONE, NULL };
+   const Timebase_Tick_t startTick = 0xFFFFFF00UL;
+   uint16_t numMissed = 0U;
+
+   SoftTimerWheel_Init(&wheel, startTick);
+   SoftTimerWheel_InitTimer(&fastTimer, RecordCall, &fastRecord);
+   SoftTimerWheel_InitTimer(&slowTimer, RecordCall, &slowRecord);
+   SoftTimerWheel_StartTimerTicks(&wheel, &fastTimer, 5U, 10U);
+   SoftTimerWheel_StartTimerTicks(&wheel, &slowTimer, 4096U, 4096U);
+
+   // Step one tick at a time so each call of the fast timer is seen
+   for (Timebase_Tick_t tick = 1U; tick <= 10005U; tick++)
+   {
+      (void)SoftTimerWheel_Service(&wheel, startTick + tick);
+
+      if ((tick >= 5U) && (0U == ((tick - 5U) % 10U)) && (startTick + tick != fastRecord.lastTick))
+      {
+         numMissed++;
+      }
+   }
+
+   Check((1001U == fastRecord.numCalls) && (0U == numMissed), "Periodic fast", fastRecord.numCalls);
+   Check((2U == slowRecord.numCalls) && ((startTick + 8192U) == slowRecord.lastTick), "Periodic slow", slowRecord.numCalls);
+   Check(SoftTimerWheel_IsTimerRunning(&fastTimer) && SoftTimerWheel_IsTimerRunning(&slowTimer),
+         "Periodic still running", wheel.numRunningTimers);
+
+   // Stopping a periodic timer from outside a callback ends it
+   SoftTimerWheel_StopTimer(&wheel, &fastTimer);
+   (void)SoftTimerWheel_Service(&wheel, startTick + 10100U);
+   Check((1001U == fastRecord.numCalls) && !SoftTimerWheel_IsTimerRunning(&fastTimer), "Periodic stop", fastRecord.numCalls);
+}
+
+// Callbacks that stop, restart and start timers in the same wheel
+static void TestCallbackActions(void)
+{
+   SoftTimerWheel_Timer_t firstTimer;
+   SoftTimerWheel_Timer_t secondTimer;
+   Record_t firstRecord = { 0U, 0U, 0U, ACTION_NONE, NULL };
+   Record_t secondRecord = { 0U, 0U, 0U, ACTION_NONE, NULL };
+
+   SoftTimerWheel_InitTimer(&firstTimer, RecordCall, &firstRecord);
+   SoftTimerWheel_InitTimer(&secondTimer, RecordCall, &secondRecord);
+
+   // A periodic timer that stops itself is only called once
+   SoftTimerWheel_Init(&wheel, 0U);
+   firstRecord.action = ACTION_STOP_SELF;
+   SoftTimerWheel_StartTimerTicks(&wheel, &firstTimer, 3U, 3U);
+   (void)SoftTimerWheel_Service(&wheel, 100U);
+   Check((1U == firstRecord.numCalls) && !SoftTimerWheel_IsTimerRunning(&firstTimer) && (0U == wheel.numRunningTimers),
+         "Stop self", firstRecord.numCalls);
+
+   // Timers due on the same tick are called in the order they were started,
+   // and a timer stopped by an earlier callback on that tick is not called
+   SoftTimerWheel_Init(&wheel, 0U);
+   firstRecord = (Record_t){ 0U, 0U, 0U, ACTION_STOP_OTHER, &secondTimer };
+   secondRecord = (Record_t){ 0U, 0U, 0U, ACTION_NONE, NULL };
+   SoftTimerWheel_StartTimerTicks(&wheel, &firstTimer, 70U, 0U);
+   SoftTimerWheel_StartTimerTicks(&wheel, &secondTimer, 70U, 0U);
+   (void)SoftTimerWheel_Service(&wheel, 100U);
+   Check((1U == firstRecord.numCalls) && (0U == secondRecord.numCalls) && (0U == wheel.numRunningTimers),
+         "Stop other on same tick", secondRecord.numCalls);
+
+   SoftTimerWheel_Init(&wheel, 0U);
+   firstRecord = (Record_t){ 0U, 0U, 0U, ACTION_NONE, NULL };
+   SoftTimerWheel_StartTimerTicks(&wheel, &secondTimer, 70U, 0U);
+   SoftTimerWheel_StartTimerTicks(&wheel, &firstTimer, 70U, 0U);
+   (void)SoftTimerWheel_Service(&wheel, 100U);
+   Check(secondRecord.lastOrder < firstRecord.lastOrder, "Order on same tick", secondRecord.lastOrder);
+
+   // A one-shot timer that restarts itself runs again with its last duration
+   SoftTimerWheel_Init(&wheel, 0U);
+   firstRecord = (Record_t){ 0U, 0U, 0U, ACTION_RESTART_SELF, NULL };
+   SoftTimerWheel_StartTimerTicks(&wheel, &firstTimer, 100U, 0U);
+   (void)SoftTimerWheel_Service(&wheel, 1000U);
+   Check((10U == firstRecord.numCalls) && (1000U == firstRecord.lastTick) && SoftTimerWheel_IsTimerRunning(&firstTimer),
+         "Restart self", firstRecord.numCalls);
+   SoftTimerWheel_StopTimer(&wheel, &firstTimer);
+
+   // A timer started with no delay from a callback is due on the next tick,
+   // not on the tick being serviced
+   SoftTimerWheel_Init(&wheel, 0U);
+   firstRecord = (Record_t){ 0U, 0U, 0U, ACTION_START_OTHER, &secondTimer };
+   secondRecord = (Record_t){ 0U, 0U, 0U, ACTION_NONE, NULL };
+   SoftTimerWheel_StartTimerTicks(&wheel, &firstTimer, 64U, 0U);
+   (void)SoftTimerWheel_Service(&wheel, 64U);
+   Check((1U == firstRecord.numCalls) && (0U == secondRecord.numCalls), "Start other not on same tick", secondRecord.numCalls);
+   (void)SoftTimerWheel_Service(&wheel, 65U);
+   Check((1U == secondRecord.numCalls) && (65U == secondRecord.lastTick), "Start other next tick", secondRecord.lastTick);
+
+   // Restarting a running timer from outside a callback pushes it back
+   SoftTimerWheel_Init(&wheel, 0U);
+   firstRecord = (Record_t){ 0U, 0U, 0U, ACTION_NONE, NULL };
+   SoftTimerWheel_StartTimerTicks(&wheel, &firstTimer, 50U, 0U);
+   (void)SoftTimerWheel_Service(&wheel, 40U);
+   SoftTimerWheel_RestartTimer(&wheel, &firstTimer);
+   (void)SoftTimerWheel_Service(&wheel, 89U);
+   Check((0U == firstRecord.numCalls) && (1U == wheel.numRunningTimers), "Restart pushes back", firstRecord.numCalls);
+   (void)SoftTimerWheel_Service(&wheel, 90U);
+   Check((1U == firstRecord.numCalls) && (90U == firstRecord.lastTick), "Restart due", firstRecord.lastTick);
+}
+
+// Durations of 0 and beyond the range of the wheel are limited
+static void TestDurationLimits(void)
+{
+   SoftTimerWheel_Timer_t timer;
+   Record_t record = { 0U, 0U, 0U, ACTION_NONE, NULL };
+   const Timebase_Tick_t startTick = 0x80000000UL;
+
+   // A duration of 0 is due on the next tick
+   SoftTimerWheel_Init(&wheel, startTick);
+   SoftTimerWheel_InitTimer(&timer, RecordCall, &record);
+   SoftTimerWheel_StartTimerTicks(&wheel, &timer, 0U, 0U);
+   (void)SoftTimerWheel_Service(&wheel, startTick);
+   Check(0U == record.numCalls, "Zero duration not at once", record.numCalls);
+   (void)SoftTimerWheel_Service(&wheel, startTick + 1U);
+   Check((1U == record.numCalls) && ((startTick + 1U) == record.lastTick), "Zero duration next tick", record.lastTick);
+
+   // A longer duration is limited to the longest the wheel holds, and the
+   // timer expires on exactly that tick
+   record.numCalls = 0U;
+   SoftTimerWheel_StartTimerTicks(&wheel, &timer, UINT32_MAX, UINT32_MAX);
+   Check((SOFTTIMERWHEEL_MAX_DURATION_TICKS == timer.durationTicks) && (UINT32_C(0x3FFFFFFF) == timer.periodTicks),
+         "Limited duration", timer.durationTicks);
+   (void)SoftTimerWheel_Service(&wheel, startTick + UINT32_C(0x3FFFFFFF));
+   Check(0U == record.numCalls, "Limited duration early", record.numCalls);
+   (void)SoftTimerWheel_Service(&wheel, startTick + UINT32_C(0x40000000));
+   Check((1U == record.numCalls) && ((startTick + UINT32_C(0x40000000)) == record.lastTick),
+         "Limited duration due", record.lastTick);
+   SoftTimerWheel_StopTimer(&wheel, &timer);
+
+   // Times in milliseconds are limited before they are converted
+   SoftTimerWheel_StartTimer(&wheel, &timer, UINT32_MAX, 0U);
+   Check(Timebase_MillisecondsToTicks(POWER_SOFTTIMERLIB_MAX_DURATION_MILLISECONDS) == timer.durationTicks,
+         "Limited milliseconds", timer.durationTicks);
+   SoftTimerWheel_StopTimer(&wheel, &timer);
+}
+
+// Runs the same periodic timers on the wheel and as polled timers from the
+// simulated clock, and compares the number of expiries and the time taken
+static void TestCompareWithPolling(void)
+{
+   uint32_t numWheelExpiries = 0U;
+   uint32_t numPolledExpiries = 0U;
+   clock_t startTime;
+   clock_t pollTime;
+   clock_t wheelTime;
+
+   // Start the same set of timers on both at the same tick
+   SysTick_Drv_Host_SetCycleCount(0U);
+   (void)Timebase_Init(0U, NULL);
+   SoftTimerWheel_Init(&wheel, Timebase_GetCurrentTickCount());
+
+   for (uint16_t index = 0U; index < NUM_COMPARED_TIMERS; index++)
+   {
+      const uint32_t period = ((index * COMPARED_PERIOD_STEP_TICKS) % MAX_COMPARED_PERIOD_TICKS) + 1U;
+
+      SoftTimerWheel_InitTimer(&comparedWheelTimers[index], CountCall, &numWheelExpiries);
+      SoftTimerWheel_StartTimerTicks(&wheel, &comparedWheelTimers[index], period, period);
+
+      SoftTimerLib_Init(&comparedPolledTimers[index]);
+      SoftTimerLib_StartTimer(&comparedPolledTimers[index], Timebase_TicksToMilliseconds(period));
+   }
+
+   // Poll each timer once per tick as the owners of the timers do today
+   startTime = clock();
+   for (uint32_t tick = 0U; tick < NUM_COMPARED_TICKS; tick++)
+   {
+      SysTick_Drv_Host_AdvanceCycles(TIMEBASE_NUM_CYCLES_PER_TICK);
+
+      for (uint16_t index = 0U; index < NUM_COMPARED_TIMERS; index++)
+      {
+         if (SoftTimerLib_IsTimerExpired(&comparedPolledTimers[index]))
+         {
+            SoftTimerLib_StartTimer(&comparedPolledTimers[index],
+                                    Timebase_TicksToMilliseconds(comparedPolledTimers[index].durationTicks));
+            numPolledExpiries++;
+         }
+      }
+   }
+   pollTime = clock() - startTime;
+
+   // Service the wheel once per tick over the same ticks of the same clock
+   SysTick_Drv_Host_SetCycleCount(0U);
+   (void)Timebase_Init(0U, NULL);
+   startTime = clock();
+   for (uint32_t tick = 0U; tick < NUM_COMPARED_TICKS; tick++)
+   {
+      SysTick_Drv_Host_AdvanceCycles(TIMEBASE_NUM_CYCLES_PER_TICK);
+      (void)SoftTimerWheel_Service(&wheel, Timebase_GetCurrentTickCount());
+   }
+   wheelTime = clock() - startTime;
+
+   Check((numWheelExpiries == numPolledExpiries) && (numWheelExpiries > 0U), "Same expiries as polling", numWheelExpiries);
+
+   printf("%u timers over %lu ticks: polled %.1f ns/tick, wheel %.1f ns/tick, %lu expiries\n",
+          (unsigned int)NUM_COMPARED_TIMERS, (unsigned long)NUM_COMPARED_TICKS,
+          (1.0e9 * (double)pollTime) / ((double)CLOCKS_PER_SEC * (double)NUM_COMPARED_TICKS),
+          (1.0e9 * (double)wheelTime) / ((double)CLOCKS_PER_SEC * (double)NUM_COMPARED_TICKS),
+          (unsigned long)numWheelExpiries);
+}
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Host entry point
+int main(void)
+{
+   (void)Timebase_Init(0U, NULL);
+
+   TestCascadeBoundaries();
+   TestPeriodic();
+   TestCallbackActions();
+   TestDurationLimits();
+   TestCompareWithPolling();
+
+   printf("%lu checks, %lu failed\n", (unsigned long)numChecks, (unsigned long)numFailures);
+
+   return((0U == numFailures) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,183 @@
+/*******************************************************************************
+// Timebase Test
+// Host test of the division-free conversions in Src/Timebase.c. The module is
+// included rather than linked so its private DivideByConstant() can be
+// checked directly. Every 32-bit dividend is divided by each divisor used at
+// any supported tick rate and compared with exact division. The public
+// conversions are compared with exact arithmetic across the whole range, and
+// the tick count and timestamps are followed across a wrap of the cycle
+// counter.
+//
+// Usage (from the repository root):
+//    cc -std=c99 -O2 -I Tools/Host -I Src -I Src/Boards/F28388D_controlCARD \
+//       -o timebase_test Tools/Timebase_Test.c Tools/Host/SysTick_Drv_Host.c \
+//       Tools/Host/Sys_Host.c Src/MessageRouter.c
+//    ./timebase_test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "../Src/Timebase.c"
+// Platform Includes
+#include "SysTick_Drv_Host.h"
+// Other Includes
+#include <stdbool.h> // Defines C99 boolean type
+#include <stdint.h> // Defines C99 integer types
+#include <stdio.h>
+#include <stdlib.h> // C exit codes
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// Step between the inputs of the sampled checks, prime so every low bit
+// pattern is visited
+#define SAMPLE_STEP (UINT32_C(65521))
+
+// Cycles the counter is started before it wraps
+#define CYCLES_BEFORE_WRAP (UINT32_C(3000000))
+
+// Cycles advanced per step when following the counter across its wrap
+#define WRAP_STEP_CYCLES (UINT32_C(99991))
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The number of checks made and the number that failed
+static uint32_t numChecks;
+static uint32_t numFailures;
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Records the result of one check, describing it if it failed
+static void Check(const bool isPassed, const char *const name, const uint32_t value)
+{
+   numChecks++;
+
+   if (!isPassed)
+   {
+      numFailures++;
+      fprintf(stderr, "%s (%lu) failed\n", name, (unsigned long)value);
+   }
+}
+
+// Divides every 32-bit value by each divisor used at the supported tick
+// rates: the cycles per tick at 1, 10 and 100kHz and the cycles per
+// microsecond of the system clock, and the ticks per millisecond and
+// microseconds per tick at the faster rates. A divisor of 1 is not divided.
+// This takes about a minute.
+static void TestDivideByConstant(void)
+{
+// Counts the dividends whose quotient differs from exact division
+#define CHECK_DIVISOR(divisor) \
+   (numMismatches += (DivideByConstant(dividend, (divisor), RECIPROCAL(divisor)) != (dividend / (divisor))) ? 1UL : 0UL)
+
+   uint32_t numMismatches = 0UL;
+   uint32_t dividend = 0UL;
+
+   do
+   {
+      CHECK_DIVISOR((uint32_t)SYS_SYSCLK_FREQ / UINT32_C(1000));
+      CHECK_DIVISOR((uint32_t)SYS_SYSCLK_FREQ / UINT32_C(10000));
+      CHECK_DIVISOR((uint32_t)SYS_SYSCLK_FREQ / UINT32_C(100000));
+      CHECK_DIVISOR(NUM_CYCLES_PER_MICROSECOND);
+      CHECK_DIVISOR(UINT32_C(10));
+      CHECK_DIVISOR(UINT32_C(100));
+      CHECK_DIVISOR(UINT32_C(1000));
+      dividend++;
+   } while (0UL != dividend);
+
+   Check(0UL == numMismatches, "Divide every value", numMismatches);
+
+#undef CHECK_DIVISOR
+}
+
+// The public conversions against exact arithmetic across the whole range
+static void TestConversions(void)
+{
+   uint32_t numMismatches = 0UL;
+   uint32_t firstMismatch = 0UL;
+   uint32_t value = 0UL;
+
+   for (uint64_t sample = 0U; sample <= (UINT64_C(0xFFFFFFFF) + SAMPLE_STEP); sample += SAMPLE_STEP)
+   {
+      // The last sample is the largest value
+      const bool isMismatch =
+         (Timebase_TicksToMilliseconds(value) != (value / (uint32_t)TIMEBASE_NUM_TICKS_PER_MILLISECOND)) ||
+         (Timebase_MicrosecondsToTicks(value) != (value / (uint32_t)TIMEBASE_NUM_MICROSECONDS_PER_TICK)) ||
+         (Timebase_MillisecondsToTicks(value) != (uint32_t)((uint64_t)value * TIMEBASE_NUM_TICKS_PER_MILLISECOND)) ||
+         (Timebase_TicksToMicroseconds(value) != (uint32_t)((uint64_t)value * TIMEBASE_NUM_MICROSECONDS_PER_TICK)) ||
+         (Timebase_CalculateElapsedTimeTicks(value, value + SAMPLE_STEP) != SAMPLE_STEP) ||
+         (Timebase_CalculateElapsedTimeTicks(value, ~value) != (uint32_t)(~value - value));
+
+      if (isMismatch)
+      {
+         numMismatches++;
+         firstMismatch = (0UL == firstMismatch) ? value : firstMismatch;
+      }
+
+      value = (sample + SAMPLE_STEP > UINT64_C(0xFFFFFFFF)) ? UINT32_MAX : (uint32_t)(sample + SAMPLE_STEP);
+   }
+
+   Check(0UL == numMismatches, "Conversions", firstMismatch);
+
+   // Round trips of whole milliseconds, and elapsed time across the wrap
+   Check(Timebase_TicksToMilliseconds(Timebase_MillisecondsToTicks(123456U)) == 123456U, "Millisecond round trip", 123456U);
+   Check(Timebase_MicrosecondsToTicks(Timebase_TicksToMicroseconds(4321U)) == 4321U, "Microsecond round trip", 4321U);
+   Check(Timebase_CalculateElapsedTimeTicks(UINT32_MAX, 0U) == 1U, "Elapsed across wrap", 1U);
+   Check(Timebase_CalculateElapsedTimeTicks(UINT32_MAX - 9U, 10U) == 20U, "Elapsed across wrap by 20", 20U);
+}
+
+// The tick count and timestamps follow the cycle counter across its wrap,
+// in steps that do not line up with ticks or microseconds
+static void TestCounterWrap(void)
+{
+   const Timebase_CycleCount_t startCycles = UINT32_MAX - CYCLES_BEFORE_WRAP + 1U;
+   uint64_t elapsedCycles = 0U;
+   uint32_t numMismatches = 0UL;
+   uint32_t firstMismatch = 0UL;
+
+   SysTick_Drv_Host_SetCycleCount(startCycles);
+   (void)Timebase_Init(0U, NULL);
+
+   while (elapsedCycles < (3U * (uint64_t)CYCLES_BEFORE_WRAP))
+   {
+      const bool isMismatch =
+         (Timebase_GetCurrentTickCount() != (uint32_t)(elapsedCycles / TIMEBASE_NUM_CYCLES_PER_TICK)) ||
+         (Timebase_GetTimestampUs() != (elapsedCycles / NUM_CYCLES_PER_MICROSECOND)) ||
+         (Timebase_GetTimestampCycles() != ((uint64_t)startCycles + elapsedCycles));
+
+      if (isMismatch)
+      {
+         numMismatches++;
+         firstMismatch = (0UL == firstMismatch) ? (uint32_t)elapsedCycles : firstMismatch;
+      }
+
+      SysTick_Drv_Host_AdvanceCycles(WRAP_STEP_CYCLES);
+      elapsedCycles += WRAP_STEP_CYCLES;
+   }
+
+   Check(0UL == numMismatches, "Counter wrap", firstMismatch);
+   Check(1U == status.cycleCountWraps, "Counter wrap counted", status.cycleCountWraps);
+}
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Host entry point
+int main(void)
+{
+   TestDivideByConstant();
+   TestConversions();
+   TestCounterWrap();
+
+   printf("%lu checks, %lu failed\n", (unsigned long)numChecks, (unsigned long)numFailures);
+
+   return((0U == numFailures) ? EXIT_SUCCESS : EXIT_FAILURE);
+}